@@ -65,6 +65,7 @@ enum class KinematicError : uint8_t {
 
 // Create custom run time $ settings
 FloatSetting* kinematic_segment_len;
+FloatSetting* kinematic_segment_tolerance;
 FloatSetting* delta_crank_len;
 FloatSetting* delta_link_len;
 FloatSetting* delta_crank_side_len;
@@ -85,6 +86,34 @@ float re;  // radius of end effector side (length of linkages)
 float f;   // sized of fixed side triangel
 float e;   // size of end effector side triangle
 
+// constants derived from the geometry by read_settings(), when a setting changes. See check_geometry().
+static float    crank_y;              // y of the crank axis in the YZ plane of an arm: -f/2 * tg 30
+static float    effector_y;           // y of the effector joint from the effector center: e/2 * tg 30
+static float    ik_const;             // rf^2 - re^2 - crank_y^2
+static float    fk_t;                 // (f - e) * tg 30 / 2
+static uint32_t geometry_generation;  // Setting::generation when they were worked out
+
+// Segments are converted in runs of this many, before any is planned
+#ifndef KINEMATIC_SEGMENT_RUN
+#    define KINEMATIC_SEGMENT_RUN 16
+#endif
+
+// With a tolerance, segments of $Kinematics/SegmentLength are halved until the arms, moving
+// straight in angle, stay this close to the line. 0 keeps segments of the fixed length.
+#ifndef KINEMATIC_SEGMENT_TOLERANCE
+#    define KINEMATIC_SEGMENT_TOLERANCE 0.0f  // mm
+#endif
+#ifndef KINEMATIC_SPLIT_DEPTH
+#    define KINEMATIC_SPLIT_DEPTH 8  // Most halvings of a segment, to 1/256 of its length
+#endif
+
+// A run of converted segments, waiting to be planned
+struct segment_run_t {
+    float    angles[KINEMATIC_SEGMENT_RUN][3];
+    float    length[KINEMATIC_SEGMENT_RUN];  // Cartesian length of the segment, for its feed rate
+    uint32_t count;
+};
+
 static float last_angle[3]          = { 0.0, 0.0, 0.0 };  // A place to save the previous motor angles for distance/feed rate calcs
 static float last_cartesian[N_AXIS] = {
     0.0, 0.0, 0.0
@@ -93,8 +122,10 @@ static float last_cartesian[N_AXIS] = {
 // prototypes for helper functions
 KinematicError delta_calcInverse(float* cartesian, float* angles);
 KinematicError delta_calcAngleYZ(float x0, float y0, float z0, float& theta);
+static bool    delta_calcForward(float* motors, float* cartesian);
 float          three_axis_dist(float* point1, float* point2);
 void           read_settings();
+static void    check_geometry();
 
 void machine_init() {
     float angles[N_AXIS]    = { 0.0, 0.0, 0.0 };
@@ -102,10 +133,13 @@ void machine_init() {
 
     // Custom $ settings
     kinematic_segment_len   = new FloatSetting(EXTENDED, WG, NULL, "Kinematics/SegmentLength", KINEMATIC_SEGMENT_LENGTH, 0.2, 1000.0);
+    kinematic_segment_tolerance =
+        new FloatSetting(EXTENDED, WG, NULL, "Kinematics/SegmentTolerance", KINEMATIC_SEGMENT_TOLERANCE, 0.0, 10.0);
     delta_crank_len         = new FloatSetting(EXTENDED, WG, NULL, "Delta/CrankLength", RADIUS_FIXED, 50.0, 500.0);
     delta_link_len          = new FloatSetting(EXTENDED, WG, NULL, "Delta/LinkLength", RADIUS_EFF, 50.0, 500.0);
     delta_crank_side_len    = new FloatSetting(EXTENDED, WG, NULL, "Delta/CrankSideLength", LENGTH_FIXED_SIDE, 20.0, 500.0);
     delta_effector_side_len = new FloatSetting(EXTENDED, WG, NULL, "Delta/EffectorSideLength", LENGTH_EFF_SIDE, 20.0, 500.0);
+    read_settings();
 
     // Calculate the Z offset at the arm zero angles ...
     // Z offset is the z distance from the motor axes to the end effector axes at zero angle
@@ -132,17 +166,47 @@ void machine_init() {
 // #endif
 // }
 
+// Plans the segments of the run, and empties it. Returns false if a jog was cancelled.
+static bool plan_run(segment_run_t& run, plan_line_data_t* pl_data, float feed_rate) {
+    uint32_t count = run.count;
+    run.count      = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        float* angles = run.angles[i];
+
+        if (pl_data->motion.rapidMotion) {
+            pl_data->feed_rate = feed_rate;
+        } else {
+            float delta_distance = three_axis_dist(angles, last_angle);
+            pl_data->feed_rate   = (feed_rate * delta_distance / run.length[i]);
+        }
+
+        // mc_line() returns false if a jog is cancelled.
+        // In that case we stop sending segments to the planner.
+        if (!mc_line(angles, pl_data)) {
+            return false;
+        }
+
+        // save angles for next distance calc
+        // This is after mc_line() so that we do not update
+        // last_angle if the segment was discarded.
+        memcpy(last_angle, angles, sizeof(last_angle));
+    }
+    return true;
+}
+
 bool cartesian_to_motors(float* target, plan_line_data_t* pl_data, float* position) {
     float dx, dy, dz;  // distances in each cartesian axis
     float motor_angles[3];
 
-    float seg_target[3];                    // The target of the current segment
-    float feed_rate  = pl_data->feed_rate;  // save original feed rate
-    bool  show_error = true;                // shows error once
+    float seg_target[3];                   // The target of the current segment
+    float feed_rate = pl_data->feed_rate;  // save original feed rate
+    float tolerance = kinematic_segment_tolerance->get();
 
-    KinematicError status;
+    // The segments are converted a run at a time, all three arms of each, and only then planned.
+    segment_run_t run;
+    run.count = 0;
 
-    read_settings();
+    KinematicError status;
 
     // grbl_msg_sendf(CLIENT_SERIAL, MsgLevel::Info, "Start %3.3f %3.3f %3.3f", position[0], position[1], position[2]);
     // grbl_msg_sendf(CLIENT_SERIAL, MsgLevel::Info, "Target %3.3f %3.3f %3.3f", target[0], target[1], target[2]);
@@ -175,55 +239,96 @@ bool cartesian_to_motors(float* target, plan_line_data_t* pl_data, float* positi
 
     float segment_dist = dist / ((float)segment_count);  // distance of each segment...will be used for feedrate conversion
 
-    for (uint32_t segment = 1; segment <= segment_count; segment++) {
-        // determine this segment's target
-        seg_target[X_AXIS] = position[X_AXIS] + (dx / float(segment_count) * segment);
-        seg_target[Y_AXIS] = position[Y_AXIS] + (dy / float(segment_count) * segment);
-        seg_target[Z_AXIS] = position[Z_AXIS] + (dz / float(segment_count) * segment);
-
-        // calculate the delta motor angles
-        KinematicError status = delta_calcInverse(seg_target, motor_angles);
-
-        if (status != KinematicError ::NONE) {
-            if (show_error) {
-                // grbl_msg_sendf(CLIENT_SERIAL,
-                //                MsgLevel::Info,
-                //                "Error:%d, Angs X:%4.3f Y:%4.3f Z:%4.3f",
-                //                status,
-                //                motor_angles[0],
-                //                motor_angles[1],
-                //                motor_angles[2]);
-                show_error = false;
+    if (tolerance == 0) {
+        for (uint32_t segment = 1; segment <= segment_count; segment++) {
+            // determine this segment's target
+            seg_target[X_AXIS] = position[X_AXIS] + (dx / float(segment_count) * segment);
+            seg_target[Y_AXIS] = position[Y_AXIS] + (dy / float(segment_count) * segment);
+            seg_target[Z_AXIS] = position[Z_AXIS] + (dz / float(segment_count) * segment);
+
+            // calculate the delta motor angles
+            status = delta_calcInverse(seg_target, run.angles[run.count]);
+
+            if (status != KinematicError ::NONE) {
+                plan_run(run, pl_data, feed_rate);  // The segments before it are still planned
+                return false;
+            }
+            run.length[run.count++] = segment_dist;
+            if (run.count == KINEMATIC_SEGMENT_RUN && !plan_run(run, pl_data, feed_rate)) {
+                return false;
             }
-            return false;
-        }
-        if (pl_data->motion.rapidMotion) {
-            pl_data->feed_rate = feed_rate;
-        } else {
-            float delta_distance = three_axis_dist(motor_angles, last_angle);
-            pl_data->feed_rate   = (feed_rate * delta_distance / segment_dist);
         }
+        return plan_run(run, pl_data, feed_rate);
+    }
 
-        // mc_line() returns false if a jog is cancelled.
-        // In that case we stop sending segments to the planner.
-        if (!mc_line(motor_angles, pl_data)) {
+    // Each segment of the fixed length is split in halves until the arms, moving straight in
+    // angle from one end to the other, pass within the tolerance of the middle of the line. The
+    // ends still to reach are stacked, the nearest on top; the start moves along as each is reached.
+    struct {
+        float t;  // The fraction of the move
+        float angles[3];
+    } ends[KINEMATIC_SPLIT_DEPTH + 1];
+    float start_t = 0;
+    float start_angles[3];
+
+    if (delta_calcInverse(position, start_angles) != KinematicError::NONE) {
+        return false;
+    }
+    for (uint32_t segment = 1; segment <= segment_count; segment++) {
+        float t = float(segment) / float(segment_count);
+        int   depth;
+
+        seg_target[X_AXIS] = position[X_AXIS] + dx * t;
+        seg_target[Y_AXIS] = position[Y_AXIS] + dy * t;
+        seg_target[Z_AXIS] = position[Z_AXIS] + dz * t;
+        status             = delta_calcInverse(seg_target, ends[0].angles);
+        ends[0].t          = t;
+        depth              = 1;
+
+        while (status == KinematicError::NONE && depth) {
+            auto& end = ends[depth - 1];
+
+            if (depth <= KINEMATIC_SPLIT_DEPTH) {
+                float mid_angles[3];
+                float mid_path[3];
+                float mid_t = (start_t + end.t) / 2;
+
+                seg_target[X_AXIS] = position[X_AXIS] + dx * mid_t;
+                seg_target[Y_AXIS] = position[Y_AXIS] + dy * mid_t;
+                seg_target[Z_AXIS] = position[Z_AXIS] + dz * mid_t;
+                status             = delta_calcInverse(seg_target, ends[depth].angles);
+                for (int arm = 0; arm < 3; arm++) {
+                    mid_angles[arm] = (start_angles[arm] + end.angles[arm]) / 2;
+                }
+                if (status == KinematicError::NONE &&
+                    (!delta_calcForward(mid_angles, mid_path) || three_axis_dist(mid_path, seg_target) > tolerance)) {
+                    ends[depth++].t = mid_t;
+                    continue;
+                }
+            }
+            if (status == KinematicError::NONE) {
+                memcpy(run.angles[run.count], end.angles, sizeof(end.angles));
+                run.length[run.count++] = (end.t - start_t) * dist;
+                start_t                 = end.t;
+                memcpy(start_angles, end.angles, sizeof(start_angles));
+                depth--;
+                if (run.count == KINEMATIC_SEGMENT_RUN && !plan_run(run, pl_data, feed_rate)) {
+                    return false;
+                }
+            }
+        }
+        if (status != KinematicError::NONE) {
+            plan_run(run, pl_data, feed_rate);  // The segments before it are still planned
             return false;
         }
-
-        // save angles for next distance calc
-        // This is after mc_line() so that we do not update
-        // last_angle if the segment was discarded.
-        memcpy(last_angle, motor_angles, sizeof(motor_angles));
     }
-    return true;
+    return plan_run(run, pl_data, feed_rate);
 }
 
 // this is used used by Grbl soft limits to see if the range of the machine is exceeded.
 bool limitsCheckTravel(float* target) {
     float motor_angles[3];
 
-    read_settings();
-
     grbl_msg_sendf(CLIENT_SERIAL, MsgLevel::Info, "Kin Soft Check %3.3f, %3.3f, %3.3f", target[0], target[1], target[2]);
 
     switch (delta_calcInverse(target, motor_angles)) {
@@ -246,6 +351,7 @@ bool limitsCheckTravel(float* target) {
 // inverse kinematics: cartesian -> angles
 // returned status: 0=OK, -1=non-existing position
 KinematicError delta_calcInverse(float* cartesian, float* angles) {
+    check_geometry();
     angles[0] = angles[1] = angles[2] = 0;
     KinematicError status             = KinematicError::NONE;
 
@@ -276,9 +382,16 @@ KinematicError delta_calcInverse(float* cartesian, float* angles) {
 
 // inverse kinematics: angles -> cartesian
 void motors_to_cartesian(float* cartesian, float* motors, int n_axis) {
-    read_settings();
+    if (!delta_calcForward(motors, cartesian)) {
+        grbl_msg_sendf(CLIENT_SERIAL, MsgLevel::Info, "MSG:Fwd Kin Error");
+    }
+}
 
-    float t = (f - e) * tan30 / 2;
+// forward kinematics: angles -> cartesian. Returns false, leaving cartesian as it was, if the arms
+// cannot meet.
+static bool delta_calcForward(float* motors, float* cartesian) {
+    check_geometry();
+    float t = fk_t;
 
     float y1 = -(t + rf * cos(motors[0]));
     float z1 = -rf * sin(motors[0]);
@@ -313,30 +426,31 @@ void motors_to_cartesian(float* cartesian, float* motors, int n_axis) {
     // discriminant
     float d = b * b - (float)4.0 * a * c;
     if (d < 0) {
-        grbl_msg_sendf(CLIENT_SERIAL, MsgLevel::Info, "MSG:Fwd Kin Error");
-        return;
+        return false;
     }
 
-    cartesian[Z_AXIS] = -(float)0.5 * (b + sqrt(d)) / a;
+    cartesian[Z_AXIS] = -(float)0.5 * (b + sqrtf(d)) / a;
     cartesian[X_AXIS] = (a1 * cartesian[Z_AXIS] + b1) / dnm;
     cartesian[Y_AXIS] = (a2 * cartesian[Z_AXIS] + b2) / dnm;
+    return true;
 }
 
 // helper functions, calculates angle theta1 (for YZ-pane)
 KinematicError delta_calcAngleYZ(float x0, float y0, float z0, float& theta) {
-    float y1 = -0.5 * 0.57735 * f;  // f/2 * tg 30
-    y0 -= 0.5 * 0.57735 * e;        // shift center to edge
+    float y1 = crank_y;  // f/2 * tg 30
+    y0 -= effector_y;    // shift center to edge
     // z = a + b*y
-    float a = (x0 * x0 + y0 * y0 + z0 * z0 + rf * rf - re * re - y1 * y1) / (2 * z0);
-    float b = (y1 - y0) / z0;
+    float inv_z0 = 1.0f / z0;
+    float a      = (x0 * x0 + y0 * y0 + z0 * z0 + ik_const) * 0.5f * inv_z0;
+    float b      = (y1 - y0) * inv_z0;
     // discriminant
     float d = -(a + b * y1) * (a + b * y1) + rf * (b * b * rf + rf);
     if (d < 0)
-        return KinematicError::OUT_OF_RANGE;          // non-existing point
-    float yj = (y1 - a * b - sqrt(d)) / (b * b + 1);  // choosing outer point
+        return KinematicError::OUT_OF_RANGE;           // non-existing point
+    float yj = (y1 - a * b - sqrtf(d)) / (b * b + 1);  // choosing outer point
     float zj = a + b * yj;
     //theta    = 180.0 * atan(-zj / (y1 - yj)) / M_PI + ((yj > y1) ? 180.0 : 0.0);
-    theta = atan(-zj / (y1 - yj)) + ((yj > y1) ? M_PI : 0.0);
+    theta = atanf(-zj / (y1 - yj)) + ((yj > y1) ? float(M_PI) : 0.0f);
 
     if (theta < MAX_NEGATIVE_ANGLE) {
         return KinematicError::ANGLE_TOO_NEGATIVE;
@@ -351,7 +465,7 @@ KinematicError delta_calcAngleYZ(float x0, float y0, float z0, float& theta) {
 
 // Determine the unit distance between (2) 3D points
 float three_axis_dist(float* point1, float* point2) {
-    return sqrt(((point1[0] - point2[0]) * (point1[0] - point2[0])) + ((point1[1] - point2[1]) * (point1[1] - point2[1])) +
+    return sqrtf(((point1[0] - point2[0]) * (point1[0] - point2[0])) + ((point1[1] - point2[1]) * (point1[1] - point2[1])) +
                 ((point1[2] - point2[2]) * (point1[2] - point2[2])));
 }
 
@@ -400,9 +514,26 @@ void kinematics_post_homing() {
 
 void user_m30() {}
 
+// Reads the geometry, and works out the constants the kinematics use from it. Called at startup and
+// by check_geometry(), rather than for every move.
 void read_settings() {
+    geometry_generation = Setting::generation;
+
     rf = delta_crank_len->get();          // radius of the fixed side (length of motor cranks)
     re = delta_link_len->get();           // radius of end effector side (length of linkages)
     f  = delta_crank_side_len->get();     // sized of fixed side triangel
     e  = delta_effector_side_len->get();  // size of end effector side triangle
+
+    crank_y    = -0.5f * tan30 * f;
+    effector_y = 0.5f * tan30 * e;
+    ik_const   = rf * rf - re * re - crank_y * crank_y;
+    fk_t       = (f - e) * tan30 / 2;
+}
+
+// Reads the settings again once any of them has changed, by $ command, $RST through setDefault(),
+// or from NVS by load(), all of which count in Setting::generation.
+static void check_geometry() {
+    if (geometry_generation != Setting::generation) {
+        read_settings();
+    }
 }
@@ -60,6 +60,36 @@ float abs_angle(float ang);
 static float last_angle  = 0;
 static float last_radius = 0;
 
+// Segments are converted in runs of this many, before any is planned
+#ifndef KINEMATIC_SEGMENT_RUN
+#    define KINEMATIC_SEGMENT_RUN 16
+#endif
+
+// With a tolerance, segments of $Kinematics/SegmentLength are halved until the radius and angle, moving
+// straight from one end to the other, stay this close to the line. 0 keeps segments of the fixed
+// length.
+#ifndef SEGMENT_TOLERANCE
+#    define SEGMENT_TOLERANCE 0.0  // mm
+#endif
+#ifndef KINEMATIC_SPLIT_DEPTH
+#    define KINEMATIC_SPLIT_DEPTH 8  // Most halvings of a segment, to 1/256 of its length
+#endif
+
+FloatSetting* kinematic_segment_len;
+FloatSetting* kinematic_segment_tolerance;
+
+// A run of converted segments, waiting to be planned
+struct segment_run_t {
+    float    polar[KINEMATIC_SEGMENT_RUN][N_AXIS];
+    float    length[KINEMATIC_SEGMENT_RUN];  // Cartesian length of the segment, for its feed rate
+    uint32_t count;
+};
+
+void machine_init() {
+    kinematic_segment_len       = new FloatSetting(EXTENDED, WG, NULL, "Kinematics/SegmentLength", SEGMENT_LENGTH, 0.2, 1000.0);
+    kinematic_segment_tolerance = new FloatSetting(EXTENDED, WG, NULL, "Kinematics/SegmentTolerance", SEGMENT_TOLERANCE, 0.0, 10.0);
+}
+
 // this get called before homing
 // return false to complete normal home
 // return true to exit normal homing
@@ -86,36 +116,15 @@ void kinematics_post_homing() {
 
 */
 
-bool cartesian_to_motors(float* target, plan_line_data_t* pl_data, float* position) {
-    float    dx, dy, dz;          // distances in each cartesian axis
-    float    p_dx, p_dy, p_dz;    // distances in each polar axis
-    float    dist, polar_dist;    // the distances in both systems...used to determine feed rate
-    uint32_t segment_count;       // number of segments the move will be broken in to.
-    float    seg_target[N_AXIS];  // The target of the current segment
-    float    polar[N_AXIS];       // target location in polar coordinates
-    float    x_offset = gc_state.coord_system[X_AXIS] + gc_state.coord_offset[X_AXIS];  // offset from machine coordinate system
-    float    z_offset = gc_state.coord_system[Z_AXIS] + gc_state.coord_offset[Z_AXIS];  // offset from machine coordinate system
-    //grbl_sendf(CLIENT_SERIAL, "Position: %4.2f %4.2f %4.2f \r\n", position[X_AXIS] - x_offset, position[Y_AXIS], position[Z_AXIS]);
-    //grbl_sendf(CLIENT_SERIAL, "Target: %4.2f %4.2f %4.2f \r\n", target[X_AXIS] - x_offset, target[Y_AXIS], target[Z_AXIS]);
-    // calculate cartesian move distance for each axis
-    dx = target[X_AXIS] - position[X_AXIS];
-    dy = target[Y_AXIS] - position[Y_AXIS];
-    dz = target[Z_AXIS] - position[Z_AXIS];
-    // calculate the total X,Y axis move distance
-    // Z axis is the same in both coord systems, so it is ignored
-    dist = sqrt((dx * dx) + (dy * dy) + (dz * dz));
-    if (pl_data->motion.rapidMotion) {
-        segment_count = 1;  // rapid G0 motion is not used to draw, so skip the segmentation
-    } else {
-        segment_count = ceil(dist / SEGMENT_LENGTH);  // determine the number of segments we need	... round up so there is at least 1
-    }
-    dist /= segment_count;  // segment distance
-    for (uint32_t segment = 1; segment <= segment_count; segment++) {
-        // determine this segment's target
-        seg_target[X_AXIS] = position[X_AXIS] + (dx / float(segment_count) * segment) - x_offset;
-        seg_target[Y_AXIS] = position[Y_AXIS] + (dy / float(segment_count) * segment);
-        seg_target[Z_AXIS] = position[Z_AXIS] + (dz / float(segment_count) * segment) - z_offset;
-        calc_polar(seg_target, polar, last_angle);
+// Plans the segments of the run, and empties it. Returns false if a jog was cancelled.
+static bool plan_run(segment_run_t& run, plan_line_data_t* pl_data, float dz, float x_offset, float z_offset) {
+    float    p_dx, p_dy, p_dz;  // distances in each polar axis
+    float    polar_dist;        // the distance in polar space...used to determine feed rate
+    uint32_t count = run.count;
+    run.count      = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        float* polar = run.polar[i];
+        float  dist  = run.length[i];
         // begin determining new feed rate
         // calculate move distance for each axis
         p_dx                      = polar[RADIUS_AXIS] - last_radius;
@@ -149,10 +158,115 @@ bool cartesian_to_motors(float* target, plan_line_data_t* pl_data, float* positi
         last_radius = polar[RADIUS_AXIS];
         last_angle  = polar[POLAR_AXIS];
     }
-    // TO DO don't need a feedrate for rapids
     return true;
 }
 
+// How far the machine strays from the line, at its middle, when the radius and angle move
+// straight from one end of a segment to the other
+static float polar_deviation(float* start, float* end, float* middle_xyz) {
+    float radius = (start[RADIUS_AXIS] + end[RADIUS_AXIS]) / 2;
+    float angle  = (start[POLAR_AXIS] + end[POLAR_AXIS]) * (float(M_PI) / 360.0f);  // The mean, in radians
+    return hypot_f(radius * cosf(angle) - middle_xyz[X_AXIS], radius * sinf(angle) - middle_xyz[Y_AXIS]);
+}
+
+bool cartesian_to_motors(float* target, plan_line_data_t* pl_data, float* position) {
+    float    dx, dy, dz;          // distances in each cartesian axis
+    float    dist;                // the distance of the move
+    uint32_t segment_count;       // number of segments the move will be broken in to.
+    float    seg_target[N_AXIS];  // The target of the current segment
+    float    x_offset  = gc_state.coord_system[X_AXIS] + gc_state.coord_offset[X_AXIS];  // offset from machine coordinate system
+    float    z_offset  = gc_state.coord_system[Z_AXIS] + gc_state.coord_offset[Z_AXIS];  // offset from machine coordinate system
+    float    tolerance = kinematic_segment_tolerance->get();
+    //grbl_sendf(CLIENT_SERIAL, "Position: %4.2f %4.2f %4.2f \r\n", position[X_AXIS] - x_offset, position[Y_AXIS], position[Z_AXIS]);
+    //grbl_sendf(CLIENT_SERIAL, "Target: %4.2f %4.2f %4.2f \r\n", target[X_AXIS] - x_offset, target[Y_AXIS], target[Z_AXIS]);
+    // calculate cartesian move distance for each axis
+    dx = target[X_AXIS] - position[X_AXIS];
+    dy = target[Y_AXIS] - position[Y_AXIS];
+    dz = target[Z_AXIS] - position[Z_AXIS];
+    // calculate the total X,Y axis move distance
+    // Z axis is the same in both coord systems, so it is ignored
+    dist = sqrt((dx * dx) + (dy * dy) + (dz * dz));
+    if (pl_data->motion.rapidMotion) {
+        segment_count = 1;  // rapid G0 motion is not used to draw, so skip the segmentation
+        tolerance     = 0;
+    } else {
+        segment_count = ceil(dist / kinematic_segment_len->get());  // determine the number of segments we need	... round up so there is at least 1
+    }
+    // The segments are converted a run at a time, and only then planned.
+    segment_run_t run;
+    run.count = 0;
+
+    if (tolerance == 0) {
+        float angle = last_angle;
+        for (uint32_t segment = 1; segment <= segment_count; segment++) {
+            // determine this segment's target
+            seg_target[X_AXIS] = position[X_AXIS] + (dx / float(segment_count) * segment) - x_offset;
+            seg_target[Y_AXIS] = position[Y_AXIS] + (dy / float(segment_count) * segment);
+            seg_target[Z_AXIS] = position[Z_AXIS] + (dz / float(segment_count) * segment) - z_offset;
+            calc_polar(seg_target, run.polar[run.count], angle);
+            angle                   = run.polar[run.count][POLAR_AXIS];
+            run.length[run.count++] = dist / segment_count;  // segment distance
+            if (run.count == KINEMATIC_SEGMENT_RUN && !plan_run(run, pl_data, dz, x_offset, z_offset)) {
+                return false;
+            }
+        }
+        // TO DO don't need a feedrate for rapids
+        return plan_run(run, pl_data, dz, x_offset, z_offset);
+    }
+
+    // Each segment of the fixed length is split in halves until the radius and angle, moving
+    // straight from one end to the other, pass within the tolerance of the middle of the line. The
+    // ends still to reach are stacked, the nearest on top; the start moves along as each is reached.
+    struct {
+        float t;  // The fraction of the move
+        float polar[N_AXIS];
+    } ends[KINEMATIC_SPLIT_DEPTH + 1];
+    float start_t = 0;
+    float start[N_AXIS];
+
+    seg_target[X_AXIS] = position[X_AXIS] - x_offset;
+    seg_target[Y_AXIS] = position[Y_AXIS];
+    seg_target[Z_AXIS] = position[Z_AXIS] - z_offset;
+    calc_polar(seg_target, start, last_angle);
+    for (uint32_t segment = 1; segment <= segment_count; segment++) {
+        float t = float(segment) / float(segment_count);
+        int   depth;
+
+        seg_target[X_AXIS] = position[X_AXIS] + dx * t - x_offset;
+        seg_target[Y_AXIS] = position[Y_AXIS] + dy * t;
+        seg_target[Z_AXIS] = position[Z_AXIS] + dz * t - z_offset;
+        calc_polar(seg_target, ends[0].polar, start[POLAR_AXIS]);
+        ends[0].t = t;
+        depth     = 1;
+
+        while (depth) {
+            auto& end = ends[depth - 1];
+
+            if (depth <= KINEMATIC_SPLIT_DEPTH) {
+                float mid_t = (start_t + end.t) / 2;
+
+                seg_target[X_AXIS] = position[X_AXIS] + dx * mid_t - x_offset;
+                seg_target[Y_AXIS] = position[Y_AXIS] + dy * mid_t;
+                if (polar_deviation(start, end.polar, seg_target) > tolerance) {
+                    seg_target[Z_AXIS] = position[Z_AXIS] + dz * mid_t - z_offset;
+                    calc_polar(seg_target, ends[depth].polar, start[POLAR_AXIS]);
+                    ends[depth++].t = mid_t;
+                    continue;
+                }
+            }
+            memcpy(run.polar[run.count], end.polar, sizeof(end.polar));
+            run.length[run.count++] = (end.t - start_t) * dist;
+            start_t                 = end.t;
+            memcpy(start, end.polar, sizeof(start));
+            depth--;
+            if (run.count == KINEMATIC_SEGMENT_RUN && !plan_run(run, pl_data, dz, x_offset, z_offset)) {
+                return false;
+            }
+        }
+    }
+    return plan_run(run, pl_data, dz, x_offset, z_offset);
+}
+
 /*
 Forward kinematics converts position back to the original cartesian system. It is
 typically used for reporting
@@ -193,29 +307,29 @@ void calc_polar(float* target_xyz, float* polar, float last_angle) {
     if (polar[RADIUS_AXIS] == 0) {
         polar[POLAR_AXIS] = last_angle;  // don't care about angle at center
     } else {
-        polar[POLAR_AXIS] = atan2(target_xyz[Y_AXIS], target_xyz[X_AXIS]) * 180.0 / M_PI;
+        polar[POLAR_AXIS] = atan2f(target_xyz[Y_AXIS], target_xyz[X_AXIS]) * (180.0f / float(M_PI));
         // no negative angles...we want the absolute angle not -90, use 270
         polar[POLAR_AXIS] = abs_angle(polar[POLAR_AXIS]);
     }
     polar[Z_AXIS] = target_xyz[Z_AXIS];  // Z is unchanged
     delta_ang     = polar[POLAR_AXIS] - abs_angle(last_angle);
     // if the delta is above 180 degrees it means we are crossing the 0 degree line
-    if (fabs(delta_ang) <= 180.0)
+    if (fabsf(delta_ang) <= 180.0f)
         polar[POLAR_AXIS] = last_angle + delta_ang;
     else {
-        if (delta_ang > 0.0) {
+        if (delta_ang > 0.0f) {
             // crossing zero counter clockwise
-            polar[POLAR_AXIS] = last_angle - (360.0 - delta_ang);
+            polar[POLAR_AXIS] = last_angle - (360.0f - delta_ang);
         } else
-            polar[POLAR_AXIS] = last_angle + delta_ang + 360.0;
+            polar[POLAR_AXIS] = last_angle + delta_ang + 360.0f;
     }
 }
 
 // Return a 0-360 angle ... fix above 360 and below zero
 float abs_angle(float ang) {
-    ang = fmod(ang, 360.0);  // 0-360 or 0 to -360
-    if (ang < 0.0)
-        ang = 360.0 + ang;
+    ang = fmodf(ang, 360.0f);  // 0-360 or 0 to -360
+    if (ang < 0.0f)
+        ang = 360.0f + ang;
     return ang;
 }
 
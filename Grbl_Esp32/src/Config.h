@@ -92,6 +92,21 @@ const int MAX_N_AXIS = 6;
 // serial monitor, sender, etc uses a different value than 115200
 #define BAUD_RATE 115200
 
+// High-speed serial streaming. Uncomment to run the serial port at this rate instead of BAUD_RATE,
+// from 921600 up to 2000000 baud, for senders that stream many short lines. The UART driver then
+// gets a 4096 byte receive buffer (see RX_BUFFER_SIZE) and a 1024 byte send buffer, which hold the
+// input that arrives between reads. Bf: in the status report still shows the room in the line
+// buffer of the client (see LINE_PENDING_SIZE), so that a character-counting sender never leaves
+// realtime commands waiting in the driver. At these rates a sender should also use RTS/CTS flow
+// control: if the USB serial bridge of your board has them wired, define SERIAL_RTS_PIN and
+// SERIAL_CTS_PIN in the machine file. The ESP32 boot text is still sent at 115200.
+// #define SERIAL_HIGH_SPEED_BAUD 921600
+
+// Accepts lines that start with ':' as binary motion frames, which carry moves the host has already
+// parsed and go to motion control without the g-code parser. See Frames.h for the format. A line
+// that starts with ':' is never valid g-code, so this does not change how g-code is handled.
+#define ENABLE_BINARY_FRAMES  // Default enabled. Comment to disable.
+
 //Connect to your local AP with these credentials
 //#define CONNECT_TO_SSID  "your SSID"
 //#define SSID_PASSWORD  "your SSID password"
@@ -131,6 +146,15 @@ const int MAX_N_AXIS = 6;
 // #define ENABLE_AUTHENTICATION
 //CONFIGURE_EYECATCH_END (DO NOT MODIFY THIS LINE)
 
+// The host simulator (see sim/) builds the motion core on a PC, where there
+// is no radio, SD card or web stack to talk to.
+#ifdef GRBL_SIM
+#    undef ENABLE_BLUETOOTH
+#    undef ENABLE_WIFI
+#    undef WIFI_OR_BLUETOOTH
+#    undef ENABLE_SD_CARD
+#endif
+
 #ifdef ENABLE_AUTHENTICATION
 const char* const DEFAULT_ADMIN_PWD   = "admin";
 const char* const DEFAULT_USER_PWD    = "user";
@@ -328,6 +352,7 @@ namespace SpindleSpeedOverride {
 // NOTE: The options below are here only provide a way to disable certain data fields if a unique
 // situation demands it, but be aware GUIs may depend on this data. If disabled, it may not be compatible.
 #define REPORT_FIELD_BUFFER_STATE        // Default enabled. Comment to disable.
+#define REPORT_FIELD_PLANNER_STATE       // Default enabled. Comment to disable.
 #define REPORT_FIELD_PIN_STATE           // Default enabled. Comment to disable.
 #define REPORT_FIELD_CURRENT_FEED_SPEED  // Default enabled. Comment to disable.
 #define REPORT_FIELD_WORK_COORD_OFFSET   // Default enabled. Comment to disable.
@@ -355,8 +380,15 @@ const int REPORT_WCO_REFRESH_IDLE_COUNT = 10;  // (2-255) Must be less than or e
 // NOTE: Changing this value also changes the execution time of a segment in the step segment buffer.
 // When increasing this value, this stores less overall time in the segment buffer and vice versa. Make
 // certain the step segment buffer is increased/decreased to account for these changes.
+// This is the default for $Stepper/SegmentRate, which sets it at startup.
 const int ACCELERATION_TICKS_PER_SECOND = 100;
 
+// Counts the steps and time of each step segment in 64-bit Q16.16 fixed point, instead of floats.
+// The segments of a block then always add up to its exact step count, however long the move. With
+// floats, a block of more than about 16 million steps loses steps. It also replaces the float ceil()
+// and division of every segment with integer operations. Compare the two with the host simulator.
+// #define FIXED_POINT_PREP  // Default disabled. Uncomment to enable.
+
 // Sets the maximum step rate allowed to be written as a Grbl setting. This option enables an error
 // check in the settings module to prevent settings values that will exceed this limitation. The maximum
 // step rate is strictly limited by the CPU speed and will change if something other than an AVR running
@@ -415,11 +447,17 @@ const double MINIMUM_JUNCTION_SPEED = 0.0;  // (mm/min)
 // machines, perhaps to 0.1mm/min, but your success may vary based on multiple factors.
 const double MINIMUM_FEED_RATE = 1.0;  // (mm/min)
 
-// Number of arc generation iterations by small angle approximation before exact arc trajectory
-// correction with expensive sin() and cos() calcualtions. This parameter maybe decreased if there
-// are issues with the accuracy of the arc generations, or increased if arc execution is getting
-// bogged down by too many trig calculations.
-const int N_ARC_CORRECTION = 12;  // Integer (1-255)
+// The most consecutive lines that are merged into one planner block when $Planner/MergeTolerance
+// is set. Each line is checked against the vertices of the lines already merged with it, so the
+// cost of a merge grows with this value.
+const int MERGE_MAX_LINES = 32;  // Integer (2-255)
+
+// How far the entry speed of a block with a jerk may fall behind its full plan, as a fraction of the
+// speed. Through short lines whose junctions end their S-curve ramps, each new block raises the entry
+// speeds of the whole buffer by a little less at every block back, so a deep buffer would be planned
+// over again for every block. The planner stops at a block whose entry speed rises by less than this,
+// and keeps its plan from before, which the blocks ahead of it were planned from.
+const double S_CURVE_REPLAN_TOLERANCE = 0.01;  // Float (0.0 plans every block again)
 
 // The arc G2/3 GCode standard is problematic by definition. Radius-based arcs have horrible numerical
 // errors when arc at semi-circles(pi) or full-circles(2*pi). Offset-based arcs are much more accurate
@@ -431,6 +469,13 @@ const int N_ARC_CORRECTION = 12;  // Integer (1-255)
 // much greater than this. The default setting should capture most, if not all, full arc error situations.
 const double ARC_ANGULAR_TRAVEL_EPSILON = 5E-7;  // Float (radians)
 
+// Plans each G2/G3 arc and G5 spline as a single curved planner block, which segment prep follows
+// point by point, instead of splitting it into short lines that each take a planner block. The speed
+// around a curve is then limited by centripetal acceleration, not by the junctions between lines.
+// Machines with kinematics, or with custom code that may provide them, always use lines, because
+// their motors do not move in the space the curve is drawn in.
+#define NATIVE_CURVES  // Default enabled. Comment to disable.
+
 // Time delay increments performed during a dwell. The default value is set at 50ms, which provides
 // a maximum time delay of roughly 55 minutes, more than enough for most any application. Increasing
 // this delay will increase the maximum dwell time linearly, but also reduces the responsiveness of
@@ -446,13 +491,19 @@ const int DWELL_TIME_STEP = 50;  // Integer (1-255) (milliseconds)
 // While this is experimental, it is intended to be the future default method after testing
 //#define USE_RMT_STEPS
 
+// With USE_RMT_STEPS, sends the step pulses of many step events at once, as a train of RMT pulses
+// for each axis, so that the step timer interrupts once for each train instead of once for each
+// step event. A train holds up to 63 pulses of an axis, at most 6 ms of motion, and runs to the end
+// of the next segment at the latest. Not used in laser mode, while probing or while homing, which
+// act on each step as it is taken.
+// #define RMT_STEP_TRAINS  // Default disabled. Uncomment to enable.
+
 // STEP_PULSE_DELAY is now a setting...$Stepper/Direction/Delay
 
-// The number of linear motions in the planner buffer to be planned at any give time. The vast
-// majority of RAM that Grbl uses is based on this buffer size. Only increase if there is extra
-// available RAM, like when re-compiling for a Mega2560. Or decrease if the Arduino begins to
-// crash due to the lack of available RAM or if the CPU is having trouble keeping up with planning
-// new incoming motions as they are executed.
+// The default number of linear motions in the planner buffer to be planned at any give time.
+// The buffer is sized at startup from $Planner/Blocks (8 to 512), so this only sets the default
+// for that setting. A deeper buffer lets jobs made of many short segments reach their programmed
+// feed, at the cost of about 100 bytes of RAM per block; boards with PSRAM put it there.
 // #define BLOCK_BUFFER_SIZE 16 // Uncomment to override default in planner.h.
 
 // Governs the size of the intermediary step segment buffer between the step execution algorithm
@@ -461,6 +512,8 @@ const int DWELL_TIME_STEP = 50;  // Integer (1-255) (milliseconds)
 // block velocity profile is traced exactly. The size of this buffer governs how much step
 // execution lead time there is for other Grbl processes have to compute and do their thing
 // before having to come back and refill this buffer, currently at ~50msec of step moves.
+// This is the default for $Stepper/Segments, which sets it at startup. $ST reports the most and
+// fewest segments queued, and any underruns, to tune the two settings for a machine.
 // #define SEGMENT_BUFFER_SIZE 6 // Uncomment to override default in stepper.h.
 
 // Line buffer size from the serial input stream to be executed. Also, governs the size of
@@ -480,7 +533,7 @@ const int DWELL_TIME_STEP = 50;  // Integer (1-255) (milliseconds)
 // 115200 baud will take 5 msec to transmit a typical 55 character report. Worst case reports are
 // around 90-100 characters. As long as the serial TX buffer doesn't get continually maxed, Grbl
 // will continue operating efficiently. Size the TX buffer around the size of a worst-case report.
-// #define RX_BUFFER_SIZE 128 // (1-254) Uncomment to override defaults in serial.h
+// #define RX_BUFFER_SIZE 1024 // (more than 128) UART driver receive buffer. Uncomment to override defaults in serial.h
 // #define TX_BUFFER_SIZE 100 // (1-254)
 
 // A simple software debouncing feature for hard limit switches. When enabled, the limit
@@ -90,6 +90,22 @@
 #    define DEFAULT_ARC_TOLERANCE 0.002  // $12 mm
 #endif
 
+#ifndef DEFAULT_PLANNER_BLOCKS
+#    define DEFAULT_PLANNER_BLOCKS BLOCK_BUFFER_SIZE  // $Planner/Blocks, applied at startup
+#endif
+
+#ifndef DEFAULT_STEPPER_SEGMENTS
+#    define DEFAULT_STEPPER_SEGMENTS SEGMENT_BUFFER_SIZE  // $Stepper/Segments, applied at startup
+#endif
+
+#ifndef DEFAULT_STEPPER_SEGMENT_RATE
+#    define DEFAULT_STEPPER_SEGMENT_RATE ACCELERATION_TICKS_PER_SECOND  // $Stepper/SegmentRate Hz, applied at startup
+#endif
+
+#ifndef DEFAULT_PLANNER_MERGE_TOLERANCE
+#    define DEFAULT_PLANNER_MERGE_TOLERANCE 0.0  // $Planner/MergeTolerance mm. Zero disables merging.
+#endif
+
 #ifndef DEFAULT_REPORT_INCHES
 #    define DEFAULT_REPORT_INCHES 0  // $13 false
 #endif
@@ -320,6 +336,27 @@
 #    define DEFAULT_C_ACCELERATION 200.0
 #endif
 
+#define SEC_PER_MIN_CU (60.0 * 60.0 * 60.0)  // Seconds Per Minute Cubed, for jerk conversion
+// Default jerks are expressed in mm/sec^3. Zero gives constant-acceleration ramps.
+#ifndef DEFAULT_X_JERK
+#    define DEFAULT_X_JERK 0.0
+#endif
+#ifndef DEFAULT_Y_JERK
+#    define DEFAULT_Y_JERK 0.0
+#endif
+#ifndef DEFAULT_Z_JERK
+#    define DEFAULT_Z_JERK 0.0
+#endif
+#ifndef DEFAULT_A_JERK
+#    define DEFAULT_A_JERK 0.0
+#endif
+#ifndef DEFAULT_B_JERK
+#    define DEFAULT_B_JERK 0.0
+#endif
+#ifndef DEFAULT_C_JERK
+#    define DEFAULT_C_JERK 0.0
+#endif
+
 // ========= AXIS MAX TRAVEL ============
 
 #ifndef DEFAULT_X_MAX_TRAVEL
@@ -85,6 +85,8 @@ enum class Error : uint8_t {
     Eol                         = 111,
     AnotherInterfaceBusy        = 120,
     JogCancelled                = 130,
+    FrameCorrupt                = 140,
+    FrameInvalid                = 141,
 };
 
 extern std::map<Error, const char*> ErrorNames;
@@ -0,0 +1,325 @@
+/*
+  Frames.cpp - Binary motion frames
+  Part of Grbl_ESP32
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Grbl.h"
+
+#ifdef ENABLE_BINARY_FRAMES
+
+const int FRAME_HEADER_SIZE = 2;  // Length and type
+const int FRAME_CRC_SIZE    = 2;
+const int FRAME_MAX_SIZE    = (LINE_BUFFER_SIZE - 2) / 4 * 3;
+const int MOVE_FIXED_SIZE   = 12;  // Line, feed and spindle of a move
+
+static_assert(FRAME_MAX_SIZE <= RASTER_BUFFER_SIZE / 2, "RASTER_BUFFER_SIZE must hold two rasters of the largest frame");
+
+static const char base64_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static int base64_value(char c) {
+    if (c >= 'A' && c <= 'Z') {
+        return c - 'A';
+    }
+    if (c >= 'a' && c <= 'z') {
+        return c - 'a' + 26;
+    }
+    if (c >= '0' && c <= '9') {
+        return c - '0' + 52;
+    }
+    if (c == '+') {
+        return 62;
+    }
+    if (c == '/') {
+        return 63;
+    }
+    return -1;
+}
+
+// Decodes base64 text, padded or not, into data. Returns the number of bytes, or -1 if the text is
+// not base64 or does not fit.
+static int base64_decode(const char* text, uint8_t* data, int size) {
+    int      len  = 0;
+    uint32_t bits = 0;
+    int      n    = 0;
+    for (; *text && *text != '='; text++) {
+        int value = base64_value(*text);
+        if (value < 0) {
+            return -1;
+        }
+        bits = (bits << 6) | value;
+        if (++n == 4) {
+            if (len + 3 > size) {
+                return -1;
+            }
+            data[len++] = bits >> 16;
+            data[len++] = bits >> 8;
+            data[len++] = bits;
+            n           = 0;
+        }
+    }
+    if (n == 1 || len + n - 1 > size) {
+        return -1;
+    }
+    if (n >= 2) {
+        data[len++] = bits >> (6 * n - 8);
+    }
+    if (n == 3) {
+        data[len++] = bits >> 2;
+    }
+    return len;
+}
+
+static void base64_encode(const uint8_t* data, int len, char* text) {
+    for (int i = 0; i < len; i += 3) {
+        uint32_t bits = data[i] << 16;
+        if (i + 1 < len) {
+            bits |= data[i + 1] << 8;
+        }
+        if (i + 2 < len) {
+            bits |= data[i + 2];
+        }
+        *text++ = base64_chars[(bits >> 18) & 0x3f];
+        *text++ = base64_chars[(bits >> 12) & 0x3f];
+        *text++ = i + 1 < len ? base64_chars[(bits >> 6) & 0x3f] : '=';
+        *text++ = i + 2 < len ? base64_chars[bits & 0x3f] : '=';
+    }
+    *text = '\0';
+}
+
+// CRC-16/CCITT, four bits at a time.
+static const uint16_t crc_table[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7, 0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef
+};
+
+static uint16_t frame_crc(const uint8_t* data, int len) {
+    uint16_t crc = 0xffff;
+    while (len--) {
+        crc = (crc << 4) ^ crc_table[(crc >> 12) ^ (*data >> 4)];
+        crc = (crc << 4) ^ crc_table[(crc >> 12) ^ (*data++ & 0xf)];
+    }
+    return crc;
+}
+
+// Appends the CRC to a frame of the given type and payload length, and sends it as a line.
+static void frame_send(uint8_t client, FrameType type, uint8_t* frame, int payload_len) {
+    frame[0]     = payload_len;
+    frame[1]     = uint8_t(type);
+    int      len = FRAME_HEADER_SIZE + payload_len;
+    uint16_t crc = frame_crc(frame, len);
+    frame[len++] = crc;
+    frame[len++] = crc >> 8;
+
+    char text[(FRAME_MAX_SIZE + 2) / 3 * 4 + 4];
+    text[0] = FRAME_START;
+    base64_encode(frame, len, &text[1]);
+    strcat(text, "\r\n");
+    grbl_send(client, text);
+}
+
+static void frame_ack(uint8_t client, Error status, int moves, uint32_t line_number) {
+    uint8_t frame[FRAME_HEADER_SIZE + 6 + FRAME_CRC_SIZE];
+    frame[2] = uint8_t(status);
+    frame[3] = moves;
+    memcpy(&frame[4], &line_number, sizeof(line_number));
+    frame_send(client, FrameType::Ack, frame, 6);
+}
+
+static void frame_status(uint8_t client) {
+    auto     n_axis = number_axis->get();
+    uint8_t  frame[FRAME_HEADER_SIZE + 10 + MAX_N_AXIS * sizeof(float) + FRAME_CRC_SIZE];
+    uint8_t* payload     = &frame[FRAME_HEADER_SIZE];
+    uint16_t blocks      = plan_get_block_buffer_available();
+    uint16_t rx          = client_get_rx_buffer_available(CLIENT_SERIAL);
+    uint32_t line_number = 0;
+#    ifdef USE_LINE_NUMBERS
+    plan_block_t* cur_block = plan_get_current_block();
+    if (cur_block != NULL) {
+        line_number = cur_block->line_number;
+    }
+#    endif
+    payload[0] = uint8_t(sys.state);
+    memcpy(&payload[1], &blocks, sizeof(blocks));
+    memcpy(&payload[3], &rx, sizeof(rx));
+    memcpy(&payload[5], &line_number, sizeof(line_number));
+    payload[9] = n_axis;
+    memcpy(&payload[10], system_get_mpos(), n_axis * sizeof(float));
+    frame_send(client, FrameType::Status, frame, 10 + n_axis * sizeof(float));
+}
+
+// Runs one move as the g-code parser would run G0 or G1 with axis words. A raster is a G1 that
+// goes to the planner as a single line.
+static Error frame_move(uint32_t line_number, float feed, float speed, float* target, plan_raster_t* raster) {
+    for (int idx = 0; idx < MAX_N_AXIS; idx++) {
+        if (!std::isfinite(target[idx])) {
+            return Error::BadNumberFormat;
+        }
+    }
+    if (!std::isfinite(feed) || !std::isfinite(speed)) {
+        return Error::BadNumberFormat;
+    }
+    if (feed < 0 || speed < 0) {
+        return Error::NegativeValue;
+    }
+    bool rapid = feed == 0;
+    if (rapid && raster != NULL) {
+        return Error::FrameInvalid;
+    }
+
+    plan_line_data_t  plan_data;
+    plan_line_data_t* pl_data = &plan_data;
+    memset(pl_data, 0, sizeof(plan_line_data_t));  // Zero pl_data struct
+
+    gc_state.line_number = line_number;
+#    ifdef USE_LINE_NUMBERS
+    pl_data->line_number = line_number;
+#    endif
+    if (!rapid) {
+        gc_state.feed_rate = feed;
+        pl_data->feed_rate = feed;
+    }
+    if (gc_state.spindle_speed != speed) {
+        // A laser follows the speed of each block, so only a spindle waits for the moves before it.
+        if (!spindle->inLaserMode() && gc_state.modal.spindle != SpindleState::Disable) {
+            spindle->sync(gc_state.modal.spindle, (uint32_t)speed);
+        }
+        gc_state.spindle_speed = speed;
+    }
+    // NOTE: Pass zero spindle speed for laser rapids.
+    if (!(rapid && spindle->inLaserMode())) {
+        pl_data->spindle_speed = gc_state.spindle_speed;
+    }
+    pl_data->spindle = gc_state.modal.spindle;
+    pl_data->coolant = gc_state.modal.coolant;
+    if (gc_state.modal.control == ControlMode::ExactStop) {
+        pl_data->motion.exactStop = 1;
+    }
+    pl_data->raster = raster;
+
+    if (raster != NULL) {
+        gc_state.modal.motion = Motion::Linear;
+        mc_blend_flush();  // A line held for G64 goes first.
+        mc_line(target, pl_data);
+    } else if (rapid) {
+        gc_state.modal.motion       = Motion::Seek;
+        pl_data->motion.rapidMotion = 1;
+        cartesian_to_motors(target, pl_data, gc_state.position);
+    } else {
+        gc_state.modal.motion = Motion::Linear;
+        if (gc_state.modal.control == ControlMode::Continuous) {
+            mc_blend_line(target, pl_data, gc_state.position, gc_state.blend_tolerance);
+        } else {
+            cartesian_to_motors(target, pl_data, gc_state.position);
+        }
+    }
+    memcpy(gc_state.position, target, sizeof(gc_state.position));
+    return Error::Ok;
+}
+
+// Reads the line number, feed, spindle speed and target of a move record.
+static void frame_read_move(uint8_t* move, uint32_t* number, float* feed, float* speed, float* target) {
+    memcpy(number, &move[0], sizeof(*number));
+    memcpy(feed, &move[4], sizeof(*feed));
+    memcpy(speed, &move[8], sizeof(*speed));
+    memcpy(target, gc_state.position, sizeof(gc_state.position));
+    memcpy(target, &move[MOVE_FIXED_SIZE], number_axis->get() * sizeof(float));
+}
+
+static Error frame_motion(uint8_t* payload, int len, int* moves, uint32_t* line_number) {
+    auto n_axis = number_axis->get();
+    if (len < 1 || payload[0] != n_axis) {
+        return Error::FrameInvalid;
+    }
+    int move_size = MOVE_FIXED_SIZE + n_axis * sizeof(float);
+    if ((len - 1) % move_size) {
+        return Error::FrameInvalid;
+    }
+    // Block if in alarm or jog mode, as for g-code.
+    if (sys.state == State::Alarm || sys.state == State::Jog) {
+        return Error::SystemGcLock;
+    }
+    for (uint8_t* move = &payload[1]; move < &payload[len]; move += move_size) {
+        uint32_t number;
+        float    feed, speed;
+        float    target[MAX_N_AXIS];
+        frame_read_move(move, &number, &feed, &speed, target);
+        Error status = frame_move(number, feed, speed, target, NULL);
+        if (status != Error::Ok) {
+            return status;
+        }
+        if (sys.abort) {
+            return Error::Ok;  // The reset reports itself. Nothing more is taken.
+        }
+        ++*moves;
+        *line_number = number;
+    }
+    return Error::Ok;
+}
+
+static Error frame_raster(uint8_t* payload, int len, int* moves, uint32_t* line_number) {
+#    if defined(USE_KINEMATICS) || defined(CUSTOM_CODE_FILENAME)
+    return Error::FrameInvalid;  // The pixels must lie along a straight line of the motors.
+#    else
+    auto n_axis    = number_axis->get();
+    int  move_size = MOVE_FIXED_SIZE + n_axis * sizeof(float);
+    if (len <= 1 + move_size || payload[0] != n_axis) {
+        return Error::FrameInvalid;
+    }
+    if (sys.state == State::Alarm || sys.state == State::Jog) {
+        return Error::SystemGcLock;
+    }
+    uint32_t      number;
+    float         feed, speed;
+    float         target[MAX_N_AXIS];
+    plan_raster_t raster;
+    frame_read_move(&payload[1], &number, &feed, &speed, target);
+    raster.power = &payload[1 + move_size];
+    raster.count = len - 1 - move_size;
+    Error status = frame_move(number, feed, speed, target, &raster);
+    if (status == Error::Ok && !sys.abort) {
+        *moves       = 1;
+        *line_number = number;
+    }
+    return status;
+#    endif
+}
+
+void frame_execute_line(char* line, uint8_t client) {
+    uint8_t  frame[FRAME_MAX_SIZE];
+    int      len         = base64_decode(&line[1], frame, sizeof(frame));
+    int      moves       = 0;
+    uint32_t line_number = 0;
+    Error    status;
+    if (len < FRAME_HEADER_SIZE + FRAME_CRC_SIZE || len != FRAME_HEADER_SIZE + frame[0] + FRAME_CRC_SIZE ||
+        frame_crc(frame, len - FRAME_CRC_SIZE) != (frame[len - 2] | frame[len - 1] << 8)) {
+        status = Error::FrameCorrupt;
+    } else {
+        switch (FrameType(frame[1])) {
+            case FrameType::Motion:
+                status = frame_motion(&frame[FRAME_HEADER_SIZE], frame[0], &moves, &line_number);
+                break;
+            case FrameType::Raster:
+                status = frame_raster(&frame[FRAME_HEADER_SIZE], frame[0], &moves, &line_number);
+                break;
+            case FrameType::Status:
+                frame_status(client);
+                return;
+            default:
+                status = Error::FrameInvalid;
+                break;
+        }
+    }
+    frame_ack(client, status, moves, line_number);
+}
+
+#endif
@@ -0,0 +1,84 @@
+#pragma once
+
+/*
+  Frames.h - Header for binary motion frames
+  Part of Grbl_ESP32
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/* A compact alternative to g-code for streaming many short moves. The host sends moves it has
+   already parsed and checked as binary records, which go straight to motion control without the
+   g-code parser.
+
+   A frame travels as one line: FRAME_START, then the frame in base64, then '\n'. Base64 keeps the
+   frame clear of the realtime command characters and of the line ends, so frames can be mixed with
+   g-code lines and realtime commands on any client. Decoded, a frame is
+
+     length   uint8    Bytes in the payload
+     type     uint8    FrameType
+     payload  length bytes
+     crc      uint16   CRC-16/CCITT (polynomial 0x1021, initial value 0xffff) of the bytes above
+
+   All values are little-endian. A line holds at most 189 frame bytes.
+
+   FrameType::Motion carries one or more moves. Its payload is the number of axes in each target,
+   which must be the number of axes of the machine, then the records:
+
+     line     uint32   Line number, reported while the move runs
+     feed     float    mm/min. Zero for a rapid move.
+     spindle  float    Spindle speed or laser power, as the S word
+     target   float[]  Machine coordinates in mm, one for each axis
+
+   Each move runs as G0 or G1 would in the current g-code state, with the current spindle direction
+   and coolant, blended when G64 is active, and checked against the soft limits. The feed is always
+   per minute and the target is not offset. The parser state follows the moves, so g-code lines can
+   come after them.
+
+   FrameType::Raster carries one laser raster move: the number of axes and a single move record as
+   above, then the power of each pixel:
+
+     power    uint8[]  One byte for each pixel, 255 being the full spindle speed of the move
+
+   The move is cut into as many pixels of equal length as there are power bytes, and the laser
+   power changes as the move crosses from one pixel to the next, so a whole scanline is one planner
+   block. The laser is off after the last pixel. The feed must not be zero. Machines with kinematics
+   answer FrameInvalid, as the pixels must lie along a straight line of the motors.
+
+   Grbl answers a frame with a FrameType::Ack frame instead of "ok" or "error:", so a host can
+   count characters as it does with g-code. Its payload is
+
+     status   uint8    An Error code. Zero if every move was accepted.
+     moves    uint8    How many moves were accepted. Those after a failed one are dropped.
+     line     uint32   Line number of the last move accepted, or zero
+
+   FrameType::Status asks for a status frame, in turn with the lines before it. The answer is
+
+     state    uint8    State
+     blocks   uint16   Free planner blocks
+     rx       uint16   Free bytes in the serial receive buffer
+     line     uint32   Line number of the move running, or zero
+     axes     uint8    Number of axes
+     mpos     float[]  Machine position in mm
+*/
+
+const char FRAME_START = ':';
+
+enum class FrameType : uint8_t {
+    Motion = 'M',
+    Raster = 'R',
+    Status = 'S',
+    Ack    = 'A',
+};
+
+// Executes the frame in a line that starts with FRAME_START, and answers it with a frame.
+void frame_execute_line(char* line, uint8_t client);
@@ -165,7 +165,8 @@ Error gc_execute_line(char* line, uint8_t client) {
        STEP 2: Import all g-code words in the block line. A g-code word is a letter followed by
        a number, which can either be a 'G'/'M' command or sets/assigns a command value. Also,
        perform initial error-checks for command word modal group violations, for any repeated
-       words, and for negative values set for the value words F, N, P, T, and S. */
+       words, and for negative values set for the value words F, N, T, and S. P is checked in
+       STEP 3, since it may be negative for G5. */
     ModalGroup mg_word_bit;  // Bit-value for assigning tracking variables
     uint32_t   bitmask = 0;
     uint8_t    char_counter;
@@ -276,6 +277,11 @@ Error gc_execute_line(char* line, uint8_t client) {
                         gc_block.modal.motion = Motion::CcwArc;
                         mg_word_bit           = ModalGroup::MG1;
                         break;
+                    case 5:  // G5 - cubic spline
+                        axis_command          = AxisCommand::MotionMode;
+                        gc_block.modal.motion = Motion::CubicSpline;
+                        mg_word_bit           = ModalGroup::MG1;
+                        break;
                     case 38:  // G38 - probe
                         //only allow G38 "Probe" commands if a probe pin is defined.
                         if (PROBE_PIN == UNDEFINED_PIN) {
@@ -426,12 +432,20 @@ Error gc_execute_line(char* line, uint8_t client) {
                         break;
                         // NOTE: G59.x are not supported.
                     case 61:
-                        if (mantissa != 0) {
-                            FAIL(Error::GcodeUnsupportedCommand);  // [G61.1 not supported]
+                        if (mantissa == 0) {
+                            gc_block.modal.control = ControlMode::ExactPath;  // G61
+                        } else if (mantissa == 10) {
+                            gc_block.modal.control = ControlMode::ExactStop;  // G61.1
+                        } else {
+                            FAIL(Error::GcodeUnsupportedCommand);  // [Unsupported G61.x command]
                         }
-                        // gc_block.modal.control = ControlMode::ExactPath; // G61
+                        mantissa    = 0;  // Set to zero to indicate valid non-integer G command.
                         mg_word_bit = ModalGroup::MG13;
                         break;
+                    case 64:
+                        gc_block.modal.control = ControlMode::Continuous;
+                        mg_word_bit            = ModalGroup::MG13;
+                        break;
                     default:
                         FAIL(Error::GcodeUnsupportedCommand);  // [Unsupported G command]
                 }
@@ -687,9 +701,9 @@ Error gc_execute_line(char* line, uint8_t client) {
                 if (bit_istrue(value_words, bitmask)) {
                     FAIL(Error::GcodeWordRepeated);  // [Word repeated]
                 }
-                // Check for invalid negative values for words F, N, P, T, and S.
+                // Check for invalid negative values for words F, N, T, and S.
                 // NOTE: Negative value check is done here simply for code-efficiency.
-                if (bitmask & (bit(GCodeWord::F) | bit(GCodeWord::N) | bit(GCodeWord::P) | bit(GCodeWord::T) | bit(GCodeWord::S))) {
+                if (bitmask & (bit(GCodeWord::F) | bit(GCodeWord::N) | bit(GCodeWord::T) | bit(GCodeWord::S))) {
                     if (value < 0.0) {
                         FAIL(Error::NegativeValue);  // [Word value cannot be negative]
                     }
@@ -730,6 +744,13 @@ Error gc_execute_line(char* line, uint8_t client) {
             axis_command = AxisCommand::MotionMode;  // Assign implicit motion-mode
         }
     }
+    // P may only be negative as the offset of a G5 control point, and then not with a G64 P.
+    if (bit_istrue(value_words, bit(GCodeWord::P)) && gc_block.values.p < 0.0) {
+        if (axis_command != AxisCommand::MotionMode || gc_block.modal.motion != Motion::CubicSpline ||
+            bit_istrue(command_words, bit(ModalGroup::MG13))) {
+            FAIL(Error::NegativeValue);  // [Word value cannot be negative]
+        }
+    }
     // Check for valid line number N value.
     if (bit_istrue(value_words, bit(GCodeWord::N))) {
         // Line number value cannot be less than zero (done) or greater than max line number.
@@ -894,7 +915,18 @@ Error gc_execute_line(char* line, uint8_t client) {
             coords[gc_block.modal.coord_select]->get(block_coord_system);
         }
     }
-    // [16. Set path control mode ]: N/A. Only G61. G61.1 and G64 NOT SUPPORTED.
+    // [16. Set path control mode ]: G64 P value is a tolerance in the current units. G64 without P blends
+    // within the junction deviation.
+    float blend_tolerance = 0.0;
+    if (bit_istrue(command_words, bit(ModalGroup::MG13)) && gc_block.modal.control == ControlMode::Continuous) {
+        if (bit_istrue(value_words, bit(GCodeWord::P))) {
+            blend_tolerance = gc_block.values.p;
+            if (gc_block.modal.units == Units::Inches) {
+                blend_tolerance *= MM_PER_INCH;
+            }
+            bit_false(value_words, bit(GCodeWord::P));
+        }
+    }
     // [17. Set distance mode ]: N/A. Only G91.1. G90.1 NOT SUPPORTED.
     // [18. Set retract mode ]: NOT SUPPORTED.
     // [19. Remaining non-modal actions ]: Check go to predefined position, set G10, or set axis offsets.
@@ -1222,6 +1254,37 @@ Error gc_execute_line(char* line, uint8_t client) {
                         }
                     }
                     break;
+                case Motion::CubicSpline:
+                    // [G5 Errors]: Plane other than XY. No axis words. I and J not given together, or omitted
+                    //   without a G5 before to mirror. P and Q missing.
+                    // NOTE: I,J offset the first control point from the current position, and P,Q offset the
+                    //   second from the target. Without I,J, the first is P,Q of the previous G5 mirrored.
+                    if (gc_block.modal.plane_select != Plane::XY) {
+                        FAIL(Error::GcodeUnsupportedCommand);  // [G5 only in the XY plane]
+                    }
+                    if (!axis_words) {
+                        FAIL(Error::GcodeNoAxisWords);  // [No axis words]
+                    }
+                    if (bit_isfalse(value_words, bit(GCodeWord::P)) || bit_isfalse(value_words, bit(GCodeWord::Q))) {
+                        FAIL(Error::GcodeValueWordMissing);  // [P or Q word missing]
+                    }
+                    if (gc_block.modal.units == Units::Inches) {
+                        gc_block.values.p *= MM_PER_INCH;
+                        gc_block.values.q *= MM_PER_INCH;
+                    }
+                    if ((ijk_words & (bit(X_AXIS) | bit(Y_AXIS))) == (bit(X_AXIS) | bit(Y_AXIS))) {
+                        if (gc_block.modal.units == Units::Inches) {
+                            gc_block.values.ijk[X_AXIS] *= MM_PER_INCH;
+                            gc_block.values.ijk[Y_AXIS] *= MM_PER_INCH;
+                        }
+                    } else if (ijk_words == 0 && gc_state.modal.motion == Motion::CubicSpline) {
+                        gc_block.values.ijk[X_AXIS] = -gc_state.spline_control[X_AXIS];
+                        gc_block.values.ijk[Y_AXIS] = -gc_state.spline_control[Y_AXIS];
+                    } else {
+                        FAIL(Error::GcodeNoOffsetsInPlane);  // [I and J missing]
+                    }
+                    bit_false(value_words, (bit(GCodeWord::I) | bit(GCodeWord::J) | bit(GCodeWord::P) | bit(GCodeWord::Q)));
+                    break;
                 case Motion::ProbeTowardNoError:
                 case Motion::ProbeAwayNoError:
                     gc_parser_flags |= GCParserProbeIsNoError;  // No break intentional.
@@ -1271,6 +1334,13 @@ Error gc_execute_line(char* line, uint8_t client) {
     plan_line_data_t  plan_data;
     plan_line_data_t* pl_data = &plan_data;
     memset(pl_data, 0, sizeof(plan_line_data_t));  // Zero pl_data struct
+    // A line held back for G64 blending must reach the planner ahead of any other kind of motion.
+    if (axis_command != AxisCommand::None) {
+        if ((gc_parser_flags & GCParserJogMotion) || gc_block.modal.motion != Motion::Linear ||
+            axis_command != AxisCommand::MotionMode || gc_block.modal.control != ControlMode::Continuous) {
+            mc_blend_flush();
+        }
+    }
     // Intercept jog commands and complete error checking for valid jog commands and execute.
     // NOTE: G-code parser state is not updated, except the position to ensure sequential jog
     // targets are computed correctly. The final parser position after a jog is updated in
@@ -1299,7 +1369,7 @@ Error gc_execute_line(char* line, uint8_t client) {
     // If in laser mode, setup laser power based on current and past parser conditions.
     if (spindle->inLaserMode()) {
         if (!((gc_block.modal.motion == Motion::Linear) || (gc_block.modal.motion == Motion::CwArc) ||
-              (gc_block.modal.motion == Motion::CcwArc))) {
+              (gc_block.modal.motion == Motion::CcwArc) || (gc_block.modal.motion == Motion::CubicSpline))) {
             gc_parser_flags |= GCParserLaserDisable;
         }
         // Any motion mode with axis words is allowed to be passed from a spindle speed update.
@@ -1312,7 +1382,7 @@ Error gc_execute_line(char* line, uint8_t client) {
             // a G1/2/3 motion mode state and vice versa when there is no motion in the line.
             if (gc_state.modal.spindle == SpindleState::Cw) {
                 if ((gc_state.modal.motion == Motion::Linear) || (gc_state.modal.motion == Motion::CwArc) ||
-                    (gc_state.modal.motion == Motion::CcwArc)) {
+                    (gc_state.modal.motion == Motion::CcwArc) || (gc_state.modal.motion == Motion::CubicSpline)) {
                     if (bit_istrue(gc_parser_flags, GCParserLaserDisable)) {
                         gc_parser_flags |= GCParserLaserForceSync;  // Change from G1/2/3 motion mode.
                     }
@@ -1462,8 +1532,14 @@ Error gc_execute_line(char* line, uint8_t client) {
         memcpy(gc_state.coord_system, block_coord_system, sizeof(gc_state.coord_system));
         system_flag_wco_change();
     }
-    // [16. Set path control mode ]: G61.1/G64 NOT SUPPORTED
-    // gc_state.modal.control = gc_block.modal.control; // NOTE: Always default.
+    // [16. Set path control mode ]:
+    gc_state.modal.control = gc_block.modal.control;
+    if (bit_istrue(command_words, bit(ModalGroup::MG13))) {
+        gc_state.blend_tolerance = blend_tolerance;
+    }
+    if (gc_state.modal.control == ControlMode::ExactStop) {
+        pl_data->motion.exactStop = 1;  // Set exact stop flag for planner use.
+    }
     // [17. Set distance mode ]:
     gc_state.modal.distance = gc_block.modal.distance;
     // [18. Set retract mode ]: NOT SUPPORTED
@@ -1513,7 +1589,11 @@ Error gc_execute_line(char* line, uint8_t client) {
         if (axis_command == AxisCommand::MotionMode) {
             GCUpdatePos gc_update_pos = GCUpdatePos::Target;
             if (gc_state.modal.motion == Motion::Linear) {
-                cartesian_to_motors(gc_block.values.xyz, pl_data, gc_state.position);
+                if (gc_state.modal.control == ControlMode::Continuous) {
+                    mc_blend_line(gc_block.values.xyz, pl_data, gc_state.position, gc_state.blend_tolerance);
+                } else {
+                    cartesian_to_motors(gc_block.values.xyz, pl_data, gc_state.position);
+                }
             } else if (gc_state.modal.motion == Motion::Seek) {
                 pl_data->motion.rapidMotion = 1;  // Set rapid motion flag.
                 cartesian_to_motors(gc_block.values.xyz, pl_data, gc_state.position);
@@ -1527,6 +1607,10 @@ Error gc_execute_line(char* line, uint8_t client) {
                        axis_1,
                        axis_linear,
                        bit_istrue(gc_parser_flags, GCParserArcIsClockwise));
+            } else if (gc_state.modal.motion == Motion::CubicSpline) {
+                float second_control[2] = { gc_block.values.p, gc_block.values.q };
+                mc_spline(gc_block.values.xyz, pl_data, gc_state.position, gc_block.values.ijk, second_control);
+                memcpy(gc_state.spline_control, second_control, sizeof(second_control));
             } else {
                 // NOTE: gc_block.values.xyz is returned from mc_probe_cycle with the updated position value. So
                 // upon a successful probing cycle, the machine position and the returned value should be the same.
@@ -1631,5 +1715,4 @@ Error gc_execute_line(char* line, uint8_t client) {
    group 8 = {M7*} enable mist coolant (* Compile-option)
    group 9 = {M48, M49} enable/disable feed and speed override switches
    group 10 = {G98, G99} return mode canned cycles
-   group 13 = {G61.1, G64} path control mode (G61 is supported)
 */
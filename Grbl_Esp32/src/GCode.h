@@ -42,7 +42,7 @@ enum class ModalGroup : uint8_t {
     MG7  = 7,   // [G40] Cutter radius compensation mode. G41/42 NOT SUPPORTED.
     MG8  = 8,   // [G43.1,G49] Tool length offset
     MG12 = 9,   // [G54,G55,G56,G57,G58,G59] Coordinate system selection
-    MG13 = 10,  // [G61] Control mode
+    MG13 = 10,  // [G61,G61.1,G64] Control mode
     MM4  = 11,  // [M0,M1,M2,M30] Stopping
     MM6  = 14,  // [M6] Tool change
     MM7  = 12,  // [M3,M4,M5] Spindle turning
@@ -79,6 +79,7 @@ enum class Motion : uint8_t {
     Linear             = 1,    // G1 (Do not alter value)
     CwArc              = 2,    // G2 (Do not alter value)
     CcwArc             = 3,    // G3 (Do not alter value)
+    CubicSpline        = 5,    // G5 (Do not alter value)
     ProbeToward        = 140,  // G38.2 (Do not alter value)
     ProbeTowardNoError = 141,  // G38.3 (Do not alter value)
     ProbeAway          = 142,  // G38.4 (Do not alter value)
@@ -134,7 +135,9 @@ enum class CutterCompensation : uint8_t {
 
 // Modal Group G13: Control mode
 enum class ControlMode : uint8_t {
-    ExactPath = 0,  // G61 (Default: Must be zero)
+    ExactPath  = 0,  // G61 (Default: Must be zero)
+    ExactStop  = 1,  // G61.1
+    Continuous = 2,  // G64
 };
 
 // Modal Group M7: Spindle control
@@ -260,7 +263,7 @@ CoordIndex& operator ++ (CoordIndex& i);
 
 // NOTE: When this struct is zeroed, the 0 values in the above types set the system defaults.
 typedef struct {
-    Motion   motion;     // {G0,G1,G2,G3,G38.2,G80}
+    Motion   motion;     // {G0,G1,G2,G3,G5,G38.2,G80}
     FeedRate feed_rate;  // {G93,G94}
     Units    units;      // {G20,G21}
     Distance distance;   // {G90,G91}
@@ -269,13 +272,13 @@ typedef struct {
     // CutterCompensation cutter_comp;  // {G40} NOTE: Don't track. Only default supported.
     ToolLengthOffset tool_length;   // {G43.1,G49}
     CoordIndex       coord_select;  // {G54,G55,G56,G57,G58,G59}
-    // uint8_t control;      // {G61} NOTE: Don't track. Only default supported.
-    ProgramFlow  program_flow;  // {M0,M1,M2,M30}
-    CoolantState coolant;       // {M7,M8,M9}
-    SpindleState spindle;       // {M3,M4,M5}
-    ToolChange   tool_change;   // {M6}
-    IoControl    io_control;    // {M62, M63, M67}
-    Override     override;      // {M56}
+    ControlMode      control;       // {G61,G61.1,G64}
+    ProgramFlow      program_flow;  // {M0,M1,M2,M30}
+    CoolantState     coolant;       // {M7,M8,M9}
+    SpindleState     spindle;       // {M3,M4,M5}
+    ToolChange       tool_change;   // {M6}
+    IoControl        io_control;    // {M62, M63, M67}
+    Override         override;      // {M56}
 } gc_modal_t;
 
 typedef struct {
@@ -284,8 +287,8 @@ typedef struct {
     float   ijk[3];           // I,J,K Axis arc offsets - only 3 are possible
     uint8_t l;                // G10 or canned cycles parameters
     int32_t n;                // Line number
-    float   p;                // G10 or dwell parameters
-    float   q;                // M67
+    float   p;                // G10, dwell or G5 parameters
+    float   q;                // M67 or G5
     float   r;                // Arc radius
     float   s;                // Spindle speed
     uint8_t t;                // Tool selection
@@ -307,6 +310,8 @@ typedef struct {
     float coord_offset[MAX_N_AXIS];  // Retains the G92 coordinate offset (work coordinates) relative to
     // machine zero in mm. Non-persistent. Cleared upon reset and boot.
     float tool_length_offset;  // Tracks tool length offset value when enabled.
+    float blend_tolerance;     // G64 P value in mm. Zero uses the junction deviation instead.
+    float spline_control[2];   // Last G5 P,Q in mm, mirrored by a following G5 without I,J.
 } parser_state_t;
 extern parser_state_t gc_state;
 
@@ -52,8 +52,11 @@ const char* const GRBL_VERSION_BUILD = "20210424";
 #include "MotionControl.h"
 #include "Protocol.h"
 #include "Uart.h"
+#include "LineRing.h"
 #include "Serial.h"
+#include "Frames.h"
 #include "Report.h"
+#include "TxQueue.h"
 #include "Pins.h"
 #include "Spindles/Spindle.h"
 #include "Motors/Motors.h"
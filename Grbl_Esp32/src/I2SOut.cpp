@@ -128,6 +128,7 @@ static int i2s_out_initialized = 0;
 static volatile uint32_t             i2s_out_pulse_period;
 static uint32_t                      i2s_out_remain_time_until_next_pulse;  // Time remaining until the next pulse (μsec)
 static volatile i2s_out_pulse_func_t i2s_out_pulse_func;
+static volatile i2s_out_fill_func_t  i2s_out_fill_func;
 #endif
 
 static uint8_t i2s_out_ws_pin   = 255;
@@ -357,7 +358,32 @@ static int IRAM_ATTR i2s_fillout_dma_buffer(lldesc_t* dma_desc) {
     o_dma.rw_pos  = 0;
     // It reuses the oldest (just transferred) buffer with the name "current"
     // and fills the buffer for later DMA.
-    if (i2s_out_pulser_status == STEPPING) {
+    if (i2s_out_pulser_status == STEPPING && i2s_out_fill_func != NULL) {
+        //
+        // Fillout the whole buffer at once
+        //
+        // The fill function does not split a pulse between buffers either:
+        // it stops short, and the buffer is shortened to what it filled.
+        //
+        I2S_OUT_PULSER_EXIT_CRITICAL();  // Temporarily unlocked status lock as it may be locked in fill callback.
+        o_dma.rw_pos = (*i2s_out_fill_func)(buf, DMA_SAMPLE_COUNT);
+        I2S_OUT_PULSER_ENTER_CRITICAL();  // Lock again.
+        i2s_out_remain_time_until_next_pulse = 0;
+        if (i2s_out_pulser_status == WAITING) {
+            // The stepper went idle. As with the pulse callback, this buffer is the tail of the chain,
+            // and the rest of it holds the port data.
+            dma_desc->qe.stqe_next = NULL;  // Cut the DMA descriptor ring. This allow us to identify the tail of the buffer.
+            uint32_t port_data     = atomic_load(&i2s_out_port_data);
+            while (o_dma.rw_pos < (DMA_SAMPLE_COUNT - SAMPLE_SAFE_COUNT)) {
+                buf[o_dma.rw_pos++] = port_data;
+            }
+        } else if (i2s_out_pulser_status == PASSTHROUGH) {
+            // i2s_out_reset() has called during the execution of the fill function.
+            o_dma.rw_pos = DMA_SAMPLE_COUNT;  // The buffer is full.
+        }
+        // set filled length to the DMA descriptor
+        dma_desc->length = o_dma.rw_pos * I2S_SAMPLE_SIZE;
+    } else if (i2s_out_pulser_status == STEPPING) {
         //
         // Fillout the buffer for pulse
         //
@@ -685,6 +711,17 @@ int IRAM_ATTR i2s_out_set_pulse_callback(i2s_out_pulse_func_t func) {
     return 0;
 }
 
+int IRAM_ATTR i2s_out_set_fill_callback(i2s_out_fill_func_t func) {
+#ifdef USE_I2S_OUT_STREAM_IMPL
+    i2s_out_fill_func = func;
+#endif
+    return 0;
+}
+
+uint32_t IRAM_ATTR i2s_out_get_port_data() {
+    return atomic_load(&i2s_out_port_data);
+}
+
 int IRAM_ATTR i2s_out_reset() {
     I2S_OUT_PULSER_ENTER_CRITICAL();
     i2s_out_stop();
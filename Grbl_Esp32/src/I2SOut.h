@@ -65,6 +65,7 @@ const int I2S_OUT_DELAY_DMABUF_MS = (I2S_OUT_DMABUF_LEN / sizeof(uint32_t) * I2S
 const int I2S_OUT_DELAY_MS        = (I2S_OUT_DELAY_DMABUF_MS * (I2S_OUT_DMABUF_COUNT + 1));
 
 typedef void (*i2s_out_pulse_func_t)(void);
+typedef uint32_t (*i2s_out_fill_func_t)(uint32_t* buf, uint32_t count);
 
 typedef struct {
     /*
@@ -165,6 +166,21 @@ int i2s_out_set_pulse_period(uint32_t usec);
  */
 int i2s_out_set_pulse_callback(i2s_out_pulse_func_t func);
 
+/*
+   Register a callback function to fill a whole DMA buffer with stepping pulse data,
+   in place of calling the pulse callback for each pulse. NULL goes back to the pulse callback.
+   buf: the buffer, of I2S_OUT_USEC_PER_PULSE μs samples
+   count: the number of samples the buffer holds
+   return: number of samples filled. The buffer is shortened to that length, so that
+           a pulse that does not fit can be left to the next buffer.
+ */
+int i2s_out_set_fill_callback(i2s_out_fill_func_t func);
+
+/*
+   Get the internal pin state var, as it is written to the I2S bitstream
+ */
+uint32_t i2s_out_get_port_data();
+
 /*
    Get current pulser mode
  */
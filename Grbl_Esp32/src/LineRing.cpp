@@ -0,0 +1,149 @@
+/*
+  LineRing.cpp - Ring of complete input lines of a client
+  Part of Grbl_ESP32
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Grbl.h"
+
+static_assert(LINE_RING_SIZE > 2 * (LINE_BUFFER_SIZE + 1), "LINE_RING_SIZE must hold two of the longest lines");
+
+LineRing::LineRing() :
+    _head(0), _tail(0), _discard(false), _len(0), _kind(Line), _complete(false), _pending_at(0), _pending_len(0), _release_at(0) {}
+
+// Copies the complete line into the ring. Returns false if there is no room for it yet.
+bool LineRing::commit() {
+    uint16_t size = _len + 2;
+    uint16_t head = _head.load(std::memory_order_relaxed);
+    uint16_t tail = _tail.load(std::memory_order_acquire);
+    uint16_t at   = head;
+    if (tail <= head) {
+        // The free space runs to the end of the ring, then from the start up to the tail. A record
+        // never wraps, and the head must not land on the tail, which would read as empty.
+        if (head + size > LINE_RING_SIZE || (head + size == LINE_RING_SIZE && tail == 0)) {
+            if (size >= tail) {
+                return false;
+            }
+            at = 0;
+        }
+    } else if (head + size >= tail) {
+        return false;
+    }
+    _ring[at] = _kind;
+    memcpy(&_ring[at + 1], _line, _len);
+    _ring[at + 1 + _len] = '\0';
+    if (at != head) {
+        _ring[head] = Wrap;
+    }
+    uint16_t next = at + size;
+    _head.store(next == LINE_RING_SIZE ? 0 : next, std::memory_order_release);
+    _len      = 0;
+    _kind     = Line;
+    _complete = false;
+    return true;
+}
+
+bool LineRing::ready() {
+    if (_discard.load(std::memory_order_acquire)) {
+        _len         = 0;
+        _kind        = Line;
+        _complete    = false;
+        _pending_at  = 0;
+        _pending_len = 0;
+        _discard.store(false, std::memory_order_relaxed);
+    }
+    // Characters held back go in as the consumer makes room for them.
+    while (!_complete || commit()) {
+        if (_pending_at == _pending_len) {
+            _pending_at  = 0;
+            _pending_len = 0;
+            return true;
+        }
+        frame(_pending[_pending_at++]);
+    }
+    if (_pending_at) {
+        _pending_len -= _pending_at;
+        memmove(_pending, &_pending[_pending_at], _pending_len);
+        _pending_at = 0;
+    }
+    return _pending_len < LINE_PENDING_SIZE;
+}
+
+void LineRing::put(char c) {
+    if (!ready()) {
+        return;  // Lost, as when the old character buffer was full
+    }
+    if (_complete) {
+        _pending[_pending_len++] = c;  // The ring is full
+        return;
+    }
+    frame(c);
+}
+
+uint16_t LineRing::room() {
+    if (_complete) {
+        return LINE_PENDING_SIZE - _pending_len;
+    }
+    // The next line needs a record of its own, which does not wrap, so only the larger part of
+    // the free space counts.
+    int head = _head.load(std::memory_order_relaxed);
+    int tail = _tail.load(std::memory_order_acquire);
+    int free = tail > head ? tail - head - 1 : MAX(LINE_RING_SIZE - head - (tail == 0), tail - 1);
+    return MAX(free - 2 - _len, 0) + LINE_PENDING_SIZE;
+}
+
+// Adds a character to the line being framed, and the line to the ring when it is complete.
+void LineRing::frame(char c) {
+    // Simple editing for interactive input
+    if (c == '\b') {
+        // Backspace erases
+        if (_len) {
+            --_len;
+        }
+        return;
+    }
+    if (_len == (LINE_BUFFER_SIZE - 1)) {
+        // The character that does not fit is dropped with the line.
+        _len      = 0;
+        _kind     = Overflow;
+        _complete = true;
+    } else if (c == '\r' || c == '\n') {
+        _complete = true;
+    } else {
+        _line[_len++] = c;
+        return;
+    }
+    commit();
+}
+
+Error LineRing::get(char** line) {
+    uint16_t tail = _tail.load(std::memory_order_relaxed);
+    if (tail == _head.load(std::memory_order_acquire)) {
+        return Error::Ok;
+    }
+    if (_ring[tail] == Wrap) {
+        tail = 0;
+    }
+    *line       = &_ring[tail + 1];
+    _release_at = tail + 2 + strlen(*line);
+    return _ring[tail] == Overflow ? Error::Overflow : Error::Eol;
+}
+
+void LineRing::release() {
+    _tail.store(_release_at == LINE_RING_SIZE ? 0 : _release_at, std::memory_order_release);
+}
+
+void LineRing::reset() {
+    _tail.store(_head.load(std::memory_order_acquire), std::memory_order_release);
+    _discard.store(true, std::memory_order_release);
+}
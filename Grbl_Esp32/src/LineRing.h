@@ -0,0 +1,94 @@
+#pragma once
+
+/*
+  LineRing.h - Header for the ring of complete input lines of a client
+  Part of Grbl_ESP32
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <atomic>
+
+// Holds at least two lines of the longest length, so that the ring can always wrap.
+#ifndef LINE_RING_SIZE
+#    define LINE_RING_SIZE (2 * LINE_BUFFER_SIZE + 4)
+#endif
+
+// Input that arrives while the ring is full. A sender that waits for its lines to be acknowledged
+// never has more than 128 characters in flight, so this holds all it can send, and the realtime
+// characters behind them are still read.
+#ifndef LINE_PENDING_SIZE
+#    define LINE_PENDING_SIZE 128
+#endif
+
+// A ring of complete lines from one client. clientCheckTask() is the only producer: it frames the
+// characters of a client into lines with put(), and the line goes into the ring only when it is
+// complete. The protocol loop is the only consumer: get() hands it a whole line, in place in the
+// ring, until release(). Each side writes only its own index, so neither needs a lock.
+//
+// Lines are edited and limited as Grbl always has: a backspace erases the last character, and a
+// line longer than LINE_BUFFER_SIZE - 1 characters is dropped and returned as Error::Overflow.
+//
+// While the ring is full, put() holds characters back in a small pending buffer, so that the
+// producer can keep reading its source and act on the realtime characters in it.
+class LineRing {
+private:
+    enum Kind : char {
+        Line     = 'L',
+        Overflow = 'O',
+        Wrap     = 'W',  // The next record is at the start of the ring
+    };
+
+    // Each record is a kind, the text of the line and a terminating zero.
+    char                  _ring[LINE_RING_SIZE];
+    std::atomic<uint16_t> _head;  // Written by the producer
+    std::atomic<uint16_t> _tail;  // Written by the consumer
+    std::atomic<bool>     _discard;
+
+    // Producer side. The line being framed, and whether it is complete but waiting for room.
+    char     _line[LINE_BUFFER_SIZE];
+    uint16_t _len;
+    Kind     _kind;
+    bool     _complete;
+
+    // Producer side. Characters held back while the ring is full, from _pending_at to _pending_len.
+    char     _pending[LINE_PENDING_SIZE];
+    uint16_t _pending_at;
+    uint16_t _pending_len;
+
+    // Consumer side. Where the line returned by get() ends.
+    uint16_t _release_at;
+
+    bool commit();
+    void frame(char c);
+
+public:
+    LineRing();
+
+    // Producer. Returns true if put() can take a character. False while a complete line waits
+    // for the consumer to make room for it and the pending buffer is full; the caller should
+    // leave further input where it is.
+    bool ready();
+    void put(char c);
+
+    // Producer. The number of characters put() can take before ready() returns false.
+    uint16_t room();
+
+    // Consumer. Returns Error::Eol with the next line, Error::Overflow for a line that was too long,
+    // or Error::Ok if there is no complete line yet. The line may be edited in place, and stays
+    // valid until release().
+    Error get(char** line);
+    void  release();
+
+    // Consumer. Drops all lines, and the line the producer is framing.
+    void reset();
+};
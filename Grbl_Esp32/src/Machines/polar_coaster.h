@@ -36,7 +36,7 @@
 #define RADIUS_AXIS 0
 #define POLAR_AXIS 1
 
-#define SEGMENT_LENGTH 0.5 // segment length in mm
+#define SEGMENT_LENGTH 0.5 // default $Kinematics/SegmentLength in mm
 
 #define X_STEP_PIN              GPIO_NUM_15
 #define Y_STEP_PIN              GPIO_NUM_2
@@ -31,8 +31,147 @@
 #    define M_PI 3.14159265358979323846
 #endif
 
+// Curves are planned as curves only when the motors move in cartesian space. See NATIVE_CURVES.
+#if defined(NATIVE_CURVES) && !defined(USE_KINEMATICS) && !defined(CUSTOM_CODE_FILENAME)
+#    define PLAN_NATIVE_CURVES
+#endif
+
 SquaringMode ganged_mode = SquaringMode::Dual;
 
+// Wait for room in the planner buffer, and in the raster buffer for a raster, then plan the line.
+// Returns true if the line was planned, or false if it was cancelled while waiting.
+static bool mc_plan_line(float* target, plan_line_data_t* pl_data) {
+    bool submitted_result = false;
+    // store the plan data so it can be cancelled by the protocol system if needed
+    sys_pl_data_inflight = pl_data;
+    // If the buffer is full: good! That means we are well ahead of the robot.
+    // Remain in this loop until there is room in the buffer.
+    do {
+        protocol_execute_realtime();  // Check for any run-time commands
+        if (sys.abort) {
+            sys_pl_data_inflight = NULL;
+            return submitted_result;  // Bail, if system abort.
+        }
+        if (plan_check_full_buffer() || (pl_data->raster != NULL && !plan_check_raster_room(pl_data->raster->count))) {
+            protocol_auto_cycle_start();  // Auto-cycle start when buffer is full.
+        } else {
+            break;
+        }
+    } while (1);
+    // Plan and queue motion into planner buffer
+    // uint8_t plan_status; // Not used in normal operation.
+    if (sys_pl_data_inflight == pl_data) {
+        plan_buffer_line(target, pl_data);
+        submitted_result = true;
+    }
+    sys_pl_data_inflight = NULL;
+    return submitted_result;
+}
+
+// Collinear line merging. CAM output often approximates a straight run or a gentle curve by many
+// short lines, each of which would take a planner block and a planner_recalculate() pass. When
+// $Planner/MergeTolerance is set, consecutive lines with the same planner data are held here and
+// merged into one line, as long as every vertex between them stays within the tolerance of it.
+// The look-ahead then reaches further through the same number of blocks.
+static struct {
+    uint8_t          count;                                // Lines merged into the held line. Zero if none.
+    float            start[MAX_N_AXIS];                    // Where the held line begins
+    float            vertex[MERGE_MAX_LINES][MAX_N_AXIS];  // Where each merged line ends. The last is the target.
+    plan_line_data_t pl_data;
+} merge;
+
+// Lines merge only if the planner would treat them the same. With line numbers enabled, only
+// lines from the same g-code block merge, so the reported line number stays exact. A raster is
+// never held, as its pixels belong to the caller.
+static bool mc_merge_allowed(plan_line_data_t* pl_data) {
+    return !(pl_data->motion.systemMotion || pl_data->motion.inverseTime || pl_data->motion.exactStop || pl_data->is_jog ||
+             pl_data->raster != NULL);
+}
+
+static bool mc_merge_same(plan_line_data_t* a, plan_line_data_t* b) {
+    return a->feed_rate == b->feed_rate && a->spindle_speed == b->spindle_speed && a->spindle == b->spindle &&
+           a->coolant.Mist == b->coolant.Mist && a->coolant.Flood == b->coolant.Flood &&
+           a->motion.rapidMotion == b->motion.rapidMotion && a->motion.noFeedOverride == b->motion.noFeedOverride
+#ifdef USE_LINE_NUMBERS
+           && a->line_number == b->line_number
+#endif
+        ;
+}
+
+// Returns true if the line was merged into the held line, or held to merge with the next one.
+static bool mc_merge_line(float* target, plan_line_data_t* pl_data) {
+    float tolerance = merge_tolerance->get();
+    if (tolerance <= 0.0 || !mc_merge_allowed(pl_data)) {
+        mc_merge_flush();
+        return false;
+    }
+    auto    n_axis = number_axis->get();
+    uint8_t idx;
+    if (merge.count && merge.count < MERGE_MAX_LINES && mc_merge_same(&merge.pl_data, pl_data)) {
+        // The merged line runs from start to target. Each held vertex must project onto it, and lie
+        // within the tolerance of it. The new line must also carry on forward from the last vertex.
+        float* last = merge.vertex[merge.count - 1];
+        float  delta[MAX_N_AXIS];
+        float  delta_sqr = 0.0;
+        float  forward   = 0.0;
+        for (idx = 0; idx < n_axis; idx++) {
+            delta[idx] = target[idx] - merge.start[idx];
+            delta_sqr += delta[idx] * delta[idx];
+            forward += (last[idx] - merge.start[idx]) * (target[idx] - last[idx]);
+        }
+        bool within = forward > 0.0;
+        for (uint8_t i = 0; within && i < merge.count; i++) {
+            float offset[MAX_N_AXIS];
+            float along = 0.0;
+            for (idx = 0; idx < n_axis; idx++) {
+                offset[idx] = merge.vertex[i][idx] - merge.start[idx];
+                along += offset[idx] * delta[idx];
+            }
+            along /= delta_sqr;
+            float deviation_sqr = 0.0;
+            for (idx = 0; idx < n_axis; idx++) {
+                float d = offset[idx] - along * delta[idx];
+                deviation_sqr += d * d;
+            }
+            within = along > 0.0 && along < 1.0 && deviation_sqr <= tolerance * tolerance;
+        }
+        if (within) {
+            memcpy(merge.vertex[merge.count++], target, sizeof(merge.vertex[0]));
+            return true;
+        }
+    }
+    mc_merge_flush();
+    if (sys.abort) {
+        return true;
+    }
+    // Hold this line to start a new merge. It begins where the planner ends.
+    plan_get_planner_mpos(merge.start);
+    memcpy(merge.vertex[0], target, sizeof(merge.vertex[0]));
+    merge.pl_data = *pl_data;
+    merge.count   = 1;
+    return true;
+}
+
+// Plan the held line, if any.
+void mc_merge_flush() {
+    if (merge.count) {
+        uint8_t count = merge.count;
+        merge.count   = 0;
+        mc_plan_line(merge.vertex[count - 1], &merge.pl_data);
+    }
+}
+
+// Drop the held line, if any. Called on reset.
+void mc_merge_reset() {
+    merge.count = 0;
+}
+
+// Send every line held for blending or merging to the planner.
+void mc_flush() {
+    mc_blend_flush();
+    mc_merge_flush();
+}
+
 // Execute linear motion in absolute millimeter coordinates. Feed rate given in millimeters/second
 // unless invert_feed_rate is true. Then the feed_rate means that the motion should be completed in
 // (1 minute)/feed_rate time.
@@ -40,11 +179,8 @@ SquaringMode ganged_mode = SquaringMode::Dual;
 // segments, must pass through this routine before being passed to the planner. The seperation of
 // mc_line and plan_buffer_line is done primarily to place non-planner-type functions from being
 // in the planner and to let backlash compensation or canned cycle integration simple and direct.
-// returns true if line was submitted to planner, or false if intentionally dropped.
+// returns true if line was submitted to planner, or held to be merged, or false if intentionally dropped.
 bool mc_line(float* target, plan_line_data_t* pl_data) {
-    bool submitted_result = false;
-    // store the plan data so it can be cancelled by the protocol system if needed
-    sys_pl_data_inflight = pl_data;
     // If enabled, check for soft limit violations. Placed here all line motions are picked up
     // from everywhere in Grbl.
     if (soft_limits->get()) {
@@ -55,8 +191,7 @@ bool mc_line(float* target, plan_line_data_t* pl_data) {
     }
     // If in check gcode mode, prevent motion by blocking planner. Soft limits still work.
     if (sys.state == State::CheckMode) {
-        sys_pl_data_inflight = NULL;
-        return submitted_result;
+        return false;
     }
     // NOTE: Backlash compensation may be installed here. It will need direction info to track when
     // to insert a backlash line motion(s) before the intended line motion and will require its own
@@ -71,28 +206,10 @@ bool mc_line(float* target, plan_line_data_t* pl_data) {
     // indicates to Grbl what is a backlash compensation motion, so that Grbl executes the move but
     // doesn't update the machine position values. Since the position values used by the g-code
     // parser and planner are separate from the system machine positions, this is doable.
-    // If the buffer is full: good! That means we are well ahead of the robot.
-    // Remain in this loop until there is room in the buffer.
-    do {
-        protocol_execute_realtime();  // Check for any run-time commands
-        if (sys.abort) {
-            sys_pl_data_inflight = NULL;
-            return submitted_result;  // Bail, if system abort.
-        }
-        if (plan_check_full_buffer()) {
-            protocol_auto_cycle_start();  // Auto-cycle start when buffer is full.
-        } else {
-            break;
-        }
-    } while (1);
-    // Plan and queue motion into planner buffer
-    // uint8_t plan_status; // Not used in normal operation.
-    if (sys_pl_data_inflight == pl_data) {
-        plan_buffer_line(target, pl_data);
-        submitted_result = true;
+    if (mc_merge_line(target, pl_data)) {
+        return true;
     }
-    sys_pl_data_inflight = NULL;
-    return submitted_result;
+    return mc_plan_line(target, pl_data);
 }
 
 bool __attribute__((weak)) cartesian_to_motors(float* target, plan_line_data_t* pl_data, float* position) {
@@ -110,11 +227,106 @@ void __attribute__((weak)) motors_to_cartesian(float* cartesian, float* motors,
 }
 
 void __attribute__((weak)) forward_kinematics(float* position) {}
+
+#ifdef PLAN_NATIVE_CURVES
+// Checks a curve against the soft limits at its end and wherever it reaches furthest out: the
+// quadrant points of an arc, or the samples of a spline. The start was checked when it was a target.
+static void mc_curve_soft_check(float* target, float* position, plan_curve_t* curve) {
+    float   millimeters[PLAN_SPLINE_SAMPLES];
+    uint8_t n_points = 0;
+    if (curve->type == PlCurve::Arc) {
+        float start = atan2(-curve->arc.center[1], -curve->arc.center[0]);
+        float sweep = fabs(curve->arc.sweep);
+        for (uint8_t quadrant = 0; quadrant < 4; quadrant++) {
+            float turn = quadrant * M_PI / 2 - start;
+            if (curve->arc.sweep < 0) {
+                turn = -turn;
+            }
+            turn = fmod(turn + 4 * M_PI, 2 * M_PI);
+            if (turn < sweep) {
+                millimeters[n_points++] = curve->length * turn / sweep;
+            }
+        }
+    } else {
+        for (uint8_t i = 1; i < PLAN_SPLINE_SAMPLES; i++) {
+            millimeters[n_points++] = curve->length * curve->spline.length[i] / curve->plane_length;
+        }
+    }
+    auto  n_axis = number_axis->get();
+    float point[MAX_N_AXIS];
+    for (uint8_t i = 0; i < n_points && !sys.abort; i++) {
+        plan_curve_point(curve, millimeters[i], point);
+        for (uint8_t idx = 0; idx < n_axis; idx++) {
+            point[idx] += position[idx];
+        }
+        limits_soft_check(point);
+    }
+    if (!sys.abort) {
+        limits_soft_check(target);
+    }
+}
+#endif
+
+// Plans a curve from position to target. On a machine whose motors move in cartesian space, the
+// curve is a single planner block. Otherwise, it is split into chords within the arc tolerance.
+static void mc_curve(float* target, plan_line_data_t* pl_data, float* position, plan_curve_t* curve) {
+    plan_curve_measure(curve);
+    if (curve->plane_length == 0.0) {
+        cartesian_to_motors(target, pl_data, position);  // No curve. A line, if anything.
+        return;
+    }
+#ifdef PLAN_NATIVE_CURVES
+    if (soft_limits->get()) {
+        mc_curve_soft_check(target, position, curve);
+    }
+    // If in check gcode mode, prevent motion by blocking planner. Soft limits still work.
+    if (sys.state == State::CheckMode) {
+        return;
+    }
+    mc_merge_flush();  // Lines held for merging come first.
+    if (sys.abort) {
+        return;
+    }
+    pl_data->curve = curve;
+    mc_plan_line(target, pl_data);
+    pl_data->curve = NULL;
+#else
+    float    tolerance = arc_tolerance->get();
+    float    chord     = curve->radius > tolerance ? 2 * sqrt(tolerance * (2 * curve->radius - tolerance)) : 2 * curve->radius;
+    uint16_t segments  = ceil(curve->plane_length / chord);
+    if (pl_data->motion.inverseTime) {
+        pl_data->feed_rate *= segments;
+        pl_data->motion.inverseTime = 0;  // Force as feed absolute mode over the chords.
+    }
+    auto  n_axis = number_axis->get();
+    float previous_position[MAX_N_AXIS];
+    float point[MAX_N_AXIS];
+    float original_feedrate = pl_data->feed_rate;  // Kinematics may alter the feedrate, so save an original copy
+    memcpy(previous_position, position, sizeof(previous_position));
+    for (uint16_t i = 1; i < segments; i++) {
+        plan_curve_point(curve, curve->length * i / segments, point);
+        for (uint8_t idx = 0; idx < n_axis; idx++) {
+            point[idx] += position[idx];
+        }
+        pl_data->feed_rate = original_feedrate;  // This restores the feedrate kinematics may have altered
+        cartesian_to_motors(point, pl_data, previous_position);
+        memcpy(previous_position, point, sizeof(previous_position));
+        // Bail mid-curve on system abort. Runtime command check already performed by mc_line.
+        if (sys.abort) {
+            return;
+        }
+    }
+    pl_data->feed_rate = original_feedrate;
+    cartesian_to_motors(target, pl_data, previous_position);
+#endif
+}
+
 // Execute an arc in offset mode format. position == current xyz, target == target xyz,
 // offset == offset from current xyz, axis_X defines circle plane in tool space, axis_linear is
 // the direction of helical travel, radius == circle radius, isclockwise boolean. Used
 // for vector transformation direction.
-// The arc is approximated by generating a huge number of tiny, linear segments. The chordal tolerance
+// Where the motors move in cartesian space, the arc is planned as one curved block. Otherwise,
+// it is approximated by generating a huge number of tiny, linear segments. The chordal tolerance
 // of each segment is configured in the arc_tolerance setting, which is defined to be the maximum normal
 // distance from segment to the circle when the end points both lie on the circle.
 void mc_arc(float*            target,
@@ -133,13 +345,8 @@ void mc_arc(float*            target,
     float rt_axis0     = target[axis_0] - center_axis0;
     float rt_axis1     = target[axis_1] - center_axis1;
 
-    float previous_position[MAX_N_AXIS] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
-
     uint16_t n;
     auto     n_axis = number_axis->get();
-    for (n = 0; n < n_axis; n++) {
-        previous_position[n] = position[n];
-    }
     // CCW angle between position and target from circle center. Only one atan2() trig computation required.
     float angular_travel = atan2(r_axis0 * rt_axis1 - r_axis1 * rt_axis0, r_axis0 * rt_axis0 + r_axis1 * rt_axis1);
     if (is_clockwise_arc) {  // Correct atan2 output per direction
@@ -151,11 +358,67 @@ void mc_arc(float*            target,
             angular_travel += 2 * M_PI;
         }
     }
-    // NOTE: Segment end points are on the arc, which can lead to the arc diameter being smaller by up to
-    // (2x) arc_tolerance. For 99% of users, this is just fine. If a different arc segment fit
+#ifdef PLAN_NATIVE_CURVES
+    // The planner and segment prep follow the arc itself. See mc_curve().
+    plan_curve_t curve;
+    curve.type          = PlCurve::Arc;
+    curve.axis_0        = axis_0;
+    curve.axis_1        = axis_1;
+    curve.arc.center[0] = offset[axis_0];
+    curve.arc.center[1] = offset[axis_1];
+    curve.arc.sweep     = angular_travel;
+    for (n = 0; n < n_axis; n++) {
+        curve.delta[n] = (n == axis_0 || n == axis_1) ? 0.0 : target[n] - position[n];
+    }
+    mc_curve(target, pl_data, position, &curve);
+#else
+    float previous_position[MAX_N_AXIS] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+    for (n = 0; n < n_axis; n++) {
+        previous_position[n] = position[n];
+    }
+    // NOTE: Segment end points are on the arc, unless the chords are lengthened below, which can lead to
+    // the arc diameter being smaller by up to (2x) arc_tolerance. For 99% of users, this is just fine. If a different arc segment fit
     // is desired, i.e. least-squares, midpoint on arc, just change the mm_per_arc_segment calculation.
+    float tolerance          = arc_tolerance->get();
+    float mm_per_arc_segment = 2 * sqrt(tolerance * (2 * radius - tolerance));
+    // A chord shorter than the machine travels in one step segment only costs planner blocks and
+    // look-ahead distance, because the stepper cannot change speed within a segment anyway. The
+    // machine takes the arc at no more than the feed rate, or the speed at which centripetal
+    // acceleration reaches the plane's acceleration limit, so small arcs are slow and want few
+    // chords. Chords are lengthened towards one segment's travel at that speed, as long as the
+    // planner's junction speed at each vertex stays above it. The arc tolerance still bounds the
+    // chord error: a longer chord crosses the arc, with the vertices between chords moved out by
+    // the tolerance, which keeps every chord within it on both sides up to a sagitta of 1.25 times
+    // the tolerance. The first and last chords, which start on the arc, set that limit.
     // For the intended uses of Grbl, this value shouldn't exceed 2000 for the strictest of cases.
-    uint16_t segments = floor(fabs(0.5 * angular_travel * radius) / sqrt(arc_tolerance->get() * (2 * radius - arc_tolerance->get())));
+    float    travel        = fabs(angular_travel * radius);
+    uint16_t segments      = 0;
+    float    vertex_offset = 0.0;
+    if (mm_per_arc_segment > 0.0) {
+        segments = floor(travel / mm_per_arc_segment);
+    }
+    float deviation = junction_deviation->get();
+    if (segments > 1 && !pl_data->motion.inverseTime && deviation > 0.0 && 4 * tolerance <= radius) {
+        float accel     = MIN(axis_settings[axis_0]->acceleration->get(), axis_settings[axis_1]->acceleration->get()) * SEC_PER_MIN_SQ;
+        float arc_speed = MIN(pl_data->feed_rate, sqrt(accel * radius));  // mm/min
+        // Largest angle between chords at which the junction speed is arc_speed, by the small angle
+        // form of the planner's junction radius, deviation * (8 / angle^2 - 1).
+        float max_angle    = sqrt(8 * deviation / (arc_speed * arc_speed / accel + deviation));
+        float sagitta      = 1.25 * tolerance;
+        float mm_per_chord = MIN(arc_speed * segment_time, radius * max_angle);
+        mm_per_chord       = MIN(mm_per_chord, 2 * sqrt(sagitta * (2 * radius - sagitta)));
+        // Lengthened chords round up, so that none is longer than the tolerance allows, and are only
+        // used when that still takes fewer of them.
+        uint16_t chords = ceil(travel / mm_per_chord);
+        if (chords < segments) {
+            segments      = chords;
+            vertex_offset = tolerance;
+        }
+    }
+    // Chords that came out short enough to stay within the tolerance keep their vertices on the arc.
+    if (segments && radius * (1 - cos(0.5 * angular_travel / segments)) <= tolerance) {
+        vertex_offset = 0.0;
+    }
     if (segments) {
         // Multiply inverse feed_rate to compensate for the fact that this movement is approximated
         // by a number of discrete segments. The inverse feed_rate should be correct for the sum of
@@ -173,53 +436,30 @@ void mc_arc(float*            target,
 
            For arc generation, the center of the circle is the axis of rotation and the radius vector is
            defined from the circle center to the initial position. Each line segment is formed by successive
-           vector rotations. Single precision values can accumulate error greater than tool precision in rare
-           cases. So, exact arc path correction is implemented. This approach avoids the problem of too many very
-           expensive trig operations [sin(),cos(),tan()] which can take 100-200 usec each to compute.
-
-           Small angle approximation may be used to reduce computation overhead further. A third-order approximation
-           (second order sin() has too much error) holds for most, if not, all CNC applications. Note that this
-           approximation will begin to accumulate a numerical drift error when theta_per_segment is greater than
-           ~0.25 rad(14 deg) AND the approximation is successively used without correction several dozen times. This
-           scenario is extremely unlikely, since segment lengths and theta_per_segment are automatically generated
-           and scaled by the arc tolerance setting. Only a very large arc tolerance setting, unrealistic for CNC
-           applications, would cause this numerical drift error. However, it is best to set N_ARC_CORRECTION from a
-           low of ~4 to a high of ~20 or so to avoid trig operations while keeping arc generation accurate.
-
-           This approximation also allows mc_arc to immediately insert a line segment into the planner
-           without the initial overhead of computing cos() or sin(). By the time the arc needs to be applied
-           a correction, the planner should have caught up to the lag caused by the initial mc_arc overhead.
-           This is important when there are successive arc motions.
+           vector rotations. Only one sin() and cos() are computed per arc, for the rotation by one segment.
+
+           The rotation is carried in double precision. Its rounding error grows by about one part in 1e16
+           per segment, so after the most segments an arc can have it is still far below a step, and the
+           position never needs correcting against the exact angle. Single precision values would drift by
+           more than the tool precision over long arcs, which is why the radius vector was once corrected
+           with sin() and cos() every few segments.
         */
-        // Computes: cos_T = 1 - theta_per_segment^2/2, sin_T = theta_per_segment - theta_per_segment^3/6) in ~52usec
-        float cos_T = 2.0 - theta_per_segment * theta_per_segment;
-        float sin_T = theta_per_segment * 0.16666667 * (cos_T + 4.0);
-        cos_T *= 0.5;
-        float    sin_Ti;
-        float    cos_Ti;
-        float    r_axisi;
+        double   cos_T = cos((double)theta_per_segment);
+        double   sin_T = sin((double)theta_per_segment);
+        double   r_0   = r_axis0;
+        double   r_1   = r_axis1;
+        double   r_i;
+        double   vertex_scale = 1.0 + vertex_offset / radius;
         uint16_t i;
-        uint8_t  count             = 0;
         float    original_feedrate = pl_data->feed_rate;  // Kinematics may alter the feedrate, so save an original copy
         for (i = 1; i < segments; i++) {                  // Increment (segments-1).
-            if (count < N_ARC_CORRECTION) {
-                // Apply vector rotation matrix. ~40 usec
-                r_axisi = r_axis0 * sin_T + r_axis1 * cos_T;
-                r_axis0 = r_axis0 * cos_T - r_axis1 * sin_T;
-                r_axis1 = r_axisi;
-                count++;
-            } else {
-                // Arc correction to radius vector. Computed only every N_ARC_CORRECTION increments. ~375 usec
-                // Compute exact location by applying transformation matrix from initial radius vector(=-offset).
-                cos_Ti  = cos(i * theta_per_segment);
-                sin_Ti  = sin(i * theta_per_segment);
-                r_axis0 = -offset[axis_0] * cos_Ti + offset[axis_1] * sin_Ti;
-                r_axis1 = -offset[axis_0] * sin_Ti - offset[axis_1] * cos_Ti;
-                count   = 0;
-            }
+            // Apply vector rotation matrix.
+            r_i = r_0 * cos_T - r_1 * sin_T;
+            r_1 = r_0 * sin_T + r_1 * cos_T;
+            r_0 = r_i;
             // Update arc_target location
-            position[axis_0] = center_axis0 + r_axis0;
-            position[axis_1] = center_axis1 + r_axis1;
+            position[axis_0] = center_axis0 + r_0 * vertex_scale;
+            position[axis_1] = center_axis1 + r_1 * vertex_scale;
             position[axis_linear] += linear_per_segment;
             pl_data->feed_rate = original_feedrate;  // This restores the feedrate kinematics may have altered
             cartesian_to_motors(position, pl_data, previous_position);
@@ -234,6 +474,173 @@ void mc_arc(float*            target,
     }
     // Ensure last segment arrives at target location.
     cartesian_to_motors(target, pl_data, previous_position);
+#endif
+}
+
+// Execute a cubic Bezier spline in the XY plane (G5). first_control is the offset of the first
+// control point from position, and second_control the offset of the second from target.
+void mc_spline(float* target, plan_line_data_t* pl_data, float* position, float* first_control, float* second_control) {
+    plan_curve_t curve;
+    curve.type   = PlCurve::Spline;
+    curve.axis_0 = X_AXIS;
+    curve.axis_1 = Y_AXIS;
+    auto n_axis  = number_axis->get();
+    for (uint8_t idx = 0; idx < n_axis; idx++) {
+        curve.delta[idx] = (idx == X_AXIS || idx == Y_AXIS) ? 0.0 : target[idx] - position[idx];
+    }
+    for (uint8_t i = 0; i < 2; i++) {
+        uint8_t axis               = i == 0 ? X_AXIS : Y_AXIS;
+        curve.spline.control[0][i] = first_control[i];
+        curve.spline.control[2][i] = target[axis] - position[axis];
+        curve.spline.control[1][i] = curve.spline.control[2][i] + second_control[i];
+    }
+    mc_curve(target, pl_data, position, &curve);
+}
+
+// Continuous mode (G64) path blending. Each G1 line is held back here until the next one
+// arrives, so that the corner between them can be replaced by an arc tangent to both lines.
+// The arc is the one the planner's junction deviation model imagines, with the tolerance as
+// its deviation from the corner, but here it is actually followed. It goes to the planner as
+// chords at the arc tolerance, which meet at shallow angles and so keep nearly the full feed,
+// where the corner itself would have been taken at the junction speed. Blending is done in
+// cartesian space, ahead of the kinematics, so the arc is round in the work.
+static struct {
+    bool             pending;             // A line is held
+    float            start[MAX_N_AXIS];   // Where the held line begins. The end of the last blend.
+    float            target[MAX_N_AXIS];  // Where it ends. The corner of the next blend.
+    plan_line_data_t pl_data;
+} blend;
+
+// Hold a line, replacing any pending line's corner with it by an arc. tolerance is the largest
+// distance from the corner to the arc, in mm. Zero uses the junction deviation.
+void mc_blend_line(float* target, plan_line_data_t* pl_data, float* position, float tolerance) {
+    auto n_axis = number_axis->get();
+    // Inverse time feed rates are for the whole line, so there is no blending under G93.
+    if (sys.state == State::CheckMode || pl_data->motion.inverseTime) {
+        mc_blend_flush();
+        cartesian_to_motors(target, pl_data, position);
+        return;
+    }
+    if (tolerance <= 0.0) {
+        tolerance = junction_deviation->get();
+    }
+    if (blend.pending) {
+        // Unit vectors of the held line, into the corner, and the new line, out of it.
+        float   u1[MAX_N_AXIS], u2[MAX_N_AXIS];
+        float   len1 = 0.0, len2 = 0.0, cos_turn = 0.0;
+        uint8_t idx;
+        for (idx = 0; idx < n_axis; idx++) {
+            u1[idx] = blend.target[idx] - blend.start[idx];
+            u2[idx] = target[idx] - blend.target[idx];
+            len1 += u1[idx] * u1[idx];
+            len2 += u2[idx] * u2[idx];
+        }
+        len1 = sqrt(len1);
+        len2 = sqrt(len2);
+        if (len1 > 0.0 && len2 > 0.0) {
+            for (idx = 0; idx < n_axis; idx++) {
+                u1[idx] /= len1;
+                u2[idx] /= len2;
+                cos_turn += u1[idx] * u2[idx];
+            }
+        }
+        // Near-straight junctions are already taken at full speed, and reversals leave no room for an arc.
+        if (len1 > 0.0 && len2 > 0.0 && cos_turn < 0.999999 && cos_turn > -0.999) {
+            // alpha is half the angle between the lines at the corner, by trig half angle identities.
+            float sin_alpha = sqrt(0.5 * (1.0 + cos_turn));
+            float cos_alpha = sqrt(0.5 * (1.0 - cos_turn));
+            float radius    = tolerance * sin_alpha / (1.0 - sin_alpha);
+            // Distance from the corner back to where the arc leaves each line. The arc may take all
+            // of what is left of the held line, but only half the new one, leaving the rest for the
+            // next corner. A shorter run means a smaller arc, inside the tolerance.
+            float run = radius * cos_alpha / sin_alpha;
+            if (run > MIN(len1, 0.5 * len2)) {
+                run    = MIN(len1, 0.5 * len2);
+                radius = run * sin_alpha / cos_alpha;
+            }
+            // The arc turns through the same angle as the path. Split it as mc_arc() would.
+            float    turn     = atan2(2.0 * sin_alpha * cos_alpha, cos_turn);
+            uint16_t segments = 0;
+            if (radius > arc_tolerance->get()) {
+                segments = floor(0.5 * turn * radius / sqrt(arc_tolerance->get() * (2 * radius - arc_tolerance->get())));
+            }
+            float    arc_start[MAX_N_AXIS];
+            float    arc_end[MAX_N_AXIS];
+            float    center[MAX_N_AXIS];
+            float    r_start[MAX_N_AXIS];
+            float    bisector[MAX_N_AXIS];
+            float    bisector_len = 0.0;
+            for (idx = 0; idx < n_axis; idx++) {
+                arc_start[idx] = blend.target[idx] - run * u1[idx];
+                arc_end[idx]   = blend.target[idx] + run * u2[idx];
+                bisector[idx]  = u2[idx] - u1[idx];
+                bisector_len += bisector[idx] * bisector[idx];
+            }
+            bisector_len = sqrt(bisector_len);
+            for (idx = 0; idx < n_axis; idx++) {
+                center[idx]  = blend.target[idx] + bisector[idx] * (radius / (sin_alpha * bisector_len));
+                r_start[idx] = arc_start[idx] - center[idx];
+            }
+            plan_line_data_t pl_corner = blend.pl_data;
+            if (run < len1) {
+                cartesian_to_motors(arc_start, &pl_corner, blend.start);
+            }
+            // Points on the arc are center + cos(t) * r_start + sin(t) * radius * u1. cos(t) and sin(t)
+            // advance by the angle sum identities, so only one sin() and cos() are taken per corner.
+            float previous_position[MAX_N_AXIS];
+            float position_i[MAX_N_AXIS];
+            memcpy(previous_position, arc_start, sizeof(arc_start));
+            if (segments) {
+                float theta_per_segment = turn / segments;
+                float cos_T             = cos(theta_per_segment);
+                float sin_T             = sin(theta_per_segment);
+                float cos_Ti            = 1.0;
+                float sin_Ti            = 0.0;
+                float cos_next;
+                for (uint16_t i = 1; i < segments; i++) {
+                    cos_next = cos_Ti * cos_T - sin_Ti * sin_T;
+                    sin_Ti   = sin_Ti * cos_T + cos_Ti * sin_T;
+                    cos_Ti   = cos_next;
+                    for (idx = 0; idx < n_axis; idx++) {
+                        position_i[idx] = center[idx] + cos_Ti * r_start[idx] + sin_Ti * radius * u1[idx];
+                    }
+                    pl_corner = blend.pl_data;
+                    cartesian_to_motors(position_i, &pl_corner, previous_position);
+                    memcpy(previous_position, position_i, sizeof(position_i));
+                    // Bail mid-arc on system abort. Runtime command check already performed by mc_line.
+                    if (sys.abort) {
+                        blend.pending = false;
+                        return;
+                    }
+                }
+            }
+            pl_corner = blend.pl_data;
+            cartesian_to_motors(arc_end, &pl_corner, previous_position);
+            memcpy(blend.start, arc_end, sizeof(arc_end));
+        } else {
+            mc_blend_flush();
+            memcpy(blend.start, position, sizeof(blend.start));
+        }
+    } else {
+        memcpy(blend.start, position, sizeof(blend.start));
+    }
+    memcpy(blend.target, target, sizeof(blend.target));
+    blend.pl_data = *pl_data;
+    blend.pending = true;
+}
+
+// Send the held line, if any, to the planner unchanged. Called before anything that waits for the
+// planner or moves in another way.
+void mc_blend_flush() {
+    if (blend.pending) {
+        blend.pending = false;
+        cartesian_to_motors(blend.target, &blend.pl_data, blend.start);
+    }
+}
+
+// Drop the held line, if any. Called on reset.
+void mc_blend_reset() {
+    blend.pending = false;
 }
 
 // Execute dwell in seconds.
@@ -420,6 +827,7 @@ GCUpdatePos mc_probe_cycle(float* target, plan_line_data_t* pl_data, uint8_t par
     // Setup and queue probing motion. Auto cycle-start should not start the cycle.
     grbl_msg_sendf(CLIENT_SERIAL, MsgLevel::Info, "Found");
     cartesian_to_motors(target, pl_data, gc_state.position);
+    mc_merge_flush();  // The probing motion must be planned now, not held for merging.
     // Activate the probing state monitor in the stepper module.
     sys_probe_state = Probe::Active;
     // Perform probing cycle. Wait here until probe is triggered or motion completes.
@@ -38,6 +38,10 @@ const int PARKING_MOTION_LINE_NUMBER = 0;
 bool cartesian_to_motors(float* target, plan_line_data_t* pl_data, float* position);
 bool mc_line(float* target, plan_line_data_t* pl_data);  // returns true if line was submitted to planner
 
+// Plan any line held by mc_line() for merging with the next, or drop it on reset.
+void mc_merge_flush();
+void mc_merge_reset();
+
 // Execute an arc in offset mode format. position == current xyz, target == target xyz,
 // offset == offset from current xyz, axis_XXX defines circle plane in tool space, axis_linear is
 // the direction of helical travel, radius == circle radius, is_clockwise_arc boolean. Used
@@ -52,6 +56,21 @@ void mc_arc(float*            target,
             uint8_t           axis_linear,
             uint8_t           is_clockwise_arc);
 
+// Execute a cubic Bezier spline in the XY plane (G5). first_control is the offset of the first
+// control point from position, second_control the offset of the second control point from target.
+void mc_spline(float* target, plan_line_data_t* pl_data, float* position, float* first_control, float* second_control);
+
+// Execute linear motion in continuous mode (G64). The line is held until the next one, and the
+// corner between them is rounded by an arc that stays within tolerance mm of it.
+void mc_blend_line(float* target, plan_line_data_t* pl_data, float* position, float tolerance);
+
+// Send any held G64 line to the planner, or drop it on reset.
+void mc_blend_flush();
+void mc_blend_reset();
+
+// Send every held line to the planner. Called before waiting for the planner or leaving g-code.
+void mc_flush();
+
 // Dwell for a specific number of seconds
 bool mc_dwell(int32_t milliseconds);
 
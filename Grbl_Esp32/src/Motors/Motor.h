@@ -83,6 +83,27 @@ namespace Motors {
         // states of the step pins are unknown.
         virtual void unstep() {}
 
+        // i2s_step_bits() adds the bits of the I2S output that step()
+        // changes to bits, so that a step pulse can be written
+        // straight into the I2S stream instead.  It returns false if
+        // the motor steps some other way.  Motors that do nothing
+        // in step() add no bits.
+        virtual bool i2s_step_bits(uint32_t& bits) { return true; }
+
+        // send_train() sends a train of step pulses, as RMT items,
+        // in place of a step() for each, so that many steps can be
+        // sent at once.  It returns false, sending nothing, if the
+        // motor steps some other way; with items NULL it only asks.
+        // Motors that do nothing in step() ignore the train.
+        virtual bool send_train(const rmt_item32_t* items) { return true; }
+
+        // gpio_pins() adds the GPIO writes that step() makes to
+        // step, so that the stepper can drive the step pins of
+        // every motor at once; unstep() is the same writes with high
+        // and low swapped.  It returns false if the motor steps some
+        // other way.  Motors that do nothing in step() add nothing.
+        virtual bool gpio_pins(gpio_writes_t& step) { return true; }
+
         // test(), called from init(), checks to see if a motor is
         // responsive, returning true on failure.  Typical
         // implementations also display messages to show the result.
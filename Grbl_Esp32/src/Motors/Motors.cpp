@@ -411,13 +411,14 @@ void           init_motors() {
     }
 }
 
-void motors_set_disable(bool disable, uint8_t mask) {
+bool motors_set_disable(bool disable, uint8_t mask) {
     static bool    prev_disable = true;
     static uint8_t prev_mask    = 0;
 
     if ((disable == prev_disable) && (mask == prev_mask)) {
-        return;
+        return false;
     }
+    bool enabled = !disable;
 
     prev_disable = disable;
     prev_mask    = mask;
@@ -439,16 +440,9 @@ void motors_set_disable(bool disable, uint8_t mask) {
     // global disable.
     digitalWrite(STEPPERS_DISABLE_PIN, disable);
 
-    // Add an optional delay for stepper drivers. that need time
-    // Some need time after the enable before they can step.
-    auto wait_disable_change = enable_delay_microseconds->get();
-    if (wait_disable_change != 0) {
-        auto disable_start_time = esp_timer_get_time() + wait_disable_change;
-
-        while ((esp_timer_get_time() - disable_start_time) < 0) {
-            NOP();
-        }
-    }
+    // Some stepper drivers need time after the enable before they can step. The caller that steps
+    // them gives it, as it knows when the first step comes.
+    return enabled;
 }
 
 void motors_read_settings() {
@@ -477,15 +471,16 @@ uint8_t motors_set_homing_mode(uint8_t homing_mask, bool isHoming) {
     return can_home;
 }
 
+uint8_t motors_dir_mask = 255;  // should never be this value
+
 bool motors_direction(uint8_t dir_mask) {
     auto n_axis = number_axis->get();
     //grbl_msg_sendf(CLIENT_SERIAL, MsgLevel::Info, "motors_set_direction_pins:0x%02X", onMask);
 
     // Set the direction pins, but optimize for the common
     // situation where the direction bits haven't changed.
-    static uint8_t previous_dir = 255;  // should never be this value
-    if (dir_mask != previous_dir) {
-        previous_dir = dir_mask;
+    if (dir_mask != motors_dir_mask) {
+        motors_dir_mask = dir_mask;
 
         for (int axis = X_AXIS; axis < n_axis; axis++) {
             bool thisDir = bitnum_istrue(dir_mask, axis);
@@ -523,3 +518,101 @@ void motors_unstep() {
         myMotor[axis][1]->unstep();
     }
 }
+
+// Gets the I2S output bits that motors_step() would change for each axis, so that the I2S
+// stream can write step pulses itself. Returns false if a motor steps in some other way.
+bool motors_i2s_step_bits(uint32_t* axis_bits) {
+    auto n_axis = number_axis->get();
+    bool all    = true;
+    for (uint8_t axis = X_AXIS; axis < n_axis; axis++) {
+        uint32_t bits[2] = { 0, 0 };
+        all &= myMotor[axis][0]->i2s_step_bits(bits[0]);
+        all &= myMotor[axis][1]->i2s_step_bits(bits[1]);
+        axis_bits[axis] = 0;
+        if ((ganged_mode == SquaringMode::Dual) || (ganged_mode == SquaringMode::A)) {
+            axis_bits[axis] |= bits[0];
+        }
+        if ((ganged_mode == SquaringMode::Dual) || (ganged_mode == SquaringMode::B)) {
+            axis_bits[axis] |= bits[1];
+        }
+    }
+    return all;
+}
+
+// Returns true if every motor can take its step pulses as a train, so that the stepper can send
+// many steps at once with motors_send_trains().
+bool motors_rmt_trains() {
+    auto n_axis = number_axis->get();
+    bool all    = true;
+    for (uint8_t axis = X_AXIS; axis < n_axis; axis++) {
+        all &= myMotor[axis][0]->send_train(NULL);
+        all &= myMotor[axis][1]->send_train(NULL);
+    }
+    return all;
+}
+
+// Sends each axis in step_mask its train of step pulses, to the motors that motors_step() would
+// step. The trains start one after another, a fraction of a microsecond apart.
+void motors_send_trains(rmt_item32_t (*trains)[RMT_TRAIN_ITEMS], uint8_t step_mask) {
+    auto n_axis = number_axis->get();
+    for (uint8_t axis = X_AXIS; axis < n_axis; axis++) {
+        if (bitnum_istrue(step_mask, axis)) {
+            if ((ganged_mode == SquaringMode::Dual) || (ganged_mode == SquaringMode::A)) {
+                myMotor[axis][0]->send_train(trains[axis]);
+            }
+            if ((ganged_mode == SquaringMode::Dual) || (ganged_mode == SquaringMode::B)) {
+                myMotor[axis][1]->send_train(trains[axis]);
+            }
+        }
+    }
+}
+
+void gpio_writes_add(gpio_writes_t& writes, uint8_t pin, bool high) {
+    if (high) {
+        writes.set[pin / 32] |= bit(pin % 32);
+    } else {
+        writes.clear[pin / 32] |= bit(pin % 32);
+    }
+}
+
+static void gpio_writes_merge(gpio_writes_t& writes, const gpio_writes_t& more) {
+    for (int bank = 0; bank < 2; bank++) {
+        writes.set[bank] |= more.set[bank];
+        writes.clear[bank] |= more.clear[bank];
+    }
+}
+
+// Makes a step plan from the step pins of the motors and ganged_mode as they are now. Returns false
+// if a motor steps in some other way, so that the stepper must call motors_step().
+bool motors_step_plan(motors_plan_t* plan) {
+    auto          n_axis = number_axis->get();
+    bool          all    = true;
+    gpio_writes_t axis_step[MAX_N_AXIS];
+
+    memset(plan, 0, sizeof(*plan));
+    for (uint8_t axis = X_AXIS; axis < n_axis; axis++) {
+        gpio_writes_t step[2] = {};
+        all &= myMotor[axis][0]->gpio_pins(step[0]);
+        all &= myMotor[axis][1]->gpio_pins(step[1]);
+        axis_step[axis] = {};
+        if ((ganged_mode == SquaringMode::Dual) || (ganged_mode == SquaringMode::A)) {
+            gpio_writes_merge(axis_step[axis], step[0]);
+        }
+        if ((ganged_mode == SquaringMode::Dual) || (ganged_mode == SquaringMode::B)) {
+            gpio_writes_merge(axis_step[axis], step[1]);
+        }
+        // motors_unstep() ends the pulses of both motors, whichever step
+        for (int motor = 0; motor < 2; motor++) {
+            gpio_writes_t unstep = { { step[motor].clear[0], step[motor].clear[1] }, { step[motor].set[0], step[motor].set[1] } };
+            gpio_writes_merge(plan->unstep, unstep);
+        }
+    }
+    for (uint32_t step_mask = 1; step_mask < bit(n_axis); step_mask++) {
+        for (uint8_t axis = X_AXIS; axis < n_axis; axis++) {
+            if (bitnum_istrue(step_mask, axis)) {
+                gpio_writes_merge(plan->step[step_mask], axis_step[axis]);
+            }
+        }
+    }
+    return all;
+}
@@ -31,6 +31,8 @@
 
 #include "../Grbl.h"
 
+#include <soc/gpio_struct.h>
+
 // These are used for setup and to talk to the motors as a group.
 void    init_motors();
 uint8_t get_next_trinamic_driver_index();
@@ -39,9 +41,59 @@ void    motors_read_settings();
 
 // The return value is a bitmask of axes that can home
 uint8_t motors_set_homing_mode(uint8_t homing_mask, bool isHoming);
-void    motors_set_disable(bool disable, uint8_t mask = B11111111);  // default is all axes
+// Returns true if motors were enabled, which need enable_delay_microseconds before they step.
+bool    motors_set_disable(bool disable, uint8_t mask = B11111111);  // default is all axes
 bool    motors_direction(uint8_t dir_mask);
 void    motors_step(uint8_t step_mask);
 void    motors_unstep();
+bool    motors_i2s_step_bits(uint32_t* axis_bits);
+
+// A train of step pulses for one axis, as RMT items: each is the time from the end of the last
+// pulse to the start of this one, then the pulse, in RMT ticks. An item of zero duration ends it.
+const int RMT_TICKS_PER_MICROSECOND = 4;   // The RMT clock of step pulses, APB / 20
+const int RMT_TRAIN_ITEMS           = 64;  // Items in the RMT memory of a channel
+
+bool motors_rmt_trains();
+void motors_send_trains(rmt_item32_t (*trains)[RMT_TRAIN_ITEMS], uint8_t step_mask);
+
+// The dir_mask last set by motors_direction(), so that the stepper can skip the call when the
+// direction has not changed.
+extern uint8_t motors_dir_mask;
+
+// GPIO register writes that drive some output pins. Index 0 is GPIO 0-31, index 1 GPIO 32-39.
+typedef struct {
+    uint32_t set[2];    // Pins to drive high, through W1TS
+    uint32_t clear[2];  // Pins to drive low, through W1TC
+} gpio_writes_t;
+
+void gpio_writes_add(gpio_writes_t& writes, uint8_t pin, bool high);
+
+// A step plan: the GPIO writes of motors_step() for every set of axes, and of motors_unstep(), as
+// the motors and ganged_mode are when it is made, so that the stepper ISR steps with a few register
+// writes instead of a call to each motor. See motors_step_plan().
+typedef struct {
+    gpio_writes_t step[bit(MAX_N_AXIS)];  // Indexed by step_mask
+    gpio_writes_t unstep;
+} motors_plan_t;
+
+bool motors_step_plan(motors_plan_t* plan);
+
+static inline void IRAM_ATTR motors_gpio_write(const gpio_writes_t& writes) {
+    GPIO.out_w1ts = writes.set[0];
+    GPIO.out_w1tc = writes.clear[0];
+    if (writes.set[1] | writes.clear[1]) {
+        GPIO.out1_w1ts.val = writes.set[1];
+        GPIO.out1_w1tc.val = writes.clear[1];
+    }
+}
+
+// As motors_step() and motors_unstep(), for a plan that motors_step_plan() could make
+static inline void IRAM_ATTR motors_plan_step(const motors_plan_t& plan, uint8_t step_mask) {
+    motors_gpio_write(plan.step[step_mask]);
+}
+
+static inline void IRAM_ATTR motors_plan_unstep(const motors_plan_t& plan) {
+    motors_gpio_write(plan.unstep);
+}
 
 void servoUpdateTask(void* pvParameters);
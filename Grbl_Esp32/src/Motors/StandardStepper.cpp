@@ -60,8 +60,12 @@ namespace Motors {
 
 #ifdef USE_RMT_STEPS
         rmtConfig.rmt_mode                       = RMT_MODE_TX;
-        rmtConfig.clk_div                        = 20;
+        rmtConfig.clk_div                        = 80 / RMT_TICKS_PER_MICROSECOND;  // Of the 80 MHz APB clock
+#    ifdef RMT_STEP_TRAINS
+        rmtConfig.mem_block_num                  = 1;  // 64 items, a whole train
+#    else
         rmtConfig.mem_block_num                  = 2;
+#    endif
         rmtConfig.tx_config.loop_en              = false;
         rmtConfig.tx_config.carrier_en           = false;
         rmtConfig.tx_config.carrier_freq_hz      = 0;
@@ -70,9 +74,9 @@ namespace Motors {
         rmtConfig.tx_config.idle_output_en       = true;
 
         auto stepPulseDelay  = direction_delay_microseconds->get();
-        rmtItem[0].duration0 = stepPulseDelay < 1 ? 1 : stepPulseDelay * 4;
+        rmtItem[0].duration0 = stepPulseDelay < 1 ? 1 : stepPulseDelay * RMT_TICKS_PER_MICROSECOND;
 
-        rmtItem[0].duration1 = 4 * pulse_microseconds->get();
+        rmtItem[0].duration1 = RMT_TICKS_PER_MICROSECOND * pulse_microseconds->get();
         rmtItem[1].duration0 = 0;
         rmtItem[1].duration1 = 0;
 
@@ -86,7 +90,10 @@ namespace Motors {
         rmtItem[0].level0              = rmtConfig.tx_config.idle_level;
         rmtItem[0].level1              = !rmtConfig.tx_config.idle_level;
         rmt_config(&rmtConfig);
-        rmt_fill_tx_items(rmtConfig.channel, &rmtItem[0], rmtConfig.mem_block_num, 0);
+        // The pulse and the end marker after it, which also overwrites any train left in the memory
+        rmt_fill_tx_items(rmtConfig.channel, &rmtItem[0], 2, 0);
+        _rmt_pulse = rmtItem[0];
+        _rmt_train = false;
 
 #else
         pinMode(_step_pin, OUTPUT);
@@ -108,6 +115,12 @@ namespace Motors {
 
     void StandardStepper::step() {
 #ifdef USE_RMT_STEPS
+        if (_rmt_train) {
+            // A train has overwritten the pulse
+            RMTMEM.chan[_rmt_chan_num].data32[0].val = _rmt_pulse.val;
+            RMTMEM.chan[_rmt_chan_num].data32[1].val = 0;
+            _rmt_train                               = false;
+        }
         RMT.conf_ch[_rmt_chan_num].conf1.mem_rd_rst = 1;
         RMT.conf_ch[_rmt_chan_num].conf1.tx_start   = 1;
 #else
@@ -121,6 +134,58 @@ namespace Motors {
 #endif  // USE_RMT_STEPS
     }
 
+    bool StandardStepper::i2s_step_bits(uint32_t& bits) {
+#ifdef USE_RMT_STEPS
+        return false;
+#else
+        if (_step_pin == UNDEFINED_PIN) {
+            return true;
+        }
+        if (_step_pin < I2S_OUT_PIN_BASE) {
+            return false;
+        }
+        bits |= bit(_step_pin - I2S_OUT_PIN_BASE);
+        return true;
+#endif  // USE_RMT_STEPS
+    }
+
+    bool StandardStepper::gpio_pins(gpio_writes_t& step) {
+#ifdef USE_RMT_STEPS
+        return false;
+#else
+        if (_step_pin == UNDEFINED_PIN) {
+            return true;
+        }
+        if (_step_pin >= I2S_OUT_PIN_BASE) {
+            return false;
+        }
+        gpio_writes_add(step, _step_pin, !_invert_step_pin);
+        return true;
+#endif  // USE_RMT_STEPS
+    }
+
+    bool StandardStepper::send_train(const rmt_item32_t* items) {
+#ifdef USE_RMT_STEPS
+        if (_rmt_chan_num == RMT_CHANNEL_MAX) {
+            return false;
+        }
+        if (items != NULL) {
+            // The items are written for an active high pulse
+            const uint32_t invert = _invert_step_pin ? 0x80008000 : 0;  // level0 and level1
+            int            i      = 0;
+            do {
+                RMTMEM.chan[_rmt_chan_num].data32[i].val = items[i].val ^ invert;
+            } while (items[i++].duration0 != 0);
+            _rmt_train                                  = true;
+            RMT.conf_ch[_rmt_chan_num].conf1.mem_rd_rst = 1;
+            RMT.conf_ch[_rmt_chan_num].conf1.tx_start   = 1;
+        }
+        return true;
+#else
+        return false;
+#endif  // USE_RMT_STEPS
+    }
+
     void StandardStepper::set_direction(bool dir) { digitalWrite(_dir_pin, dir ^ _invert_dir_pin); }
 
     void StandardStepper::set_disable(bool disable) {
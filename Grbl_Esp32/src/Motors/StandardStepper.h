@@ -15,6 +15,9 @@ namespace Motors {
         void set_direction(bool) override;
         void step() override;
         void unstep() override;
+        bool i2s_step_bits(uint32_t& bits) override;
+        bool send_train(const rmt_item32_t* items) override;
+        bool gpio_pins(gpio_writes_t& step) override;
         void read_settings() override;
 
         void init_step_dir_pins();
@@ -24,6 +27,8 @@ namespace Motors {
 
 #ifdef USE_RMT_STEPS
         rmt_channel_t _rmt_chan_num;
+        rmt_item32_t  _rmt_pulse;  // The pulse of step()
+        bool          _rmt_train;  // A train has been sent since step() last wrote its pulse
 #endif
         bool    _invert_step_pin;
         bool    _invert_dir_pin;
@@ -13,6 +13,9 @@ namespace Motors {
         void set_disable(bool disable) override;
         void set_direction(bool) override;
         void step() override;
+        bool i2s_step_bits(uint32_t& bits) override { return false; }
+        bool send_train(const rmt_item32_t* items) override { return false; }
+        bool gpio_pins(gpio_writes_t& step) override { return false; }
 
     private:
         uint8_t _pin_phase0;
@@ -174,6 +174,25 @@ float limit_acceleration_by_axis_maximum(float* unit_vec) {
     return limit_value * SEC_PER_MIN_SQ;
 }
 
+// Like limit_acceleration_by_axis_maximum(), for the jerk of S-curve ramps. Returns zero, so that the
+// block uses constant-acceleration ramps, if any axis in the move has a jerk setting of zero.
+float limit_jerk_by_axis_maximum(float* unit_vec) {
+    uint8_t idx;
+    float   limit_value = SOME_LARGE_VALUE;
+    auto    n_axis      = number_axis->get();
+    for (idx = 0; idx < n_axis; idx++) {
+        if (unit_vec[idx] != 0) {  // Avoid divide by zero.
+            float jerk = axis_settings[idx]->jerk->get();
+            if (jerk == 0) {
+                return 0.0;
+            }
+            limit_value = MIN(limit_value, fabs(jerk / unit_vec[idx]));
+        }
+    }
+    // Stored in units of mm/sec^3, used in units of mm/min^3.
+    return limit_value * SEC_PER_MIN_CU;
+}
+
 float limit_rate_by_axis_maximum(float* unit_vec) {
     uint8_t idx;
     float   limit_value = SOME_LARGE_VALUE;
@@ -26,11 +26,26 @@
 #include "Grbl.h"
 #include <stdlib.h>  // PSoc Required for labs
 
-static plan_block_t block_buffer[BLOCK_BUFFER_SIZE];  // A ring buffer for motion instructions
-static uint8_t      block_buffer_tail;                // Index of the block to process now
-static uint8_t      block_buffer_head;                // Index of the next block to be pushed
-static uint8_t      next_buffer_head;                 // Index of the next buffer head
-static uint8_t      block_buffer_planned;             // Index of the optimally planned block
+static plan_block_t*   block_buffer;          // A ring buffer for motion instructions. Allocated by plan_init().
+static plan_profile_t* block_profile;         // The velocity profile of each block in block_buffer
+static plan_curve_t*   block_curve;           // The curve of each block in block_buffer. Read once per segment.
+static plan_ramp_t*    block_ramp;            // The S-curve ramp of each block in block_buffer
+static uint16_t        block_buffer_size;     // Number of blocks in the ring buffer
+static uint16_t        block_buffer_tail;     // Index of the block to process now
+static uint16_t        block_buffer_head;     // Index of the next block to be pushed
+static uint16_t        next_buffer_head;      // Index of the next buffer head
+static uint16_t        block_buffer_planned;  // Index of the optimally planned block
+static float           queued_mm;             // Length of the blocks after the tail. See plan_get_planned_distance().
+
+// Guards the buffer head, tail and queued_mm as a set, for the client task to report them together.
+static portMUX_TYPE plan_queue_spinlock = portMUX_INITIALIZER_UNLOCKED;
+
+// The pixels of raster blocks, in the order of the blocks. plan_buffer_line() adds them, and the
+// stepper ISR frees them after the last pixel, which can be after the block has been discarded. A
+// raster never wraps around the end of the buffer, so the ISR reads it in one piece.
+static uint8_t               raster_buffer[RASTER_BUFFER_SIZE];
+static uint16_t              raster_head;  // Where the next raster goes
+static std::atomic<uint16_t> raster_tail;  // Start of the oldest raster in use. Written by the ISR.
 
 // Define planner variables
 typedef struct {
@@ -43,18 +58,18 @@ typedef struct {
 static planner_t pl;
 
 // Returns the index of the next block in the ring buffer. Also called by stepper segment buffer.
-uint8_t plan_next_block_index(uint8_t block_index) {
+uint16_t plan_next_block_index(uint16_t block_index) {
     block_index++;
-    if (block_index == BLOCK_BUFFER_SIZE) {
+    if (block_index == block_buffer_size) {
         block_index = 0;
     }
     return block_index;
 }
 
 // Returns the index of the previous block in the ring buffer
-static uint8_t plan_prev_block_index(uint8_t block_index) {
+static uint16_t plan_prev_block_index(uint16_t block_index) {
     if (block_index == 0) {
-        block_index = BLOCK_BUFFER_SIZE;
+        block_index = block_buffer_size;
     }
     block_index--;
     return block_index;
@@ -112,6 +127,18 @@ static uint8_t plan_prev_block_index(uint8_t block_index) {
       this block can never be less than block_buffer_tail and will always be pushed forward and maintain
       this requirement when encountered by the plan_discard_current_block() routine during a cycle.
 
+  Blocks with a jerk have S-curve ramps, which start and end at zero acceleration, and take longer to
+  change speed than a linear ramp at the same acceleration. The reverse pass plans their entry speeds
+  over the exact length of an S-curve instead (see plan_s_curve_entry_speed()). A ramp is not cut at
+  every junction: each block stores the end of the ramp its entry speed was planned for, which may be
+  several blocks ahead, and the block before it plans over the whole distance to that end, so that
+  segment prep can follow a deceleration through many short blocks as one S-curve. A ramp ends at a
+  junction that limits it, where prep must arrive at zero acceleration. The forward pass is left
+  as it is. Its accelerations are only a guide for blocks with a jerk, since prep accelerates them
+  itself, but they still bound the entry speed, so a block it limits is planned as before. Through
+  short lines whose junctions end their ramps, entry speeds rarely reach either limit, and the
+  reverse pass instead stops where a new block raises them by less than S_CURVE_REPLAN_TOLERANCE.
+
   NOTE: Since the planner only computes on what's in the planner buffer, some motions with lots of short
   line segments, like G2/3 arcs or complex curves, may seem to move slow. This is because there simply isn't
   enough combined distance traveled in the entire buffer to accelerate up to the nominal speed and then
@@ -125,9 +152,115 @@ static uint8_t plan_prev_block_index(uint8_t block_index) {
   ARM versions should have enough memory and speed for look-ahead blocks numbering up to a hundred or more.
 
 */
-static void planner_recalculate() {
+
+// Returns the highest speed from which an S-curve with the given acceleration and jerk slows down to
+// end_speed within the distance, starting and ending at zero acceleration. A ramp that changes speed
+// by dv covers (v0 + v1) / 2 * (dv / accel + accel / jerk) if it reaches the full acceleration, and
+// (v0 + v1) * sqrt(dv / jerk) if it does not.
+static float plan_s_curve_reach(float end_speed, float millimeters, float accel, float jerk) {
+    float jerk_time = accel / jerk;       // Time for the acceleration to reach accel
+    float full      = accel * jerk_time;  // Speed change of the ramp that just reaches accel
+    float b         = 2 * end_speed + full;
+    if (millimeters >= b * jerk_time) {
+        // Solve the quadratic in dv, in a form that keeps its precision when dv is small.
+        float c = 2 * end_speed - full;
+        return end_speed + 4 * (accel * millimeters - end_speed * full) / (sqrt(c * c + 8 * accel * millimeters) + b);
+    }
+    // Solve x^3 + 2 * end_speed * x = millimeters * sqrt(jerk) for x = sqrt(dv), by Newton's method. It
+    // starts above the root, from the smaller of the roots of the two terms alone, and stays above it.
+    float p = 2 * end_speed;
+    float q = millimeters * sqrt(jerk);
+    float x = cbrt(q);
+    if (p * x > q) {
+        x = q / p;
+    }
+    for (int i = 0; i < 4; i++) {
+        x -= (x * x * x + p * x - q) / (3 * x * x + p);
+    }
+    return end_speed + x * x;
+}
+
+// Returns the entry speed to plan for an S-curve ramp to end_speed. Unlike a linear ramp, an S-curve
+// from a given speed is longest to an end speed in between: a third of it, or half the speed change
+// of a jerk phase once it reaches the full acceleration. So a higher end speed, as more blocks come
+// in, could lower the entry speed from plan_s_curve_reach() after segment prep has started for it.
+// Below that end speed, the entry speed is planned for the longest ramp instead, and never drops.
+static float plan_s_curve_entry_speed(float end_speed, float millimeters, float accel, float jerk) {
+    float full      = accel * accel / jerk;  // Speed change of the ramp that just reaches accel
+    float speed     = plan_s_curve_reach(end_speed, millimeters, accel, jerk);
+    float end_limit = speed < 1.5 * full ? speed / 3 : 0.5 * full;
+    if (end_speed >= end_limit) {
+        return speed;
+    }
+    speed = plan_s_curve_reach(0.5 * full, millimeters, accel, jerk);
+    if (speed < 1.5 * full) {
+        // Below the full acceleration, (4 / 3 * speed) * sqrt(2 / 3 * speed / jerk) is the longest ramp.
+        float q = 0.75 * sqrt(1.5) * millimeters * sqrt(jerk);
+        speed   = cbrt(q * q);
+    }
+    return speed;
+}
+
+// Gets the ramp through the exit of the block before next_index: a stop at the end of the buffer, or
+// the start of a linear ramp, or the ramp through the entry of the next block.
+static void plan_exit_ramp(uint16_t next_index, plan_ramp_t* ramp) {
+    if (next_index == block_buffer_head) {
+        ramp->end_speed = 0.0;
+    } else if (block_ramp[next_index].jerk == 0.0) {
+        ramp->end_speed = sqrt(block_profile[next_index].entry_speed_sqr);
+    } else {
+        *ramp = block_ramp[next_index];
+        return;
+    }
+    ramp->end_mm      = 0.0;
+    ramp->accel_limit = SOME_LARGE_VALUE;
+    ramp->jerk_limit  = SOME_LARGE_VALUE;
+}
+
+// Computes the maximum entry speed of a block with a jerk, slowing down over one S-curve to the end
+// of the ramp through its exit, and the ramp through its entry.
+static void plan_s_curve_entry(plan_profile_t* profile, plan_ramp_t* ramp, const plan_ramp_t* exit) {
+    float accel     = MIN(profile->acceleration, exit->accel_limit);
+    float jerk      = MIN(ramp->jerk, exit->jerk_limit);
+    float mm        = profile->millimeters + exit->end_mm;
+    float speed     = plan_s_curve_entry_speed(exit->end_speed, mm, accel, jerk);
+    float max_speed = sqrt(profile->max_entry_speed_sqr);
+    if (speed >= max_speed) {
+        // The junction limits the entry speed. A ramp through the block before ends here.
+        profile->entry_speed_sqr = profile->max_entry_speed_sqr;
+        ramp->end_speed          = max_speed;
+        ramp->end_mm             = 0.0;
+        ramp->accel_limit        = profile->acceleration;
+        ramp->jerk_limit         = ramp->jerk;
+        return;
+    }
+    profile->entry_speed_sqr = speed * speed;
+    // A ramp through the block before may run on through this junction only if no speed in that block
+    // can pass it too fast, as a deceleration that still has to slow down further passes a junction
+    // faster than the speed planned there. And only if the blocks it runs on through allow as much
+    // acceleration and jerk as this one, and it does not end in the stop at the end of the buffer,
+    // which more blocks may turn into a ramp that ends here. The entry speeds planned before would
+    // drop, after segment prep may have started on them, if a ramp that ran on were cut here later.
+    if (!ramp->nominal_entry || exit->accel_limit < profile->acceleration || exit->jerk_limit < ramp->jerk || exit->end_speed == 0.0) {
+        ramp->end_speed   = speed;
+        ramp->end_mm      = 0.0;
+        ramp->accel_limit = profile->acceleration;
+        ramp->jerk_limit  = ramp->jerk;
+        return;
+    }
+    ramp->end_speed   = exit->end_speed;
+    ramp->end_mm      = mm;
+    ramp->accel_limit = accel;
+    ramp->jerk_limit  = jerk;
+}
+
+// Replans the buffer from the last block back to the planned pointer. A new block only raises the
+// entry speeds before it, so settle lets the reverse pass stop early once they barely rise. Replans
+// after a feed hold or an override, which can lower them, set it to false.
+static void planner_recalculate(bool settle) {
+    const float settle_limit = (1 + S_CURVE_REPLAN_TOLERANCE) * (1 + S_CURVE_REPLAN_TOLERANCE);
     // Initialize block index to the last block in the planner buffer.
-    uint8_t block_index = plan_prev_block_index(block_buffer_head);
+    uint16_t block_index = plan_prev_block_index(block_buffer_head);
     // Bail. Can't do anything with one only one plan-able block.
     if (block_index == block_buffer_planned) {
         return;
@@ -135,12 +268,18 @@ static void planner_recalculate() {
     // Reverse Pass: Coarsely maximize all possible deceleration curves back-planning from the last
     // block in buffer. Cease planning when the last optimal planned or tail pointer is reached.
     // NOTE: Forward pass will later refine and correct the reverse pass to create an optimal plan.
-    float         entry_speed_sqr;
-    plan_block_t* next;
-    plan_block_t* current = &block_buffer[block_index];
+    float           entry_speed_sqr;
+    plan_ramp_t     exit_ramp;
+    plan_profile_t* next;
+    plan_profile_t* current = &block_profile[block_index];
     // Calculate maximum entry speed for last block in buffer, where the exit speed is always zero.
-    current->entry_speed_sqr = MIN(current->max_entry_speed_sqr, 2 * current->acceleration * current->millimeters);
-    block_index              = plan_prev_block_index(block_index);
+    if (block_ramp[block_index].jerk == 0.0) {
+        current->entry_speed_sqr = MIN(current->max_entry_speed_sqr, 2 * current->acceleration * current->millimeters);
+    } else {
+        plan_exit_ramp(block_buffer_head, &exit_ramp);
+        plan_s_curve_entry(current, &block_ramp[block_index], &exit_ramp);
+    }
+    block_index = plan_prev_block_index(block_index);
     if (block_index == block_buffer_planned) {  // Only two plannable blocks in buffer. Reverse pass complete.
         // Check if the first block is the tail. If so, notify stepper to update its current parameters.
         if (block_index == block_buffer_tail) {
@@ -148,15 +287,32 @@ static void planner_recalculate() {
         }
     } else {  // Three or more plan-able blocks
         while (block_index != block_buffer_planned) {
-            next        = current;
-            current     = &block_buffer[block_index];
-            block_index = plan_prev_block_index(block_index);
+            uint16_t current_index = block_index;
+            next                   = current;
+            current                = &block_profile[block_index];
+            block_index            = plan_prev_block_index(block_index);
             // Check if next block is the tail block(=planned block). If so, update current stepper parameters.
             if (block_index == block_buffer_tail) {
                 st_update_plan_block_parameters();
             }
-            // Compute maximum entry speed decelerating over the current block from its exit speed.
-            if (current->entry_speed_sqr != current->max_entry_speed_sqr) {
+            if (current->entry_speed_sqr == current->max_entry_speed_sqr) {
+                continue;
+            }
+            if (block_ramp[current_index].jerk != 0.0) {
+                plan_ramp_t* ramp            = &block_ramp[current_index];
+                plan_ramp_t  old_ramp        = *ramp;
+                float        old_entry_speed = current->entry_speed_sqr;
+                plan_exit_ramp(plan_next_block_index(current_index), &exit_ramp);
+                plan_s_curve_entry(current, ramp, &exit_ramp);
+                // Entry speeds only rise as blocks are added, by less at every block back. Stop where the
+                // rise is within the tolerance, keeping the plan the blocks before were planned from.
+                if (settle && current->entry_speed_sqr >= old_entry_speed && current->entry_speed_sqr <= old_entry_speed * settle_limit) {
+                    *ramp                    = old_ramp;
+                    current->entry_speed_sqr = old_entry_speed;
+                    break;
+                }
+            } else {
+                // Compute maximum entry speed decelerating over the current block from its exit speed.
                 entry_speed_sqr = next->entry_speed_sqr + 2 * current->acceleration * current->millimeters;
                 if (entry_speed_sqr < current->max_entry_speed_sqr) {
                     current->entry_speed_sqr = entry_speed_sqr;
@@ -168,11 +324,11 @@ static void planner_recalculate() {
     }
     // Forward Pass: Forward plan the acceleration curve from the planned pointer onward.
     // Also scans for optimal plan breakpoints and appropriately updates the planned pointer.
-    next        = &block_buffer[block_buffer_planned];  // Begin at buffer planned pointer
+    next        = &block_profile[block_buffer_planned];  // Begin at buffer planned pointer
     block_index = plan_next_block_index(block_buffer_planned);
     while (block_index != block_buffer_head) {
         current = next;
-        next    = &block_buffer[block_index];
+        next    = &block_profile[block_index];
         // Any acceleration detected in the forward pass automatically moves the optimal planned
         // pointer forward, since everything before this is all optimal. In other words, nothing
         // can improve the plan from the buffer tail to the planned pointer by logic.
@@ -181,7 +337,7 @@ static void planner_recalculate() {
             // If true, current block is full-acceleration and we can move the planned pointer forward.
             if (entry_speed_sqr < next->entry_speed_sqr) {
                 next->entry_speed_sqr = entry_speed_sqr;  // Always <= max_entry_speed_sqr. Backward pass sets this.
-                block_buffer_planned  = block_index;      // Set optimal plan pointer.
+                block_buffer_planned = block_index;  // Set optimal plan pointer.
             }
         }
         // Any block set at its maximum entry speed also creates an optimal plan up to this
@@ -195,26 +351,80 @@ static void planner_recalculate() {
     }
 }
 
+// Allocates the block ring buffer with the number of blocks in $Planner/Blocks. Called at
+// startup, after the settings are loaded; the buffer cannot be resized while blocks may be
+// queued, so a change to the setting takes effect at the next restart. Large buffers go to
+// PSRAM when the board has it, leaving internal RAM for everything else.
+void plan_init() {
+    free(block_buffer);
+    free(block_profile);
+    free(block_curve);
+    free(block_ramp);
+    block_buffer      = NULL;
+    block_curve       = NULL;
+    block_buffer_size = planner_blocks->get();
+    if (psramFound()) {
+        block_buffer = (plan_block_t*)ps_calloc(block_buffer_size, sizeof(plan_block_t));
+        block_curve  = (plan_curve_t*)ps_calloc(block_buffer_size, sizeof(plan_curve_t));
+    }
+    if (block_buffer == NULL) {
+        block_buffer = (plan_block_t*)calloc(block_buffer_size, sizeof(plan_block_t));
+    }
+    if (block_curve == NULL) {
+        block_curve = (plan_curve_t*)calloc(block_buffer_size, sizeof(plan_curve_t));
+    }
+    // The profiles and ramps are small and visited on every planned block, so they stay in internal RAM.
+    block_profile = (plan_profile_t*)calloc(block_buffer_size, sizeof(plan_profile_t));
+    block_ramp    = (plan_ramp_t*)calloc(block_buffer_size, sizeof(plan_ramp_t));
+    if (block_buffer == NULL || block_profile == NULL || block_curve == NULL || block_ramp == NULL) {
+        grbl_msg_sendf(CLIENT_SERIAL, MsgLevel::Error, "No memory for %d planner blocks", block_buffer_size);
+        free(block_buffer);
+        free(block_profile);
+        free(block_curve);
+        free(block_ramp);
+        block_buffer_size = BLOCK_BUFFER_SIZE;
+        block_buffer      = (plan_block_t*)calloc(block_buffer_size, sizeof(plan_block_t));
+        block_profile     = (plan_profile_t*)calloc(block_buffer_size, sizeof(plan_profile_t));
+        block_curve       = (plan_curve_t*)calloc(block_buffer_size, sizeof(plan_curve_t));
+        block_ramp        = (plan_ramp_t*)calloc(block_buffer_size, sizeof(plan_ramp_t));
+    }
+    grbl_msg_sendf(CLIENT_SERIAL, MsgLevel::Info, "Planner blocks %d", block_buffer_size);
+}
+
 void plan_reset() {
     memset(&pl, 0, sizeof(planner_t));  // Clear planner struct
     plan_reset_buffer();
 }
 
 void plan_reset_buffer() {
+    portENTER_CRITICAL(&plan_queue_spinlock);
     block_buffer_tail    = 0;
     block_buffer_head    = 0;  // Empty = tail
     next_buffer_head     = 1;  // plan_next_block_index(block_buffer_head)
     block_buffer_planned = 0;  // = block_buffer_tail;
+    queued_mm            = 0.0;
+    portEXIT_CRITICAL(&plan_queue_spinlock);
+    raster_head          = 0;
+    raster_tail.store(0);
 }
 
 void plan_discard_current_block() {
     if (block_buffer_head != block_buffer_tail) {  // Discard non-empty buffer.
-        uint8_t block_index = plan_next_block_index(block_buffer_tail);
+        uint16_t block_index = plan_next_block_index(block_buffer_tail);
         // Push block_buffer_planned pointer, if encountered.
         if (block_buffer_tail == block_buffer_planned) {
             block_buffer_planned = block_index;
         }
+        // The new tail's length is read from its profile, as segment prep counts it down. Rounding
+        // may leave a little over or under zero, until the buffer empties.
+        portENTER_CRITICAL(&plan_queue_spinlock);
         block_buffer_tail = block_index;
+        if (block_index == block_buffer_head) {
+            queued_mm = 0.0;
+        } else {
+            queued_mm = MAX(queued_mm - block_profile[block_index].millimeters, 0.0);
+        }
+        portEXIT_CRITICAL(&plan_queue_spinlock);
     }
 }
 
@@ -231,12 +441,204 @@ plan_block_t* plan_get_current_block() {
     return &block_buffer[block_buffer_tail];
 }
 
+// Returns the velocity profile of a block from plan_get_current_block() or plan_get_system_motion_block().
+plan_profile_t* plan_get_profile(plan_block_t* block) {
+    return &block_profile[block - block_buffer];
+}
+
+// Returns the S-curve ramp of a block from plan_get_current_block() or plan_get_system_motion_block().
+plan_ramp_t* plan_get_ramp(plan_block_t* block) {
+    return &block_ramp[block - block_buffer];
+}
+
+// Returns the curve of a block from plan_get_current_block() or plan_get_system_motion_block(), or
+// NULL if the block is a straight line.
+plan_curve_t* plan_get_curve(plan_block_t* block) {
+    plan_curve_t* curve = &block_curve[block - block_buffer];
+    return curve->type == PlCurve::Line ? NULL : curve;
+}
+
+// Finds the point on a spline at parameter t, and the direction of the spline there.
+static void plan_spline_point(plan_curve_t* curve, float t, float* point, float* tangent) {
+    auto& p = curve->spline.control;
+    float u = 1.0 - t;
+    for (uint8_t i = 0; i < 2; i++) {
+        point[i]   = 3 * u * u * t * p[0][i] + 3 * u * t * t * p[1][i] + t * t * t * p[2][i];
+        tangent[i] = 3 * u * u * p[0][i] + 6 * u * t * (p[1][i] - p[0][i]) + 3 * t * t * (p[2][i] - p[1][i]);
+    }
+}
+
+// Finds the point the given distance along a curve, relative to its start, and the direction of
+// the curve in the plane there.
+static void plan_curve_locate(plan_curve_t* curve, float millimeters, float* offset, float* tangent) {
+    float fraction = millimeters / curve->length;
+    float point[2];
+    if (curve->type == PlCurve::Arc) {
+        // Rotate the radius vector from the center to the start.
+        float angle = curve->arc.sweep * fraction;
+        float c     = cos(angle);
+        float s     = sin(angle);
+        float r_0   = -curve->arc.center[0];
+        float r_1   = -curve->arc.center[1];
+        point[0]    = curve->arc.center[0] + r_0 * c - r_1 * s;
+        point[1]    = curve->arc.center[1] + r_0 * s + r_1 * c;
+        tangent[0]  = -(r_0 * s + r_1 * c) * curve->arc.sweep;
+        tangent[1]  = (r_0 * c - r_1 * s) * curve->arc.sweep;
+    } else {
+        // Find the parameter by interpolating in the table of lengths.
+        float*  length = curve->spline.length;
+        float   target = fraction * curve->plane_length;
+        uint8_t i      = 0;
+        while (i < PLAN_SPLINE_SAMPLES - 1 && length[i + 1] < target) {
+            i++;
+        }
+        float span = length[i + 1] - length[i];
+        float t    = i + (span > 0.0 ? (target - length[i]) / span : 0.0);
+        plan_spline_point(curve, MIN(t / PLAN_SPLINE_SAMPLES, 1.0), point, tangent);
+    }
+    auto n_axis = number_axis->get();
+    for (uint8_t idx = 0; idx < n_axis; idx++) {
+        if (idx == curve->axis_0) {
+            offset[idx] = point[0];
+        } else if (idx == curve->axis_1) {
+            offset[idx] = point[1];
+        } else {
+            offset[idx] = curve->delta[idx] * fraction;
+        }
+    }
+}
+
+// Completes a curve from its geometry: its lengths, the tightest radius it bends around, and how
+// far its direction turns towards each plane axis.
+void plan_curve_measure(plan_curve_t* curve) {
+    if (curve->type == PlCurve::Arc) {
+        curve->radius       = hypot_f(curve->arc.center[0], curve->arc.center[1]);
+        curve->plane_length = fabs(curve->arc.sweep) * curve->radius;
+        // The direction is square to the radius, so it lies along axis_0 where the radius lies along
+        // axis_1, and the other way round. Between those points the ends reach furthest.
+        float start     = atan2(-curve->arc.center[1], -curve->arc.center[0]);
+        float end       = start + curve->arc.sweep;
+        curve->reach[0] = MAX(fabs(sin(start)), fabs(sin(end)));
+        curve->reach[1] = MAX(fabs(cos(start)), fabs(cos(end)));
+        for (uint8_t quadrant = 0; quadrant < 4; quadrant++) {
+            float turn = quadrant * M_PI / 2 - start;
+            if (curve->arc.sweep < 0) {
+                turn = -turn;
+            }
+            if (fmod(turn + 4 * M_PI, 2 * M_PI) < fabs(curve->arc.sweep)) {
+                curve->reach[quadrant % 2 == 0 ? 1 : 0] = 1.0;
+            }
+        }
+    } else {
+        // Sum chords over each interval of the length table. Take the radius of curvature,
+        // |B'|^3 / |B' x B''|, and the direction at each end of each chord.
+        auto& p = curve->spline.control;
+
+        const int chords      = 4;  // Chords per interval
+        float     previous[2] = { 0.0, 0.0 };
+        float     length      = 0.0;
+
+        curve->radius           = SOME_LARGE_VALUE;
+        curve->reach[0]         = 0.0;
+        curve->reach[1]         = 0.0;
+        for (int i = 0; i <= PLAN_SPLINE_SAMPLES * chords; i++) {
+            float t = float(i) / (PLAN_SPLINE_SAMPLES * chords);
+            float point[2], tangent[2], bend[2];
+            plan_spline_point(curve, t, point, tangent);
+            length += hypot_f(point[0] - previous[0], point[1] - previous[1]);
+            previous[0] = point[0];
+            previous[1] = point[1];
+            if (i % chords == 0) {
+                curve->spline.length[i / chords] = length;
+            }
+            for (uint8_t j = 0; j < 2; j++) {
+                bend[j] = 6 * (1.0 - t) * (p[1][j] - 2 * p[0][j]) + 6 * t * (p[2][j] - 2 * p[1][j] + p[0][j]);
+            }
+            float cross = fabs(tangent[0] * bend[1] - tangent[1] * bend[0]);
+            float speed = hypot_f(tangent[0], tangent[1]);
+            if (speed > 0.0) {
+                curve->reach[0] = MAX(curve->reach[0], fabs(tangent[0]) / speed);
+                curve->reach[1] = MAX(curve->reach[1], fabs(tangent[1]) / speed);
+                if (cross > 0.0) {
+                    curve->radius = MIN(curve->radius, speed * speed * speed / cross);
+                }
+            }
+        }
+        curve->plane_length = length;
+    }
+    float length_sqr = curve->plane_length * curve->plane_length;
+    auto  n_axis     = number_axis->get();
+    for (uint8_t idx = 0; idx < n_axis; idx++) {
+        length_sqr += curve->delta[idx] * curve->delta[idx];
+    }
+    curve->length = sqrt(length_sqr);
+}
+
+void plan_curve_point(plan_curve_t* curve, float millimeters, float* offset) {
+    float tangent[2];
+    plan_curve_locate(curve, millimeters, offset, tangent);
+}
+
+// Finds the unit vector of the path the given distance along a curve.
+static void plan_curve_direction(plan_curve_t* curve, float millimeters, float* unit_vec) {
+    float offset[MAX_N_AXIS], tangent[2];
+    plan_curve_locate(curve, millimeters, offset, tangent);
+    float magnitude = hypot_f(tangent[0], tangent[1]);
+    if (magnitude == 0.0) {
+        // A spline with a control point on an end point is still at the end. Look a little inside.
+        plan_curve_locate(curve, millimeters + (millimeters > 0.0 ? -0.01 : 0.01) * curve->length, offset, tangent);
+        magnitude = hypot_f(tangent[0], tangent[1]);
+    }
+    // The plane travels plane_length while the other axes travel their delta.
+    float scale  = curve->plane_length / magnitude;
+    auto  n_axis = number_axis->get();
+    for (uint8_t idx = 0; idx < n_axis; idx++) {
+        unit_vec[idx] = curve->delta[idx];
+    }
+    unit_vec[curve->axis_0] = tangent[0] * scale;
+    unit_vec[curve->axis_1] = tangent[1] * scale;
+    convert_delta_vector_to_unit_vector(unit_vec);
+}
+
+// Finds where a raster of the given number of pixels goes. Returns false if there is no room for it
+// yet. The head must not land on the tail, which would read as empty.
+static bool plan_raster_place(uint16_t count, uint16_t* at) {
+    uint16_t tail = raster_tail.load(std::memory_order_acquire);
+    *at           = raster_head;
+    if (tail <= raster_head) {
+        // The free space runs to the end of the buffer, then from the start up to the tail.
+        if (raster_head + count > RASTER_BUFFER_SIZE || (raster_head + count == RASTER_BUFFER_SIZE && tail == 0)) {
+            *at = 0;
+            return count < tail;
+        }
+        return true;
+    }
+    return raster_head + count < tail;
+}
+
+bool plan_check_raster_room(uint16_t count) {
+    uint16_t at;
+    return plan_raster_place(count, &at);
+}
+
+const uint8_t* plan_get_raster(plan_block_t* block) {
+    return block->raster_count ? &raster_buffer[block->raster_start] : NULL;
+}
+
+void plan_release_raster(uint16_t end) {
+    raster_tail.store(end == RASTER_BUFFER_SIZE ? 0 : end, std::memory_order_release);
+}
+
 float plan_get_exec_block_exit_speed_sqr() {
-    uint8_t block_index = plan_next_block_index(block_buffer_tail);
+    uint16_t block_index = plan_next_block_index(block_buffer_tail);
     if (block_index == block_buffer_head) {
         return 0.0f;
     }
-    return block_buffer[block_index].entry_speed_sqr;
+    return block_profile[block_index].entry_speed_sqr;
+}
+
+void plan_get_exec_block_exit_ramp(plan_ramp_t* ramp) {
+    plan_exit_ramp(plan_next_block_index(block_buffer_tail), ramp);
 }
 
 // Returns the availability status of the block ring buffer. True, if full.
@@ -266,29 +668,32 @@ float plan_compute_profile_nominal_speed(plan_block_t* block) {
 
 // Computes and updates the max entry speed (sqr) of the block, based on the minimum of the junction's
 // previous and current nominal speeds and max junction speed.
-static void plan_compute_profile_parameters(plan_block_t* block, float nominal_speed, float prev_nominal_speed) {
+static void plan_compute_profile_parameters(plan_block_t* block, plan_profile_t* profile, float nominal_speed, float prev_nominal_speed) {
     // Compute the junction maximum entry based on the minimum of the junction speed and neighboring nominal speeds.
     if (nominal_speed > prev_nominal_speed) {
-        block->max_entry_speed_sqr = prev_nominal_speed * prev_nominal_speed;
+        profile->max_entry_speed_sqr = prev_nominal_speed * prev_nominal_speed;
     } else {
-        block->max_entry_speed_sqr = nominal_speed * nominal_speed;
+        profile->max_entry_speed_sqr = nominal_speed * nominal_speed;
     }
 
-    if (block->max_entry_speed_sqr > block->max_junction_speed_sqr) {
-        block->max_entry_speed_sqr = block->max_junction_speed_sqr;
+    if (profile->max_entry_speed_sqr > block->max_junction_speed_sqr) {
+        profile->max_entry_speed_sqr = block->max_junction_speed_sqr;
     }
+    // Segment prep never runs a block faster than its nominal speed, so a ramp can run through a
+    // junction whose limit is only the nominal speed of the block before.
+    block_ramp[profile - block_profile].nominal_entry = profile->max_entry_speed_sqr >= prev_nominal_speed * prev_nominal_speed;
 }
 
 // Re-calculates buffered motions profile parameters upon a motion-based override change.
 void plan_update_velocity_profile_parameters() {
-    uint8_t       block_index = block_buffer_tail;
+    uint16_t      block_index = block_buffer_tail;
     plan_block_t* block;
     float         nominal_speed;
     float         prev_nominal_speed = SOME_LARGE_VALUE;  // Set high for first block nominal speed calculation.
     while (block_index != block_buffer_head) {
         block         = &block_buffer[block_index];
         nominal_speed = plan_compute_profile_nominal_speed(block);
-        plan_compute_profile_parameters(block, nominal_speed, prev_nominal_speed);
+        plan_compute_profile_parameters(block, &block_profile[block_index], nominal_speed, prev_nominal_speed);
         prev_nominal_speed = nominal_speed;
         block_index        = plan_next_block_index(block_index);
     }
@@ -297,8 +702,18 @@ void plan_update_velocity_profile_parameters() {
 
 uint8_t plan_buffer_line(float* target, plan_line_data_t* pl_data) {
     // Prepare and initialize new block. Copy relevant pl_data for block execution.
-    plan_block_t* block = &block_buffer[block_buffer_head];
+    plan_block_t*   block   = &block_buffer[block_buffer_head];
+    plan_profile_t* profile = &block_profile[block_buffer_head];
+    plan_curve_t*   curve   = &block_curve[block_buffer_head];
+    plan_ramp_t*    ramp    = &block_ramp[block_buffer_head];
     memset(block, 0, sizeof(plan_block_t));  // Zero all block values.
+    memset(profile, 0, sizeof(plan_profile_t));
+    memset(ramp, 0, sizeof(plan_ramp_t));
+    if (pl_data->curve != NULL) {
+        *curve = *pl_data->curve;
+    } else {
+        curve->type = PlCurve::Line;
+    }
     block->motion        = pl_data->motion;
     block->coolant       = pl_data->coolant;
     block->spindle       = pl_data->spindle;
@@ -332,32 +747,77 @@ uint8_t plan_buffer_line(float* target, plan_line_data_t* pl_data) {
             block->direction_bits |= bit(idx);
         }
     }
-    // Bail if this is a zero-length block. Highly unlikely to occur.
-    if (block->step_event_count == 0) {
+    // Bail if this is a zero-length block. Highly unlikely to occur. A full circle ends where it starts.
+    if (block->step_event_count == 0 && pl_data->curve == NULL) {
         return PLAN_EMPTY_BLOCK;
     }
+    // The caller waits for room with plan_check_raster_room(), so there is always room here. If
+    // not, that is a bug: the scanline is reported and not planned, rather than burned at one power.
+    if (pl_data->raster != NULL) {
+        if (!plan_raster_place(pl_data->raster->count, &block->raster_start)) {
+            grbl_msg_sendf(CLIENT_ALL, MsgLevel::Error, "No room for a raster of %d pixels", pl_data->raster->count);
+            return PLAN_EMPTY_BLOCK;
+        }
+        block->raster_count = pl_data->raster->count;
+        memcpy(&raster_buffer[block->raster_start], pl_data->raster->power, block->raster_count);
+        raster_head = block->raster_start + block->raster_count;
+        if (raster_head == RASTER_BUFFER_SIZE) {
+            raster_head = 0;
+        }
+    }
 
-    // Calculate the unit vector of the line move and the block maximum feed rate and acceleration scaled
-    // down such that no individual axes maximum values are exceeded with respect to the line direction.
-    // NOTE: This calculation assumes all axes are orthogonal (Cartesian) and works with ABC-axes,
-    // if they are also orthogonal/independent. Operates on the absolute value of the unit vector.
-    block->millimeters  = convert_delta_vector_to_unit_vector(unit_vec);
-    block->acceleration = limit_acceleration_by_axis_maximum(unit_vec);
-    block->rapid_rate   = limit_rate_by_axis_maximum(unit_vec);
+    if (pl_data->curve == NULL) {
+        // Calculate the unit vector of the line move and the block maximum feed rate and acceleration scaled
+        // down such that no individual axes maximum values are exceeded with respect to the line direction.
+        // NOTE: This calculation assumes all axes are orthogonal (Cartesian) and works with ABC-axes,
+        // if they are also orthogonal/independent. Operates on the absolute value of the unit vector.
+        profile->millimeters  = convert_delta_vector_to_unit_vector(unit_vec);
+        profile->acceleration = limit_acceleration_by_axis_maximum(unit_vec);
+        block->rapid_rate     = limit_rate_by_axis_maximum(unit_vec);
+        ramp->jerk            = limit_jerk_by_axis_maximum(unit_vec);
+    } else {
+        // The direction of a curve turns in its plane. Limit the block by the largest share of the
+        // motion each plane axis carries anywhere along it.
+        profile->millimeters = curve->length;
+        for (idx = 0; idx < n_axis; idx++) {
+            unit_vec[idx] = curve->delta[idx] / curve->length;
+        }
+        unit_vec[curve->axis_0] = curve->reach[0] * curve->plane_length / curve->length;
+        unit_vec[curve->axis_1] = curve->reach[1] * curve->plane_length / curve->length;
+        profile->acceleration   = limit_acceleration_by_axis_maximum(unit_vec);
+        block->rapid_rate       = limit_rate_by_axis_maximum(unit_vec);
+        ramp->jerk              = limit_jerk_by_axis_maximum(unit_vec);
+        // Centripetal acceleration limits the speed around the tightest bend. It acts square to the
+        // direction, so axis_0 carries as much of it as axis_1 carries of the motion, and the other way round.
+        float plane_acceleration = SOME_LARGE_VALUE;
+        if (curve->reach[1] > 0.0) {
+            plane_acceleration = axis_settings[curve->axis_0]->acceleration->get() / curve->reach[1];
+        }
+        if (curve->reach[0] > 0.0) {
+            plane_acceleration = MIN(plane_acceleration, axis_settings[curve->axis_1]->acceleration->get() / curve->reach[0]);
+        }
+        block->rapid_rate = MIN(block->rapid_rate, sqrt(plane_acceleration * SEC_PER_MIN_SQ * curve->radius));
+        // The junction with the previous block is at the start of the curve.
+        plan_curve_direction(curve, 0.0, unit_vec);
+    }
+    // Until the planner finds room to slow down through the block, its ramp ends at its entry.
+    ramp->accel_limit = profile->acceleration;
+    ramp->jerk_limit  = ramp->jerk;
     // Store programmed rate.
     if (block->motion.rapidMotion) {
         block->programmed_rate = block->rapid_rate;
     } else {
         block->programmed_rate = pl_data->feed_rate;
         if (block->motion.inverseTime) {
-            block->programmed_rate *= block->millimeters;
+            block->programmed_rate *= profile->millimeters;
         }
     }
     // TODO: Need to check this method handling zero junction speeds when starting from rest.
-    if ((block_buffer_head == block_buffer_tail) || (block->motion.systemMotion)) {
+    if ((block_buffer_head == block_buffer_tail) || (block->motion.systemMotion) || (block->motion.exactStop)) {
         // Initialize block entry speed as zero. Assume it will be starting from rest. Planner will correct this later.
         // If system motion, the system motion block always is assumed to start from rest and end at a complete stop.
-        block->entry_speed_sqr        = 0.0;
+        // In exact stop mode (G61.1), every block starts from rest.
+        profile->entry_speed_sqr      = 0.0;
         block->max_junction_speed_sqr = 0.0;  // Starting from rest. Enforce start from zero velocity.
     } else {
         // Compute maximum allowable entry speed at junction by centripetal acceleration approximation.
@@ -372,10 +832,9 @@ uint8_t plan_buffer_line(float* target, plan_line_data_t* pl_data) {
         //
         // NOTE: If the junction deviation value is finite, Grbl executes the motions in an exact path
         // mode (G61). If the junction deviation value is zero, Grbl will execute the motion in an exact
-        // stop mode (G61.1) manner. In the future, if continuous mode (G64) is desired, the math here
-        // is exactly the same. Instead of motioning all the way to junction point, the machine will
-        // just follow the arc circle defined here. The Arduino doesn't have the CPU cycles to perform
-        // a continuous mode path, but ARM-based microcontrollers most certainly do.
+        // stop mode (G61.1) manner. In continuous mode (G64), mc_blend_line() replaces the corner with
+        // the arc circle defined here before the lines reach the planner, so the junctions seen here
+        // are the shallow ones between the arc's chords.
         //
         // NOTE: The max junction speed is a fixed value, since machine acceleration limits cannot be
         // changed dynamically during operation nor can the line move geometry. This must be kept in
@@ -408,16 +867,24 @@ uint8_t plan_buffer_line(float* target, plan_line_data_t* pl_data) {
     // Block system motion from updating this data to ensure next g-code motion is computed correctly.
     if (!(block->motion.systemMotion)) {
         float nominal_speed = plan_compute_profile_nominal_speed(block);
-        plan_compute_profile_parameters(block, nominal_speed, pl.previous_nominal_speed);
+        plan_compute_profile_parameters(block, profile, nominal_speed, pl.previous_nominal_speed);
         pl.previous_nominal_speed = nominal_speed;
-        // Update previous path unit_vector and planner position.
+        // Update previous path unit_vector and planner position. A curve leaves in the direction it ends.
+        if (pl_data->curve != NULL) {
+            plan_curve_direction(curve, curve->length, unit_vec);
+        }
         memcpy(pl.previous_unit_vec, unit_vec, sizeof(unit_vec));  // pl.previous_unit_vec[] = unit_vec[]
         memcpy(pl.position, target_steps, sizeof(target_steps));   // pl.position[] = target_steps[]
         // New block is all set. Update buffer head and next buffer head indices.
+        portENTER_CRITICAL(&plan_queue_spinlock);
+        if (block_buffer_head != block_buffer_tail) {
+            queued_mm += profile->millimeters;
+        }
         block_buffer_head = next_buffer_head;
-        next_buffer_head  = plan_next_block_index(block_buffer_head);
+        portEXIT_CRITICAL(&plan_queue_spinlock);
+        next_buffer_head = plan_next_block_index(block_buffer_head);
         // Finish up by recalculating the plan with the new block.
-        planner_recalculate();
+        planner_recalculate(true);
     }
     return PLAN_OK;
 }
@@ -433,23 +900,51 @@ void plan_sync_position() {
     }
 }
 
+void plan_get_planner_mpos(float* target) {
+    uint8_t idx;
+    auto    n_axis = number_axis->get();
+    for (idx = 0; idx < n_axis; idx++) {
+        target[idx] = system_convert_axis_steps_to_mpos(pl.position, idx);
+    }
+}
+
 // Returns the number of available blocks are in the planner buffer.
-uint8_t plan_get_block_buffer_available() {
+uint16_t plan_get_block_buffer_available() {
     if (block_buffer_head >= block_buffer_tail) {
-        return (BLOCK_BUFFER_SIZE - 1) - (block_buffer_head - block_buffer_tail);
+        return (block_buffer_size - 1) - (block_buffer_head - block_buffer_tail);
     } else {
         return block_buffer_tail - block_buffer_head - 1;
     }
 }
 
-// Returns the number of active blocks are in the planner buffer.
-// NOTE: Deprecated. Not used unless classic status reports are enabled in config.h
-uint8_t plan_get_block_buffer_count() {
+// Returns the number of active blocks are in the planner buffer, i.e. the look-ahead depth.
+uint16_t plan_get_block_buffer_count() {
     if (block_buffer_head >= block_buffer_tail) {
         return block_buffer_head - block_buffer_tail;
     } else {
-        return BLOCK_BUFFER_SIZE - (block_buffer_tail - block_buffer_head);
+        return block_buffer_size - (block_buffer_tail - block_buffer_head);
+    }
+}
+
+// Returns the distance in mm left to travel through the blocks in the planner buffer,
+// including what remains of the block being executed, and the number of blocks it covers. The
+// client task calls it for status reports while the main task plans and discards blocks, so both
+// are taken under the lock that those hold while they move the head and tail.
+float plan_get_planned_distance(uint16_t* block_count) {
+    portENTER_CRITICAL(&plan_queue_spinlock);
+    uint16_t tail   = block_buffer_tail;
+    uint16_t head   = block_buffer_head;
+    float    queued = queued_mm;
+    portEXIT_CRITICAL(&plan_queue_spinlock);
+    if (head >= tail) {
+        *block_count = head - tail;
+    } else {
+        *block_count = block_buffer_size - (tail - head);
+    }
+    if (tail == head) {
+        return 0.0;
     }
+    return queued + MAX(block_profile[tail].millimeters, 0.0);
 }
 
 // Re-initialize buffer plan with a partially completed block, assumed to exist at the buffer tail.
@@ -458,5 +953,5 @@ void plan_cycle_reinitialize() {
     // Re-plan from a complete stop. Reset planner entry speeds and buffer planned pointer.
     st_update_plan_block_parameters();
     block_buffer_planned = block_buffer_tail;
-    planner_recalculate();
+    planner_recalculate(false);
 }
@@ -24,7 +24,8 @@
   along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
 */
 
-// The number of linear motions that can be in the plan at any give time
+// The default number of linear motions that can be in the plan at any give time. The
+// actual number is $Planner/Blocks, applied at startup.
 #ifndef BLOCK_BUFFER_SIZE
 #    ifdef USE_LINE_NUMBERS
 #        define BLOCK_BUFFER_SIZE 15
@@ -33,6 +34,12 @@
 #    endif
 #endif
 
+// The size of the buffer that holds the laser power of raster blocks, in pixels. A raster block can
+// have up to half of it.
+#ifndef RASTER_BUFFER_SIZE
+#    define RASTER_BUFFER_SIZE 1024
+#endif
+
 // Returned status message from planner.
 const int PLAN_OK          = true;
 const int PLAN_EMPTY_BLOCK = false;
@@ -43,6 +50,7 @@ struct PlMotion {
     uint8_t systemMotion : 1;    // Single motion. Circumvents planner state. Used by home/park.
     uint8_t noFeedOverride : 1;  // Motion does not honor feed override.
     uint8_t inverseTime : 1;     // Interprets feed rate value as inverse time when set.
+    uint8_t exactStop : 1;       // Motion starts from rest. Set by G61.1.
 };
 
 // This struct stores a linear movement of a g-code block motion with its critical "nominal" values
@@ -62,14 +70,7 @@ typedef struct {
     int32_t line_number;  // Block line number for real-time reporting. Copied from pl_line_data.
 #endif
 
-    // Fields used by the motion planner to manage acceleration. Some of these values may be updated
-    // by the stepper module during execution of special motion cases for replanning purposes.
-    float entry_speed_sqr;      // The current planned entry speed at block junction in (mm/min)^2
-    float max_entry_speed_sqr;  // Maximum allowable entry speed based on the minimum of junction limit and
-    //   neighboring nominal speeds with overrides in (mm/min)^2
-    float acceleration;  // Axis-limit adjusted line acceleration in (mm/min^2). Does not change.
-    float millimeters;   // The remaining distance for this block to be executed in (mm).
-    // NOTE: This value may be altered by stepper algorithm during execution.
+    // The velocity profile fields used by planner_recalculate() are kept apart, in plan_profile_t.
 
     // Stored rate limiting data used by planner when changes occur.
     float max_junction_speed_sqr;  // Junction entry speed limit based on direction vectors in (mm/min)^2
@@ -79,22 +80,99 @@ typedef struct {
     // Stored spindle speed data used by spindle overrides and resuming methods.
     float spindle_speed;  // Block spindle speed. Copied from pl_line_data.
     //#endif
+
+    // The pixels of a raster block stay in the raster buffer until the stepper ISR has run them.
+    uint16_t raster_start;  // Index of the first pixel in the raster buffer
+    uint16_t raster_count;  // Number of pixels. Zero if the block is not a raster.
 } plan_block_t;
 
+// The fields used by the motion planner to manage acceleration. planner_recalculate() visits these
+// for many blocks each time a block is added, and nothing else in plan_block_t, so they are stored
+// in an array of their own, parallel to the block buffer. The passes then read 16 contiguous bytes
+// per block instead of striding over whole blocks. Some of these values may be updated by the
+// stepper module during execution of special motion cases for replanning purposes.
+typedef struct {
+    float entry_speed_sqr;      // The current planned entry speed at block junction in (mm/min)^2
+    float max_entry_speed_sqr;  // Maximum allowable entry speed based on the minimum of junction limit and
+    //   neighboring nominal speeds with overrides in (mm/min)^2
+    float acceleration;  // Axis-limit adjusted line acceleration in (mm/min^2). Does not change.
+    float millimeters;   // The remaining distance for this block to be executed in (mm).
+    // NOTE: This value may be altered by stepper algorithm during execution.
+} plan_profile_t;
+
+// The S-curve deceleration ramp that a block's entry speed is planned for. An S-curve starts and ends
+// at zero acceleration, so a ramp split at every block would bring the acceleration back to zero at
+// each junction. Instead, the entry speed of a block with a jerk is planned for one S-curve that
+// slows down to the end speed at a point that may be several blocks ahead, and segment prep follows
+// that same ramp through the blocks. Kept in an array parallel to the block buffer, like the profiles.
+typedef struct {
+    float jerk;           // Axis-limit adjusted jerk of the block in (mm/min^3). Zero for linear ramps.
+    float end_speed;      // Speed at the end of the ramp through the block entry (mm/min)
+    float end_mm;         // Distance from the block entry to the end of the ramp (mm)
+    float accel_limit;    // Lowest acceleration (mm/min^2) and jerk (mm/min^3) of the blocks the
+    float jerk_limit;     //   ramp runs through, including this one
+    bool  nominal_entry;  // The entry speed limit is the nominal speed of the block before
+} plan_ramp_t;
+
+// A curved path for a planner block. G2/G3 arcs and G5 splines are planned as one block each,
+// instead of as many short lines, and segment prep follows the curve itself. The curve lies in
+// the plane of axis_0 and axis_1. Any other axis moves in proportion to the distance along the
+// curve, as in a helix. Positions are relative to the start of the block.
+enum class PlCurve : uint8_t {
+    Line = 0,  // A straight line. Not a curve. (Must be zero)
+    Arc,
+    Spline,  // Cubic Bezier
+};
+
+const int PLAN_SPLINE_SAMPLES = 8;  // Intervals in the length table of a spline
+
+typedef struct {
+    PlCurve type;
+    uint8_t axis_0;
+    uint8_t axis_1;
+    float   length;             // Length of the path, counting every axis (mm)
+    float   plane_length;       // Length of the path in the plane (mm)
+    float   radius;             // Smallest radius of curvature in the plane (mm)
+    float   reach[2];           // Largest share of the plane travel on axis_0 and axis_1 at any point
+    float   delta[MAX_N_AXIS];  // Travel of the axes outside the plane (mm)
+    union {
+        struct {
+            float center[2];  // Center of the circle
+            float sweep;      // Angle turned, counterclockwise positive (radians)
+        } arc;
+        struct {
+            float control[3][2];                    // Control points 1 to 3. Point 0 is the start.
+            float length[PLAN_SPLINE_SAMPLES + 1];  // Plane length up to each sample of the curve parameter
+        } spline;
+    };
+} plan_curve_t;
+
+// A laser raster: a straight line cut into pixels of equal length, each burned at its own power.
+// The power of a pixel is its share of the block spindle speed, 255 being all of it. The stepper
+// ISR changes the power as the axis with the most steps crosses from one pixel to the next, so a
+// whole scanline takes one planner block instead of a block for each pixel.
+typedef struct {
+    const uint8_t* power;  // One byte for each pixel, from the start of the line
+    uint16_t       count;  // Number of pixels. At most RASTER_BUFFER_SIZE / 2.
+} plan_raster_t;
+
 // Planner data prototype. Must be used when passing new motions to the planner.
 typedef struct {
-    float        feed_rate;      // Desired feed rate for line motion. Value is ignored, if rapid motion.
-    uint32_t     spindle_speed;  // Desired spindle speed through line motion.
-    PlMotion     motion;         // Bitflag variable to indicate motion conditions. See defines above.
-    SpindleState spindle;        // Spindle enable state
-    CoolantState coolant;        // Coolant state
+    float          feed_rate;      // Desired feed rate for line motion. Value is ignored, if rapid motion.
+    uint32_t       spindle_speed;  // Desired spindle speed through line motion.
+    PlMotion       motion;         // Bitflag variable to indicate motion conditions. See defines above.
+    SpindleState   spindle;        // Spindle enable state
+    CoolantState   coolant;        // Coolant state
 #ifdef USE_LINE_NUMBERS
     int32_t line_number;  // Desired line number to report when executing.
 #endif
-    bool         is_jog;         // true if this was generated due to a jog command
+    bool           is_jog;         // true if this was generated due to a jog command
+    plan_curve_t*  curve;          // The path to the target, or NULL for a straight line
+    plan_raster_t* raster;         // The pixels of a straight line, or NULL
 } plan_line_data_t;
 
 // Initialize and reset the motion plan subsystem
+void plan_init();          // Allocate the block buffer. Once, at startup.
 void plan_reset();         // Reset all
 void plan_reset_buffer();  // Reset buffer only.
 
@@ -113,12 +191,40 @@ plan_block_t* plan_get_system_motion_block();
 // Gets the current block. Returns NULL if buffer empty
 plan_block_t* plan_get_current_block();
 
+// Gets the velocity profile of a block from the buffer
+plan_profile_t* plan_get_profile(plan_block_t* block);
+
+// Gets the S-curve ramp of a block from the buffer
+plan_ramp_t* plan_get_ramp(plan_block_t* block);
+
+// Gets the curve of a block from the buffer, or NULL if the block is a straight line
+plan_curve_t* plan_get_curve(plan_block_t* block);
+
+// Fills in the lengths and radius of a curve from its geometry. The delta of the plane axes must be zero.
+void plan_curve_measure(plan_curve_t* curve);
+
+// Finds the point the given distance along a curve, relative to its start
+void plan_curve_point(plan_curve_t* curve, float millimeters, float* offset);
+
+// Returns true if the raster buffer has room for a raster of the given number of pixels.
+bool plan_check_raster_room(uint16_t count);
+
+// Gets the pixels of a block from the buffer, or NULL if the block is not a raster
+const uint8_t* plan_get_raster(plan_block_t* block);
+
+// Frees the raster buffer up to the end of a raster. Called by the stepper ISR after its last pixel.
+void plan_release_raster(uint16_t end);
+
 // Called periodically by step segment buffer. Mostly used internally by planner.
-uint8_t plan_next_block_index(uint8_t block_index);
+uint16_t plan_next_block_index(uint16_t block_index);
 
 // Called by step segment buffer when computing executing block velocity profile.
 float plan_get_exec_block_exit_speed_sqr();
 
+// Called by step segment buffer for the S-curve ramp through the end of the executing block, with
+// end_mm measured from the end of the block.
+void plan_get_exec_block_exit_ramp(plan_ramp_t* ramp);
+
 // Called by main program during planner calculations and step segment buffer during initialization.
 float plan_compute_profile_nominal_speed(plan_block_t* block);
 
@@ -132,13 +238,17 @@ void plan_sync_position();
 void plan_cycle_reinitialize();
 
 // Returns the number of available blocks are in the planner buffer.
-uint8_t plan_get_block_buffer_available();
+uint16_t plan_get_block_buffer_available();
+
+// Returns the number of active blocks are in the planner buffer, i.e. the look-ahead depth.
+uint16_t plan_get_block_buffer_count();
 
-// Returns the number of active blocks are in the planner buffer.
-// NOTE: Deprecated. Not used unless classic status reports are enabled in config.h
-uint8_t plan_get_block_buffer_count();
+// Returns the distance in mm left to travel through the blocks in the planner buffer, and the
+// number of those blocks, taken together.
+float plan_get_planned_distance(uint16_t* block_count);
 
 // Returns the status of the block ring buffer. True, if buffer is full.
 uint8_t plan_check_full_buffer();
 
+// Returns the planner position in mm, in motor coordinates. This is where the last planned line ends.
 void plan_get_planner_mpos(float* target);
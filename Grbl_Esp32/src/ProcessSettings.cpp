@@ -284,6 +284,49 @@ Error get_report_build_info(const char* value, WebUI::AuthenticationLevel auth_l
     }
     return Error::InvalidStatement;
 }
+Error report_stepper_stats(const char* value, WebUI::AuthenticationLevel auth_level, WebUI::ESPResponseStream* out) {
+    st_buffer_stats_t stats = st_get_buffer_stats();
+    grbl_sendf(out->client(),
+               "[MSG: Segments %d at %d Hz, high water %d, low water %d, underruns %d]\r\n",
+               stats.size,
+               stats.rate,
+               stats.high_water,
+               stats.low_water,
+               stats.underruns);
+    return Error::Ok;
+}
+Error stream_status(const char* value, WebUI::AuthenticationLevel auth_level, WebUI::ESPResponseStream* out) {
+    uint8_t client = out->client();
+    if (client >= CLIENT_COUNT) {
+        return Error::InvalidStatement;
+    }
+    if (!value) {
+        grbl_sendf(client, "$RS=%d,%d\r\n", report_status_stream_rate(client), report_status_stream_mask(client));
+        return Error::Ok;
+    }
+    // $RS=rate[,mask], the mask defaulting to $10
+    char*   endptr = NULL;
+    int32_t rate   = strtol(value, &endptr, 10);
+    int32_t mask   = status_mask->get();
+    if (endptr == value) {
+        return Error::BadNumberFormat;
+    }
+    if (*endptr == ',') {
+        const char* s = endptr + 1;
+        mask          = strtol(s, &endptr, 10);
+        if (endptr == s) {
+            return Error::BadNumberFormat;
+        }
+    }
+    if (*endptr) {
+        return Error::BadNumberFormat;
+    }
+    if (rate < 0 || rate > STATUS_STREAM_MAX_RATE || mask < 0 || mask > (RtStatus::Position | RtStatus::Buffer)) {
+        return Error::NumberRange;
+    }
+    report_status_stream(client, rate, mask);
+    return Error::Ok;
+}
 Error report_startup_lines(const char* value, WebUI::AuthenticationLevel auth_level, WebUI::ESPResponseStream* out) {
     report_startup_line(0, startup_line_0->get(), out->client());
     report_startup_line(1, startup_line_1->get(), out->client());
@@ -445,6 +488,8 @@ void make_grbl_commands() {
     new GrblCommand("X", "Alarm/Disable", disable_alarm_lock, anyState);
     new GrblCommand("NVX", "Settings/Erase", Setting::eraseNVS, idleOrAlarm, WA);
     new GrblCommand("V", "Settings/Stats", Setting::report_nvs_stats, idleOrAlarm);
+    new GrblCommand("ST", "Stepper/Stats", report_stepper_stats, anyState);
+    new GrblCommand("RS", "Report/Stream", stream_status, anyState);
     new GrblCommand("#", "GCode/Offsets", report_ngc, idleOrAlarm);
     new GrblCommand("H", "Home", home_all, idleOrAlarm);
     new GrblCommand("MD", "Motor/Disable", motor_disable, idleOrAlarm);
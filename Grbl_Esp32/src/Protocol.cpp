@@ -32,48 +32,6 @@ static uint8_t line_flags           = 0;
 static uint8_t char_counter         = 0;
 static uint8_t comment_char_counter = 0;
 
-typedef struct {
-    char buffer[LINE_BUFFER_SIZE];
-    int  len;
-    int  line_number;
-} client_line_t;
-client_line_t client_lines[CLIENT_COUNT];
-
-static void empty_line(uint8_t client) {
-    client_line_t* cl = &client_lines[client];
-    cl->len           = 0;
-    cl->buffer[0]     = '\0';
-}
-static void empty_lines() {
-    for (uint8_t client = 0; client < CLIENT_COUNT; client++) {
-        empty_line(client);
-    }
-}
-
-Error add_char_to_line(char c, uint8_t client) {
-    client_line_t* cl = &client_lines[client];
-    // Simple editing for interactive input
-    if (c == '\b') {
-        // Backspace erases
-        if (cl->len) {
-            --cl->len;
-            cl->buffer[cl->len] = '\0';
-        }
-        return Error::Ok;
-    }
-    if (cl->len == (LINE_BUFFER_SIZE - 1)) {
-        return Error::Overflow;
-    }
-    if (c == '\r' || c == '\n') {
-        cl->len = 0;
-        cl->line_number++;
-        return Error::Eol;
-    }
-    cl->buffer[cl->len++] = c;
-    cl->buffer[cl->len]   = '\0';
-    return Error::Ok;
-}
-
 Error execute_line(char* line, uint8_t client, WebUI::AuthenticationLevel auth_level) {
     Error result = Error::Ok;
     // Empty or comment line. For syncing purposes.
@@ -82,6 +40,7 @@ Error execute_line(char* line, uint8_t client, WebUI::AuthenticationLevel auth_l
     }
     // Grbl '$' or WebUI '[ESPxxx]' system command
     if (line[0] == '$' || line[0] == '[') {
+        mc_flush();  // Finish the g-code path before acting on it.
         return system_execute_line(line, client, auth_level);
     }
     // Everything else is gcode. Block if in alarm or jog mode.
@@ -104,7 +63,6 @@ bool can_park() {
 */
 void protocol_main_loop() {
     client_reset_read_buffer(CLIENT_ALL);
-    empty_lines();
     //uint8_t client = CLIENT_SERIAL; // default client
     // Perform some machine checks to make sure everything is good to go.
 #ifdef CHECK_LIMITS_AT_INIT
@@ -135,7 +93,6 @@ void protocol_main_loop() {
     // Primary loop! Upon a system abort, this exits back to main() to reset the system.
     // This is also where Grbl idles while waiting for something to do.
     // ---------------------------------------------------------------------------------
-    int c;
     for (;;) {
 #ifdef ENABLE_SD_CARD
         if (SD_ready_next) {
@@ -151,42 +108,49 @@ void protocol_main_loop() {
             }
         }
 #endif
-        // Receive one line of incoming serial data, as the data becomes available.
+        // Receive the lines of incoming serial data, as they become complete.
         // Filtering, if necessary, is done later in gc_execute_line(), so the
         // filtering is the same with serial and file input.
         uint8_t client = CLIENT_SERIAL;
         char*   line;
+        Error   res;
         for (client = 0; client < CLIENT_COUNT; client++) {
-            while ((c = client_read(client)) != -1) {
-                Error res = add_char_to_line(c, client);
+            while ((res = client_get_line(client, &line)) != Error::Ok) {
                 switch (res) {
-                    case Error::Ok:
-                        break;
                     case Error::Eol:
                         protocol_execute_realtime();  // Runtime command check point.
                         if (sys.abort) {
                             return;  // Bail to calling function upon system abort
                         }
-                        line = client_lines[client].buffer;
 #ifdef REPORT_ECHO_RAW_LINE_RECEIVED
                         report_echo_line_received(line, client);
+#endif
+#ifdef ENABLE_BINARY_FRAMES
+                        if (line[0] == FRAME_START) {
+                            frame_execute_line(line, client);  // Answered with a frame, not "ok"
+                            break;
+                        }
 #endif
                         // auth_level can be upgraded by supplying a password on the command line
                         report_status_message(execute_line(line, client, WebUI::AuthenticationLevel::LEVEL_GUEST), client);
-                        empty_line(client);
                         break;
                     case Error::Overflow:
                         report_status_message(Error::Overflow, client);
-                        empty_line(client);
                         break;
                     default:
                         break;
                 }
-            }  // while serial read
+                client_release_line(client);
+            }  // while lines
         }      // for clients
         // If there are no more characters in the serial read buffer to be processed and executed,
         // this indicates that g-code streaming has either filled the planner buffer or has
         // completed. In either case, auto-cycle start, if enabled, any queued moves.
+        // Lines held for G64 blending or merging are released once the planner runs low, so a host
+        // that waits for each ok does not starve the machine.
+        if (plan_get_block_buffer_count() <= 1) {
+            mc_flush();
+        }
         protocol_auto_cycle_start();
         protocol_execute_realtime();  // Runtime command check point.
         if (sys.abort) {
@@ -205,6 +169,7 @@ void protocol_main_loop() {
 // Block until all buffered steps are executed or in a cycle state. Works with feed hold
 // during a synchronize call, if it should happen. Also, waits for clean cycle end.
 void protocol_buffer_synchronize() {
+    mc_flush();  // Lines held for blending or merging have to run too.
     // If system is queued, ensure cycle resumes if the auto start flag is present.
     protocol_auto_cycle_start();
     do {
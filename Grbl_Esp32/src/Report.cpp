@@ -54,6 +54,10 @@ EspClass esp;
 #endif
 const int DEFAULTBUFFERSIZE = 64;
 
+// The longest text grbl_sendf(), grbl_msg_sendf() and grbl_notifyf() send: an echoed line and the
+// brackets around it. Longer text is cut short rather than put on the heap.
+static const int SEND_BUFFER_SIZE = LINE_BUFFER_SIZE + 64;
+
 void grbl_send(uint8_t client, const char* text) {
     client_write(client, text);
 }
@@ -63,26 +67,12 @@ void grbl_sendf(uint8_t client, const char* format, ...) {
     if (client == CLIENT_INPUT) {
         return;
     }
-    char    loc_buf[64];
-    char*   temp = loc_buf;
+    char    buf[SEND_BUFFER_SIZE];
     va_list arg;
-    va_list copy;
     va_start(arg, format);
-    va_copy(copy, arg);
-    size_t len = vsnprintf(NULL, 0, format, arg);
-    va_end(copy);
-    if (len >= sizeof(loc_buf)) {
-        temp = new char[len + 1];
-        if (temp == NULL) {
-            return;
-        }
-    }
-    len = vsnprintf(temp, len + 1, format, arg);
-    grbl_send(client, temp);
+    vsnprintf(buf, sizeof(buf), format, arg);
     va_end(arg);
-    if (temp != loc_buf) {
-        delete[] temp;
-    }
+    grbl_send(client, buf);
 }
 // Use to send [MSG:xxxx] Type messages. The level allows messages to be easily suppressed
 void grbl_msg_sendf(uint8_t client, MsgLevel level, const char* format, ...) {
@@ -96,26 +86,20 @@ void grbl_msg_sendf(uint8_t client, MsgLevel level, const char* format, ...) {
         }
     }
 
-    char    loc_buf[100];
-    char*   temp = loc_buf;
-    va_list arg;
-    va_list copy;
+    static const char prefix[] = "[MSG:";
+    static const char suffix[] = "]\r\n";
+    char              buf[SEND_BUFFER_SIZE];
+    va_list           arg;
     va_start(arg, format);
-    va_copy(copy, arg);
-    size_t len = vsnprintf(NULL, 0, format, arg);
-    va_end(copy);
-    if (len >= sizeof(loc_buf)) {
-        temp = new char[len + 1];
-        if (temp == NULL) {
-            return;
-        }
-    }
-    len = vsnprintf(temp, len + 1, format, arg);
-    grbl_sendf(client, "[MSG:%s]\r\n", temp);
+    int len = vsnprintf(buf + strlen(prefix), sizeof(buf) - strlen(prefix) - strlen(suffix), format, arg);
     va_end(arg);
-    if (temp != loc_buf) {
-        delete[] temp;
+    if (len < 0) {
+        return;
     }
+    len = MIN(len, int(sizeof(buf) - strlen(prefix) - strlen(suffix) - 1));
+    memcpy(buf, prefix, strlen(prefix));
+    strcpy(buf + strlen(prefix) + len, suffix);
+    grbl_send(client, buf);
 }
 
 //function to notify
@@ -126,72 +110,113 @@ void grbl_notify(const char* title, const char* msg) {
 }
 
 void grbl_notifyf(const char* title, const char* format, ...) {
-    char    loc_buf[64];
-    char*   temp = loc_buf;
+    char    buf[SEND_BUFFER_SIZE];
     va_list arg;
-    va_list copy;
     va_start(arg, format);
-    va_copy(copy, arg);
-    size_t len = vsnprintf(NULL, 0, format, arg);
-    va_end(copy);
-    if (len >= sizeof(loc_buf)) {
-        temp = new char[len + 1];
-        if (temp == NULL) {
-            return;
-        }
-    }
-    len = vsnprintf(temp, len + 1, format, arg);
-    grbl_notify(title, temp);
+    vsnprintf(buf, sizeof(buf), format, arg);
     va_end(arg);
-    if (temp != loc_buf) {
-        delete[] temp;
+    grbl_notify(title, buf);
+}
+
+ReportWriter::ReportWriter(char* buf, size_t size) : _buf(buf), _size(size), _len(0) {
+    _buf[0] = '\0';
+}
+
+void ReportWriter::add(const char* text) {
+    while (*text && _len < _size - 1) {
+        _buf[_len++] = *text++;
     }
+    _buf[_len] = '\0';
 }
 
-static const int coordStringLen = 20;
-static const int axesStringLen  = coordStringLen * MAX_N_AXIS;
+void ReportWriter::add(char c) {
+    if (_len < _size - 1) {
+        _buf[_len++] = c;
+        _buf[_len]   = '\0';
+    }
+}
 
-// formats axis values into a string and returns that string in rpt
-// NOTE: rpt should have at least size: axesStringLen
-static void report_util_axis_values(float* axis_value, char* rpt) {
-    uint8_t     idx;
-    char        axisVal[coordStringLen];
-    float       unit_conv = 1.0;      // unit conversion multiplier..default is mm
-    const char* format    = "%4.3f";  // Default - report mm to 3 decimal places
-    rpt[0]                = '\0';
-    if (report_inches->get()) {
-        unit_conv = 1.0 / MM_PER_INCH;
-        format    = "%4.4f";  // Report inches to 4 decimal places
+// Adds the value in decimal, with at least the given number of digits.
+void ReportWriter::add_uint(uint32_t value, int digits) {
+    char text[11];
+    int  at  = sizeof(text) - 1;
+    text[at] = '\0';
+    do {
+        text[--at] = '0' + value % 10;
+        value /= 10;
+    } while (value || sizeof(text) - 1 - at < size_t(digits));
+    add(&text[at]);
+}
+
+void ReportWriter::add_int(int32_t value) {
+    if (value < 0) {
+        add('-');
+        add_uint(0 - uint32_t(value), 1);
+    } else {
+        add_uint(value, 1);
     }
-    auto n_axis = number_axis->get();
-    for (idx = 0; idx < n_axis; idx++) {
-        snprintf(axisVal, coordStringLen - 1, format, axis_value[idx] * unit_conv);
-        strcat(rpt, axisVal);
-        if (idx < (number_axis->get() - 1)) {
-            strcat(rpt, ",");
+}
+
+void ReportWriter::add_fixed(float value, int decimals) {
+    static const uint32_t scale[] = { 1, 10, 100, 1000, 10000 };
+
+    // The float is exactly mantissa * 2^-shift. Scaled by 10^decimals, that fits 64 bits, and shifting
+    // it down gives the digits, rounded half to even as printf() rounds them.
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    int      exponent = (bits >> 23) & 0xff;
+    uint64_t mantissa = bits & 0x7fffff;
+    if (exponent >= 127 + 18) {
+        // Too large for 32 bits of digits, or not a number. Not seen in reports.
+        char text[48];
+        snprintf(text, sizeof(text), "%.*f", decimals, value);
+        add(text);
+        return;
+    }
+    if (exponent == 0) {
+        exponent = 1;  // Subnormal
+    } else {
+        mantissa |= 0x800000;
+    }
+    int      shift  = 150 - exponent;
+    uint64_t scaled = mantissa * scale[decimals];
+    uint32_t whole  = 0;
+    if (shift < 64) {
+        uint64_t rest = scaled & ((uint64_t(1) << shift) - 1);
+        uint64_t half = uint64_t(1) << (shift - 1);
+        whole         = scaled >> shift;
+        if (rest > half || (rest == half && (whole & 1))) {
+            whole++;
         }
     }
+    if (bits >> 31) {
+        add('-');
+    }
+    add_uint(whole / scale[decimals], 1);
+    if (decimals > 0) {
+        add('.');
+        add_uint(whole % scale[decimals], decimals);
+    }
 }
 
-// This version returns the axis values as a String
-static String report_util_axis_values(const float* axis_value) {
-    String  rpt = "";
-    uint8_t idx;
-    char    axisVal[coordStringLen];
-    float   unit_conv = 1.0;  // unit conversion multiplier..default is mm
-    int     decimals  = 3;    // Default - report mm to 3 decimal places
+static const int coordStringLen = 20;
+static const int axesStringLen  = coordStringLen * MAX_N_AXIS;
+
+// Adds axis values, in the report units, separated by commas.
+static void report_util_axis_values(ReportWriter& rpt, const float* axis_value) {
+    float unit_conv = 1.0;  // unit conversion multiplier..default is mm
+    int   decimals  = 3;    // Default - report mm to 3 decimal places
     if (report_inches->get()) {
         unit_conv = 1.0 / MM_PER_INCH;
         decimals  = 4;  // Report inches to 4 decimal places
     }
     auto n_axis = number_axis->get();
-    for (idx = 0; idx < n_axis; idx++) {
-        rpt += String(axis_value[idx] * unit_conv, decimals);
-        if (idx < (number_axis->get() - 1)) {
-            rpt += ",";
+    for (int idx = 0; idx < n_axis; idx++) {
+        if (idx > 0) {
+            rpt.add(',');
         }
+        rpt.add_fixed(axis_value[idx] * unit_conv, decimals);
     }
-    return rpt;
 }
 
 // Handles the primary confirmation protocol response for streaming interfaces and human-feedback.
@@ -299,43 +324,45 @@ void report_grbl_help(uint8_t client) {
 // These values are retained until Grbl is power-cycled, whereby they will be re-zeroed.
 void report_probe_parameters(uint8_t client) {
     // Report in terms of machine position.
-    char probe_rpt[(axesStringLen + 13 + 6 + 1)];  // the probe report we are building here
-    char temp[axesStringLen];
-    strcpy(probe_rpt, "[PRB:");  // initialize the string with the first characters
+    char         buf[axesStringLen + 16];
+    ReportWriter probe_rpt(buf, sizeof(buf));  // the probe report we are building here
+    probe_rpt.add("[PRB:");
     // get the machine position and put them into a string and append to the probe report
     float print_position[MAX_N_AXIS];
     system_convert_array_steps_to_mpos(print_position, sys_probe_position);
-    report_util_axis_values(print_position, temp);
-    strcat(probe_rpt, temp);
+    report_util_axis_values(probe_rpt, print_position);
     // add the success indicator and add closing characters
-    sprintf(temp, ":%d]\r\n", sys.probe_succeeded);
-    strcat(probe_rpt, temp);
-    grbl_send(client, probe_rpt);  // send the report
+    probe_rpt.add(':');
+    probe_rpt.add_int(sys.probe_succeeded);
+    probe_rpt.add("]\r\n");
+    grbl_send(client, probe_rpt.c_str());  // send the report
 }
 
 // Prints Grbl NGC parameters (coordinate offsets, probing)
 void report_ngc_parameters(uint8_t client) {
-    String ngc_rpt = "";
+    char buf[axesStringLen + 16];
 
     // Print persistent offsets G54 - G59, G28, and G30
     for (auto coord_select = CoordIndex::Begin; coord_select < CoordIndex::End; ++coord_select) {
-        ngc_rpt += "[";
-        ngc_rpt += coords[coord_select]->getName();
-        ngc_rpt += ":";
-        ngc_rpt += report_util_axis_values(coords[coord_select]->get());
-        ngc_rpt += "]\r\n";
-    }
-    ngc_rpt += "[G92:";  // Print non-persistent G92,G92.1
-    ngc_rpt += report_util_axis_values(gc_state.coord_offset);
-    ngc_rpt += "]\r\n";
-    ngc_rpt += "[TLO:";  // Print tool length offset
+        ReportWriter ngc_rpt(buf, sizeof(buf));
+        ngc_rpt.add('[');
+        ngc_rpt.add(coords[coord_select]->getName());
+        ngc_rpt.add(':');
+        report_util_axis_values(ngc_rpt, coords[coord_select]->get());
+        ngc_rpt.add("]\r\n");
+        grbl_send(client, ngc_rpt.c_str());
+    }
+    ReportWriter ngc_rpt(buf, sizeof(buf));
+    ngc_rpt.add("[G92:");  // Print non-persistent G92,G92.1
+    report_util_axis_values(ngc_rpt, gc_state.coord_offset);
+    ngc_rpt.add("]\r\n");
+    ngc_rpt.add("[TLO:");  // Print tool length offset
     float tlo = gc_state.tool_length_offset;
     if (report_inches->get()) {
         tlo *= INCH_PER_MM;
     }
-    ngc_rpt += String(tlo, 3);
-    ;
-    ngc_rpt += "]\r\n";
+    ngc_rpt.add_fixed(tlo, 3);
+    ngc_rpt.add("]\r\n");
     grbl_send(client, ngc_rpt.c_str());
     report_probe_parameters(client);
 }
@@ -343,7 +370,7 @@ void report_ngc_parameters(uint8_t client) {
 // Print current gcode parser mode state
 void report_gcode_modes(uint8_t client) {
     char        temp[20];
-    char        modes_rpt[75];
+    char        modes_rpt[90];
     const char* mode = "";
     strcpy(modes_rpt, "[GC:");
 
@@ -363,6 +390,9 @@ void report_gcode_modes(uint8_t client) {
         case Motion::CcwArc:
             mode = "G3";
             break;
+        case Motion::CubicSpline:
+            mode = "G5";
+            break;
         case Motion::ProbeToward:
             mode = "G38.1";
             break;
@@ -432,6 +462,19 @@ void report_gcode_modes(uint8_t client) {
     }
     strcat(modes_rpt, mode);
 
+    switch (gc_state.modal.control) {
+        case ControlMode::ExactPath:
+            mode = " G61";
+            break;
+        case ControlMode::ExactStop:
+            mode = " G61.1";
+            break;
+        case ControlMode::Continuous:
+            mode = " G64";
+            break;
+    }
+    strcat(modes_rpt, mode);
+
     //report_util_gcode_modes_M();
     switch (gc_state.modal.program_flow) {
         case ProgramFlow::Running:
@@ -575,31 +618,109 @@ void report_echo_line_received(char* line, uint8_t client) {
 // float wco            = returns the work coordinate offset
 // bool wpos            = true for work position compensation
 
-// Prints real-time data. This function grabs a real-time snapshot of the stepper subprogram
-// and the actual location of the CNC machine. Users may change the following function to their
-// specific needs, but the desired real-time data report must be as short as possible. This is
-// requires as it minimizes the computational overhead and allows grbl to keep running smoothly,
-// especially during g-code programs with fast, short line segments and high frequency reports (5-20Hz).
-void report_realtime_status(uint8_t client) {
-    char status[200];
-    char temp[MAX_N_AXIS * 20];
+// The fast changing state a status report shows, read at one instant. The streamed reports of a
+// tick are all made from one snapshot, so every client sees the machine at the same time.
+typedef struct {
+    char     state[10];
+    float    mpos[MAX_N_AXIS];
+    int      blocks_available;
+    uint16_t blocks_queued;
+    float    planned;  // Distance the look-ahead covers (mm)
+    uint32_t line_number;
+    float    rate;  // mm/min
+    uint32_t spindle_speed;
+    bool     wco;  // The work coordinate offset is due in this report
+    bool     ovr;  // The overrides are due in this report
+} status_snapshot_t;
+
+// Reports are streamed to each client at its own rate, with its own choice of fields.
+typedef struct {
+    uint16_t period_ms;  // Zero when the client is not streaming
+    uint8_t  mask;       // RtStatus fields, as status_mask
+    uint32_t next_ms;    // millis() the next report is due
+} status_stream_t;
+static status_stream_t status_streams[CLIENT_COUNT];
+
+static void report_status_snapshot(status_snapshot_t* snap) {
+    strcpy(snap->state, report_state_text());
+    memcpy(snap->mpos, system_get_mpos(), sizeof(snap->mpos));
+    snap->blocks_available = plan_get_block_buffer_available();
+    snap->planned          = plan_get_planned_distance(&snap->blocks_queued);
+    snap->line_number      = 0;
+#ifdef USE_LINE_NUMBERS
+    plan_block_t* cur_block = plan_get_current_block();
+    if (cur_block != NULL) {
+        snap->line_number = cur_block->line_number;
+    }
+#endif
+    snap->rate          = st_get_realtime_rate();
+    snap->spindle_speed = sys.spindle_speed;
+
+    snap->wco = false;
+#ifdef REPORT_FIELD_WORK_COORD_OFFSET
+    if (sys.report_wco_counter > 0) {
+        sys.report_wco_counter--;
+    } else {
+        switch (sys.state) {
+            case State::Homing:
+            case State::Cycle:
+            case State::Hold:
+            case State::Jog:
+            case State::SafetyDoor:
+                sys.report_wco_counter = (REPORT_WCO_REFRESH_BUSY_COUNT - 1);  // Reset counter for slow refresh
+            default:
+                sys.report_wco_counter = (REPORT_WCO_REFRESH_IDLE_COUNT - 1);
+                break;
+        }
+        if (sys.report_ovr_counter == 0) {
+            sys.report_ovr_counter = 1;  // Set override on next report.
+        }
+        snap->wco = true;
+    }
+#endif
+    snap->ovr = false;
+#ifdef REPORT_FIELD_OVERRIDES
+    if (sys.report_ovr_counter > 0) {
+        sys.report_ovr_counter--;
+    } else {
+        switch (sys.state) {
+            case State::Homing:
+            case State::Cycle:
+            case State::Hold:
+            case State::Jog:
+            case State::SafetyDoor:
+                sys.report_ovr_counter = (REPORT_OVR_REFRESH_BUSY_COUNT - 1);  // Reset counter for slow refresh
+            default:
+                sys.report_ovr_counter = (REPORT_OVR_REFRESH_IDLE_COUNT - 1);
+                break;
+        }
+        snap->ovr = true;
+    }
+#endif
+}
 
-    strcpy(status, "<");
-    strcat(status, report_state_text());
+// Formats a status report of the snapshot, with the fields in mask, for the client. Users may
+// change this function to their specific needs, but the desired real-time data report must be as
+// short as possible. This is requires as it minimizes the computational overhead and allows grbl
+// to keep running smoothly, especially during g-code programs with fast, short line segments and
+// high frequency reports (5-20Hz).
+static void report_status_format(ReportWriter& status, const status_snapshot_t* snap, uint8_t mask, uint8_t client) {
+    status.add('<');
+    status.add(snap->state);
 
     // Report position
-    float* print_position = system_get_mpos();
-    if (bit_istrue(status_mask->get(), RtStatus::Position)) {
-        strcat(status, "|MPos:");
+    float print_position[MAX_N_AXIS];
+    memcpy(print_position, snap->mpos, sizeof(print_position));
+    if (bit_istrue(mask, RtStatus::Position)) {
+        status.add("|MPos:");
     } else {
-        strcat(status, "|WPos:");
+        status.add("|WPos:");
         mpos_to_wpos(print_position);
     }
-    report_util_axis_values(print_position, temp);
-    strcat(status, temp);
+    report_util_axis_values(status, print_position);
     // Returns planner and serial read buffer states.
 #ifdef REPORT_FIELD_BUFFER_STATE
-    if (bit_istrue(status_mask->get(), RtStatus::Buffer)) {
+    if (bit_istrue(mask, RtStatus::Buffer)) {
         int bufsize = DEFAULTBUFFERSIZE;
 #    if defined(ENABLE_WIFI) && defined(ENABLE_TELNET)
         if (client == CLIENT_TELNET) {
@@ -615,153 +736,139 @@ void report_realtime_status(uint8_t client) {
         if (client == CLIENT_SERIAL) {
             bufsize = client_get_rx_buffer_available(CLIENT_SERIAL);
         }
-        sprintf(temp, "|Bf:%d,%d", plan_get_block_buffer_available(), bufsize);
-        strcat(status, temp);
+        status.add("|Bf:");
+        status.add_int(snap->blocks_available);
+        status.add(',');
+        status.add_int(bufsize);
+    }
+#endif
+#ifdef REPORT_FIELD_PLANNER_STATE
+    // Returns the look-ahead depth in blocks and the distance it covers.
+    if (bit_istrue(mask, RtStatus::Buffer)) {
+        float planned = snap->planned;
+        if (report_inches->get()) {
+            planned *= INCH_PER_MM;
+        }
+        status.add("|Pl:");
+        status.add_int(snap->blocks_queued);
+        status.add(',');
+        status.add_fixed(planned, 1);
     }
 #endif
 #ifdef USE_LINE_NUMBERS
 #    ifdef REPORT_FIELD_LINE_NUMBERS
     // Report current line number
-    plan_block_t* cur_block = plan_get_current_block();
-    if (cur_block != NULL) {
-        uint32_t ln = cur_block->line_number;
-        if (ln > 0) {
-            sprintf(temp, "|Ln:%d", ln);
-            strcat(status, temp);
-        }
+    if (snap->line_number > 0) {
+        status.add("|Ln:");
+        status.add_int(snap->line_number);
     }
 #    endif
 #endif
     // Report realtime feed speed
 #ifdef REPORT_FIELD_CURRENT_FEED_SPEED
+    status.add("|FS:");
     if (report_inches->get()) {
-        sprintf(temp, "|FS:%.1f,%d", st_get_realtime_rate() / MM_PER_INCH, sys.spindle_speed);
+        status.add_fixed(snap->rate / MM_PER_INCH, 1);
     } else {
-        sprintf(temp, "|FS:%.0f,%d", st_get_realtime_rate(), sys.spindle_speed);
+        status.add_fixed(snap->rate, 0);
     }
-    strcat(status, temp);
+    status.add(',');
+    status.add_int(snap->spindle_speed);
 #endif
 #ifdef REPORT_FIELD_PIN_STATE
     AxisMask    lim_pin_state  = limits_get_state();
     ControlPins ctrl_pin_state = system_control_get_state();
     bool        prb_pin_state  = probe_get_state();
     if (lim_pin_state || ctrl_pin_state.value || prb_pin_state) {
-        strcat(status, "|Pn:");
+        status.add("|Pn:");
         if (prb_pin_state) {
-            strcat(status, "P");
+            status.add('P');
         }
         if (lim_pin_state) {
             auto n_axis = number_axis->get();
             if (n_axis >= 1 && bit_istrue(lim_pin_state, bit(X_AXIS))) {
-                strcat(status, "X");
+                status.add('X');
             }
             if (n_axis >= 2 && bit_istrue(lim_pin_state, bit(Y_AXIS))) {
-                strcat(status, "Y");
+                status.add('Y');
             }
             if (n_axis >= 3 && bit_istrue(lim_pin_state, bit(Z_AXIS))) {
-                strcat(status, "Z");
+                status.add('Z');
             }
             if (n_axis >= 4 && bit_istrue(lim_pin_state, bit(A_AXIS))) {
-                strcat(status, "A");
+                status.add('A');
             }
             if (n_axis >= 5 && bit_istrue(lim_pin_state, bit(B_AXIS))) {
-                strcat(status, "B");
+                status.add('B');
             }
             if (n_axis >= 6 && bit_istrue(lim_pin_state, bit(C_AXIS))) {
-                strcat(status, "C");
+                status.add('C');
             }
         }
         if (ctrl_pin_state.value) {
             if (ctrl_pin_state.bit.safetyDoor) {
-                strcat(status, "D");
+                status.add('D');
             }
             if (ctrl_pin_state.bit.reset) {
-                strcat(status, "R");
+                status.add('R');
             }
             if (ctrl_pin_state.bit.feedHold) {
-                strcat(status, "H");
+                status.add('H');
             }
             if (ctrl_pin_state.bit.cycleStart) {
-                strcat(status, "S");
+                status.add('S');
             }
             if (ctrl_pin_state.bit.macro0) {
-                strcat(status, "0");
+                status.add('0');
             }
             if (ctrl_pin_state.bit.macro1) {
-                strcat(status, "1");
+                status.add('1');
             }
             if (ctrl_pin_state.bit.macro2) {
-                strcat(status, "2");
+                status.add('2');
             }
             if (ctrl_pin_state.bit.macro3) {
-                strcat(status, "3");
+                status.add('3');
             }
         }
     }
 #endif
 #ifdef REPORT_FIELD_WORK_COORD_OFFSET
-    if (sys.report_wco_counter > 0) {
-        sys.report_wco_counter--;
-    } else {
-        switch (sys.state) {
-            case State::Homing:
-            case State::Cycle:
-            case State::Hold:
-            case State::Jog:
-            case State::SafetyDoor:
-                sys.report_wco_counter = (REPORT_WCO_REFRESH_BUSY_COUNT - 1);  // Reset counter for slow refresh
-            default:
-                sys.report_wco_counter = (REPORT_WCO_REFRESH_IDLE_COUNT - 1);
-                break;
-        }
-        if (sys.report_ovr_counter == 0) {
-            sys.report_ovr_counter = 1;  // Set override on next report.
-        }
-        strcat(status, "|WCO:");
-        report_util_axis_values(get_wco(), temp);
-        strcat(status, temp);
+    if (snap->wco) {
+        status.add("|WCO:");
+        report_util_axis_values(status, get_wco());
     }
 #endif
 #ifdef REPORT_FIELD_OVERRIDES
-    if (sys.report_ovr_counter > 0) {
-        sys.report_ovr_counter--;
-    } else {
-        switch (sys.state) {
-            case State::Homing:
-            case State::Cycle:
-            case State::Hold:
-            case State::Jog:
-            case State::SafetyDoor:
-                sys.report_ovr_counter = (REPORT_OVR_REFRESH_BUSY_COUNT - 1);  // Reset counter for slow refresh
-            default:
-                sys.report_ovr_counter = (REPORT_OVR_REFRESH_IDLE_COUNT - 1);
-                break;
-        }
-
-        sprintf(temp, "|Ov:%d,%d,%d", sys.f_override, sys.r_override, sys.spindle_speed_ovr);
-        strcat(status, temp);
+    if (snap->ovr) {
+        status.add("|Ov:");
+        status.add_int(sys.f_override);
+        status.add(',');
+        status.add_int(sys.r_override);
+        status.add(',');
+        status.add_int(sys.spindle_speed_ovr);
         SpindleState sp_state      = spindle->get_state();
         CoolantState coolant_state = coolant_get_state();
         if (sp_state != SpindleState::Disable || coolant_state.Mist || coolant_state.Flood) {
-            strcat(status, "|A:");
+            status.add("|A:");
             switch (sp_state) {
                 case SpindleState::Disable:
                     break;
                 case SpindleState::Cw:
-                    strcat(status, "S");
+                    status.add('S');
                     break;
                 case SpindleState::Ccw:
-                    strcat(status, "C");
+                    status.add('C');
                     break;
             }
 
             auto coolant = coolant_state;
             if (coolant.Flood) {
-                strcat(status, "F");
+                status.add('F');
             }
 #    ifdef COOLANT_MIST_PIN  // TODO Deal with M8 - Flood
             if (coolant.Mist) {
-                strcat(status, "M");
+                status.add('M');
             }
 #    endif
         }
@@ -769,18 +876,85 @@ void report_realtime_status(uint8_t client) {
 #endif
 #ifdef ENABLE_SD_CARD
     if (get_sd_state(false) == SDState::BusyPrinting) {
-        sprintf(temp, "|SD:%4.2f,", sd_report_perc_complete());
-        strcat(status, temp);
-        sd_get_current_filename(temp);
-        strcat(status, temp);
+        char filename[128];
+        status.add("|SD:");
+        status.add_fixed(sd_report_perc_complete(), 2);
+        status.add(',');
+        sd_get_current_filename(filename);
+        status.add(filename);
     }
 #endif
 #ifdef REPORT_HEAP
-    sprintf(temp, "|Heap:%d", esp.getHeapSize());
-    strcat(status, temp);
+    status.add("|Heap:");
+    status.add_int(esp.getHeapSize());
 #endif
-    strcat(status, ">\r\n");
-    grbl_send(client, status);
+    status.add(">\r\n");
+}
+
+// Prints real-time data. This function grabs a real-time snapshot of the stepper subprogram
+// and the actual location of the CNC machine.
+void report_realtime_status(uint8_t client) {
+    status_snapshot_t snap;
+    char              buf[256];
+    ReportWriter      status(buf, sizeof(buf));
+    report_status_snapshot(&snap);
+    report_status_format(status, &snap, status_mask->get(), client);
+    grbl_send(client, status.c_str());
+}
+
+void report_status_stream(uint8_t client, uint32_t rate, uint8_t mask) {
+    status_streams[client].mask      = mask;
+    status_streams[client].next_ms   = millis();
+    status_streams[client].period_ms = rate ? 1000 / rate : 0;
+}
+
+uint32_t report_status_stream_rate(uint8_t client) {
+    uint16_t period_ms = status_streams[client].period_ms;
+    return period_ms ? 1000 / period_ms : 0;
+}
+
+uint8_t report_status_stream_mask(uint8_t client) {
+    return status_streams[client].mask;
+}
+
+void report_status_streams() {
+    uint32_t now = millis();
+    uint8_t  due = 0;
+    for (uint8_t client = 0; client < CLIENT_COUNT; client++) {
+        status_stream_t* stream = &status_streams[client];
+        if (stream->period_ms && int32_t(now - stream->next_ms) >= 0) {
+            due |= bit(client);
+            stream->next_ms += stream->period_ms;
+            if (int32_t(now - stream->next_ms) >= 0) {
+                stream->next_ms = now + stream->period_ms;  // Fell behind. Skip the reports missed.
+            }
+        }
+    }
+    if (!due) {
+        return;
+    }
+
+    status_snapshot_t snap;
+    char              buf[256];
+    report_status_snapshot(&snap);
+    for (uint8_t client = 0; client < CLIENT_COUNT; client++) {
+        if (!(due & bit(client))) {
+            continue;
+        }
+        uint8_t      mask = status_streams[client].mask;
+        ReportWriter status(buf, sizeof(buf));
+        report_status_format(status, &snap, mask, client);
+        grbl_send(client, status.c_str());
+        // Clients that show the same fields get the same report. The buffer field is the client's own.
+        if (bit_isfalse(mask, RtStatus::Buffer)) {
+            for (uint8_t other = client + 1; other < CLIENT_COUNT; other++) {
+                if ((due & bit(other)) && status_streams[other].mask == mask) {
+                    grbl_send(other, status.c_str());
+                    due &= ~bit(other);
+                }
+            }
+        }
+    }
 }
 
 void report_realtime_steps() {
@@ -61,6 +61,28 @@ enum class MsgLevel : int8_t {  // Use $Message/Level
     Verbose = 5,
 };
 
+// Builds a line of report text in a buffer of the caller's, without the heap or printf, so that
+// reports can be made often from any task. Text that does not fit is dropped, and the buffer
+// always holds a terminated string.
+class ReportWriter {
+private:
+    char*  _buf;
+    size_t _size;
+    size_t _len;
+
+    void add_uint(uint32_t value, int digits);
+
+public:
+    ReportWriter(char* buf, size_t size);
+
+    void add(const char* text);
+    void add(char c);
+    void add_int(int32_t value);
+    void add_fixed(float value, int decimals);  // As printf("%.*f"), for 0 to 4 decimals
+
+    const char* c_str() const { return _buf; }
+};
+
 // functions to send data to the user.
 void grbl_send(uint8_t client, const char* text);
 void grbl_sendf(uint8_t client, const char* format, ...);
@@ -95,6 +117,16 @@ void report_echo_line_received(char* line, uint8_t client);
 // Prints realtime status report
 void report_realtime_status(uint8_t client);
 
+const int STATUS_STREAM_MAX_RATE = 50;  // Hz
+
+// Streams status reports to a client at rate Hz, with the RtStatus fields in mask. Zero stops it.
+void     report_status_stream(uint8_t client, uint32_t rate, uint8_t mask);
+uint32_t report_status_stream_rate(uint8_t client);
+uint8_t  report_status_stream_mask(uint8_t client);
+
+// Sends the streamed status reports that are due. Called often from the client task.
+void report_status_streams();
+
 // Prints recorded probe position
 void report_probe_parameters(uint8_t client);
 
@@ -48,9 +48,13 @@
 
   To allow the realtime commands to be randomly mixed in the stream of data, we
   read all clients as fast as possible. The realtime commands are acted upon and the other charcters are
-  placed into a client_buffer[client].
+  framed into lines in a client_buffer[client].
 
-  The main protocol loop reads from client_buffer[]
+  The main protocol loop takes whole lines from client_buffer[]. Each buffer has one writer,
+  clientCheckTask(), and one reader, the protocol loop, so it needs no lock (see LineRing.h).
+
+  Output goes the other way through client_tx. client_write() queues it and clientTxTask() sends
+  it, so a slow Bluetooth or WiFi client does not hold up the task that wrote (see TxQueue.h).
 
 
 */
@@ -63,20 +67,25 @@
 // testing is complete.
 // #define REVERT_TO_ARDUINO_SERIAL
 
-portMUX_TYPE myMutex = portMUX_INITIALIZER_UNLOCKED;
-
 static TaskHandle_t clientCheckTaskHandle = 0;
+static TaskHandle_t clientTxTaskHandle    = 0;
 
-WebUI::InputBuffer client_buffer[CLIENT_COUNT];  // create a buffer for each client
+LineRing client_buffer[CLIENT_COUNT];  // create a buffer for each client
+TxQueue  client_tx;                    // Output waiting for the clients
 
-// Returns the number of bytes available in a client buffer.
-uint8_t client_get_rx_buffer_available(uint8_t client) {
+// Returns the number of bytes a client can send before its input is left with the driver. The
+// driver buffer counts only for what is already in it, not for its free space, since realtime
+// characters in it wait until clientCheckTask() can read the input ahead of them.
+int client_get_rx_buffer_available(uint8_t client) {
+    int room = client_buffer[client].room();
+    if (client == CLIENT_SERIAL) {
 #ifdef REVERT_TO_ARDUINO_SERIAL
-    return 128 - Serial.available();
+        room -= Serial.available();
 #else
-    return 128 - Uart0.available();
+        room -= Uart0.available();
 #endif
-    //    return client_buffer[client].availableforwrite();
+    }
+    return room > 0 ? room : 0;
 }
 
 void heapCheckTask(void* pvParameters) {
@@ -107,8 +116,21 @@ void client_init() {
     client_reset_read_buffer(CLIENT_ALL);
     Serial.write("\r\n");  // create some white space after ESP32 boot info
 #else
+#    ifdef SERIAL_HIGH_SPEED_BAUD
+    static_assert(SERIAL_HIGH_SPEED_BAUD >= 921600 && SERIAL_HIGH_SPEED_BAUD <= 2000000, "SERIAL_HIGH_SPEED_BAUD is out of range");
+#    endif
+#    if defined(SERIAL_RTS_PIN) && defined(SERIAL_CTS_PIN)
+    Uart0.setPins(1, 3, SERIAL_RTS_PIN, SERIAL_CTS_PIN);  // Tx 1, Rx 3 - standard hardware pins
+#    else
     Uart0.setPins(1, 3);  // Tx 1, Rx 3 - standard hardware pins
-    Uart0.begin(BAUD_RATE, Uart::Data::Bits8, Uart::Stop::Bits1, Uart::Parity::None);
+#    endif
+    Uart0.setBufferSizes(RX_BUFFER_SIZE, SERIAL_TX_BUFFER_SIZE);
+    Uart0.begin(SERIAL_BAUD_RATE, Uart::Data::Bits8, Uart::Stop::Bits1, Uart::Parity::None);
+#    if defined(SERIAL_RTS_PIN) && defined(SERIAL_CTS_PIN)
+    // RTS stops the sender when the hardware FIFO is nearly full, which it only gets when the
+    // driver buffer behind it is full.
+    Uart0.setHwFlowCtrl(UART_FIFO_LEN - 16);
+#    endif
 
     client_reset_read_buffer(CLIENT_ALL);
     Uart0.write("\r\n");  // create some white space after ESP32 boot info
@@ -126,25 +148,39 @@ void client_init() {
                             SUPPORT_TASK_CORE  // must run the task on same core
                                                // core
     );
+    // The output task waits on slow clients, so that the tasks that write to them do not.
+    xTaskCreatePinnedToCore(clientTxTask,    // task
+                            "clientTxTask",  // name for task
+                            4096,            // size of task stack
+                            NULL,            // parameters
+                            1,               // priority
+                            &clientTxTaskHandle,
+                            SUPPORT_TASK_CORE  // must run the task on same core
+                                               // core
+    );
 }
 
+// A source is read while its line buffer is full, into the pending characters of the buffer, so
+// that the realtime characters behind a long run of g-code are still acted on. Input is left with
+// its source only when those are full too, which a sender that waits for its acknowledgements
+// never reaches (see LINE_PENDING_SIZE).
 static uint8_t getClientChar(uint8_t* data) {
     int res;
 #ifdef REVERT_TO_ARDUINO_SERIAL
-    if (client_buffer[CLIENT_SERIAL].availableforwrite() && (res = Serial.read()) != -1) {
+    if (client_buffer[CLIENT_SERIAL].ready() && (res = Serial.read()) != -1) {
 #else
-    if (client_buffer[CLIENT_SERIAL].availableforwrite() && (res = Uart0.read()) != -1) {
+    if (client_buffer[CLIENT_SERIAL].ready() && (res = Uart0.read()) != -1) {
 #endif
         *data = res;
         return CLIENT_SERIAL;
     }
-    if (WebUI::inputBuffer.available()) {
+    if (client_buffer[CLIENT_INPUT].ready() && WebUI::inputBuffer.available()) {
         *data = WebUI::inputBuffer.read();
         return CLIENT_INPUT;
     }
     //currently is wifi or BT but better to prepare both can be live
 #ifdef ENABLE_BLUETOOTH
-    if (WebUI::SerialBT.hasClient()) {
+    if (client_buffer[CLIENT_BT].ready() && WebUI::SerialBT.hasClient()) {
         if ((res = WebUI::SerialBT.read()) != -1) {
             *data = res;
             return CLIENT_BT;
@@ -152,13 +188,13 @@ static uint8_t getClientChar(uint8_t* data) {
     }
 #endif
 #if defined(ENABLE_WIFI) && defined(ENABLE_HTTP) && defined(ENABLE_SERIAL2SOCKET_IN)
-    if (WebUI::Serial2Socket.available()) {
+    if (client_buffer[CLIENT_WEBUI].ready() && WebUI::Serial2Socket.available()) {
         *data = WebUI::Serial2Socket.read();
         return CLIENT_WEBUI;
     }
 #endif
 #if defined(ENABLE_WIFI) && defined(ENABLE_TELNET)
-    if (WebUI::telnet_server.available()) {
+    if (client_buffer[CLIENT_TELNET].ready() && WebUI::telnet_server.available()) {
         *data = WebUI::telnet_server.read();
         return CLIENT_TELNET;
     }
@@ -182,9 +218,7 @@ void clientCheckTask(void* pvParameters) {
 #if defined(ENABLE_SD_CARD)
                 if (get_sd_state(false) < SDState::Busy) {
 #endif  //ENABLE_SD_CARD
-                    vTaskEnterCritical(&myMutex);
-                    client_buffer[client].write(data);
-                    vTaskExitCritical(&myMutex);
+                    client_buffer[client].put(data);
 #if defined(ENABLE_SD_CARD)
                 } else {
                     if (data == '\r' || data == '\n') {
@@ -195,6 +229,7 @@ void clientCheckTask(void* pvParameters) {
 #endif  //ENABLE_SD_CARD
             }
         }  // if something available
+        report_status_streams();
         WebUI::COMMANDS::handle();
 #ifdef ENABLE_WIFI
         WebUI::wifi_config.handle();
@@ -217,17 +252,18 @@ void clientCheckTask(void* pvParameters) {
 void client_reset_read_buffer(uint8_t client) {
     for (uint8_t client_num = 0; client_num < CLIENT_COUNT; client_num++) {
         if (client == client_num || client == CLIENT_ALL) {
-            client_buffer[client_num].begin();
+            client_buffer[client_num].reset();
         }
     }
 }
 
-// Fetches the first byte in the client read buffer. Called by protocol loop.
-int client_read(uint8_t client) {
-    vTaskEnterCritical(&myMutex);
-    int data = client_buffer[client].read();
-    vTaskExitCritical(&myMutex);
-    return data;
+// Fetches the next line in the client read buffer. Called by protocol loop.
+Error client_get_line(uint8_t client, char** line) {
+    return client_buffer[client].get(line);
+}
+
+void client_release_line(uint8_t client) {
+    client_buffer[client].release();
 }
 
 // checks to see if a character is a realtime character
@@ -346,31 +382,116 @@ void execute_realtime_command(Cmd command, uint8_t client) {
     }
 }
 
-void client_write(uint8_t client, const char* text) {
-    if (client == CLIENT_INPUT) {
-        return;
-    }
+// Sends text to one client. Only clientTxTask() sends, once the task is running.
+static void client_transmit(uint8_t client, const char* text, size_t len) {
 #ifdef ENABLE_BLUETOOTH
-    if (WebUI::SerialBT.hasClient() && (client == CLIENT_BT || client == CLIENT_ALL)) {
-        WebUI::SerialBT.print(text);
-        //delay(10); // possible fix for dropped characters
+    if (client == CLIENT_BT && WebUI::SerialBT.hasClient()) {
+        WebUI::SerialBT.write((const uint8_t*)text, len);
     }
 #endif
 #if defined(ENABLE_WIFI) && defined(ENABLE_HTTP) && defined(ENABLE_SERIAL2SOCKET_OUT)
-    if (client == CLIENT_WEBUI || client == CLIENT_ALL) {
-        WebUI::Serial2Socket.write((const uint8_t*)text, strlen(text));
+    if (client == CLIENT_WEBUI) {
+        WebUI::Serial2Socket.write((const uint8_t*)text, len);
     }
 #endif
 #if defined(ENABLE_WIFI) && defined(ENABLE_TELNET)
-    if (client == CLIENT_TELNET || client == CLIENT_ALL) {
-        WebUI::telnet_server.write((const uint8_t*)text, strlen(text));
+    if (client == CLIENT_TELNET) {
+        WebUI::telnet_server.write((const uint8_t*)text, len);
     }
 #endif
-    if (client == CLIENT_SERIAL || client == CLIENT_ALL) {
+    if (client == CLIENT_SERIAL) {
 #ifdef REVERT_TO_ARDUINO_SERIAL
-        Serial.write(text);
+        Serial.write((const uint8_t*)text, len);
 #else
-        Uart0.write(text);
+        Uart0.write(text, len);
+#endif
+    }
+}
+
+// Sends the queued output, a slot for each client in turn, so that a slow client holds up the
+// others for no more than one slot at a time.
+void clientTxTask(void* pvParameters) {
+    char buf[TX_SLOT_SIZE];
+    while (true) {
+        bool sent = false;
+        for (uint8_t client = 0; client < CLIENT_COUNT; client++) {
+            size_t len = client_tx.get(client, buf);
+            if (len) {
+                client_transmit(client, buf, len);
+                sent = true;
+            }
+        }
+        if (!sent) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);  // Until client_write() queues more
+        }
+    }
+}
+
+// Queues text for clientTxTask() to send to the client, or to all of them. The text is copied
+// once, however many clients it goes to. When the queue of a client is full:
+// - a status report is dropped, as another will soon follow;
+// - a message to all clients is dropped for that client, so that a slow client cannot hold up the
+//   task that writes, and motion with it;
+// - a message to one client waits for room for as long as it takes. Those are the client's own
+//   replies, and a sender that counts them stalls for good if one is lost. This is their flow
+//   control, as a blocking write to the UART was. A client that goes away does not hold it up:
+//   clientTxTask() still takes its output, and drops it.
+// Only the tasks that answer a client wait, which are the protocol loop and clientCheckTask().
+// clientTxTask() must never write, as it would wait on itself. Text from an interrupt, such as
+// the hard limit and reset messages, never waits: it is dropped for a client with no room, as a
+// message to all clients is.
+void client_write(uint8_t client, const char* text) {
+    if (client == CLIENT_INPUT) {
+        return;
+    }
+    size_t len    = strlen(text);
+    bool   in_isr = xPortInIsrContext();
+    if (!clientTxTaskHandle) {
+        // Before client_init(). Only the UART can have been started.
+        if (!in_isr && (client == CLIENT_SERIAL || client == CLIENT_ALL)) {
+            client_transmit(CLIENT_SERIAL, text, len);
+        }
+        return;
+    }
+
+    uint8_t clients = bit(CLIENT_SERIAL);
+#ifdef ENABLE_BLUETOOTH
+    if (WebUI::SerialBT.hasClient()) {
+        clients |= bit(CLIENT_BT);
+    }
+#endif
+#if defined(ENABLE_WIFI) && defined(ENABLE_HTTP) && defined(ENABLE_SERIAL2SOCKET_OUT)
+    clients |= bit(CLIENT_WEBUI);
+#endif
+#if defined(ENABLE_WIFI) && defined(ENABLE_TELNET)
+    clients |= bit(CLIENT_TELNET);
 #endif
+    if (client != CLIENT_ALL) {
+        clients &= bit(client);
+    }
+
+    // A status report is the only output that starts with '<'. Long text, such as help, is queued
+    // in pieces that a queue can hold.
+    TxQueue::Kind kind      = text[0] == '<' ? TxQueue::Status : TxQueue::Message;
+    const size_t  max_piece = TX_SLOT_SIZE * TX_QUEUE_DEPTH / 4;
+    while (len && clients) {
+        size_t  piece = MIN(len, max_piece);
+        uint8_t full  = client_tx.put(text, piece, clients, kind);
+        if (kind == TxQueue::Message && client != CLIENT_ALL && !in_isr) {
+            configASSERT(xTaskGetCurrentTaskHandle() != clientTxTaskHandle);
+            while (full) {
+                xTaskNotifyGive(clientTxTaskHandle);
+                vTaskDelay(1 / portTICK_RATE_MS);
+                full = client_tx.put(text, piece, full, kind);
+            }
+        }
+        if (in_isr) {
+            vTaskNotifyGiveFromISR(clientTxTaskHandle, NULL);
+        } else {
+            xTaskNotifyGive(clientTxTaskHandle);
+        }
+        clients &= ~full;  // The rest of the text would make no sense without this piece
+        text += piece;
+        len  -= piece;
     }
 }
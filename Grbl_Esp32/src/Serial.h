@@ -22,6 +22,16 @@
 
 #include "stdint.h"
 
+#ifdef SERIAL_HIGH_SPEED_BAUD
+#    define SERIAL_BAUD_RATE SERIAL_HIGH_SPEED_BAUD
+#    ifndef RX_BUFFER_SIZE
+#        define RX_BUFFER_SIZE 4096
+#    endif
+#    define SERIAL_TX_BUFFER_SIZE 1024
+#else
+#    define SERIAL_BAUD_RATE BAUD_RATE
+#    define SERIAL_TX_BUFFER_SIZE 0  // Writes wait for the UART FIFO
+#endif
 #ifndef RX_BUFFER_SIZE
 #    define RX_BUFFER_SIZE 256
 #endif
@@ -36,10 +46,16 @@
 // a task to read for incoming data from serial port
 void clientCheckTask(void* pvParameters);
 
+// a task to send the output queued for the clients
+void clientTxTask(void* pvParameters);
+
 void client_write(uint8_t client, const char* text);
 
-// Fetches the first byte in the serial read buffer. Called by main program.
-int client_read(uint8_t client);
+// Fetches the next complete line from a client, with realtime characters already removed. Returns
+// Error::Eol with the line, Error::Overflow for a line that was too long, or Error::Ok if there is
+// no complete line. The line is edited in place, and stays valid until client_release_line().
+Error client_get_line(uint8_t client, char** line);
+void  client_release_line(uint8_t client);
 
 // See if the character is an action command like feedhold or jogging. If so, do the action and return true
 uint8_t check_action_command(uint8_t data);
@@ -47,8 +63,11 @@ uint8_t check_action_command(uint8_t data);
 void client_init();
 void client_reset_read_buffer(uint8_t client);
 
-// Returns the number of bytes available in the RX serial buffer.
-uint8_t client_get_rx_buffer_available(uint8_t client);
+// Returns the number of bytes a client can send without holding up its realtime characters, which
+// Bf: reports. A sender that stays within it has each realtime character acted on by the next pass
+// of clientCheckTask(), about a millisecond. Exact when called from clientCheckTask(), which answers
+// '?', and an estimate from other tasks.
+int client_get_rx_buffer_available(uint8_t client);
 
 void execute_realtime_command(Cmd command, uint8_t client);
 bool is_realtime_command(uint8_t data);
@@ -29,7 +29,8 @@ Command::Command(
     List = this;
 }
 
-Setting* Setting::List = NULL;
+Setting* Setting::List       = NULL;
+uint32_t Setting::generation = 0;
 
 Setting::Setting(
     const char* description, type_t type, permissions_t permissions, const char* grblName, const char* fullName, bool (*checker)(char*)) :
@@ -98,6 +99,7 @@ void IntSetting::load() {
     } else {
         _currentValue = _storedValue;
     }
+    generation++;
 }
 
 void IntSetting::setDefault() {
@@ -105,6 +107,7 @@ void IntSetting::setDefault() {
         nvs_erase_key(_handle, _keyName);
     } else {
         _currentValue = _defaultValue;
+        generation++;
         if (_storedValue != _currentValue) {
             nvs_erase_key(_handle, _keyName);
         }
@@ -129,6 +132,7 @@ Error IntSetting::setStringValue(char* s) {
     // If we don't see the NVM state, we have to make this the live value:
     if (!_currentIsNvm) {
         _currentValue = convertedValue;
+        generation++;
     }
 
     if (_storedValue != convertedValue) {
@@ -194,10 +198,12 @@ void AxisMaskSetting::load() {
     } else {
         _currentValue = _storedValue;
     }
+    generation++;
 }
 
 void AxisMaskSetting::setDefault() {
     _currentValue = _defaultValue;
+    generation++;
     if (_storedValue != _currentValue) {
         nvs_erase_key(_handle, _keyName);
     }
@@ -229,6 +235,7 @@ Error AxisMaskSetting::setStringValue(char* s) {
         }
     }
     _currentValue = convertedValue;
+    generation++;
     if (_storedValue != _currentValue) {
         if (_currentValue == _defaultValue) {
             nvs_erase_key(_handle, _keyName);
@@ -299,10 +306,12 @@ void FloatSetting::load() {
     } else {
         _currentValue = v.fval;
     }
+    generation++;
 }
 
 void FloatSetting::setDefault() {
     _currentValue = _defaultValue;
+    generation++;
     if (_storedValue != _currentValue) {
         nvs_erase_key(_handle, _keyName);
     }
@@ -325,6 +334,7 @@ Error FloatSetting::setStringValue(char* s) {
         return Error::NumberRange;
     }
     _currentValue = convertedValue;
+    generation++;
     if (_storedValue != _currentValue) {
         if (_currentValue == _defaultValue) {
             nvs_erase_key(_handle, _keyName);
@@ -390,6 +400,7 @@ void StringSetting::load() {
     if (err) {
         _storedValue  = _defaultValue;
         _currentValue = _defaultValue;
+        generation++;
         return;
     }
     char buf[len];
@@ -397,14 +408,17 @@ void StringSetting::load() {
     if (err) {
         _storedValue  = _defaultValue;
         _currentValue = _defaultValue;
+        generation++;
         return;
     }
     _storedValue  = String(buf);
     _currentValue = _storedValue;
+    generation++;
 }
 
 void StringSetting::setDefault() {
     _currentValue = _defaultValue;
+    generation++;
     if (_storedValue != _currentValue) {
         nvs_erase_key(_handle, _keyName);
     }
@@ -419,6 +433,7 @@ Error StringSetting::setStringValue(char* s) {
         return err;
     }
     _currentValue = s;
+    generation++;
     if (_storedValue != _currentValue) {
         if (_currentValue == _defaultValue) {
             nvs_erase_key(_handle, _keyName);
@@ -480,10 +495,12 @@ void EnumSetting::load() {
     } else {
         _currentValue = _storedValue;
     }
+    generation++;
 }
 
 void EnumSetting::setDefault() {
     _currentValue = _defaultValue;
+    generation++;
     if (_storedValue != _currentValue) {
         nvs_erase_key(_handle, _keyName);
     }
@@ -523,6 +540,7 @@ Error EnumSetting::setStringValue(char* s) {
         }
     }
     _currentValue = it->second;
+    generation++;
     if (_storedValue != _currentValue) {
         if (_currentValue == _defaultValue) {
             nvs_erase_key(_handle, _keyName);
@@ -585,9 +603,11 @@ void FlagSetting::load() {
     } else {
         _currentValue = !!_storedValue;
     }
+    generation++;
 }
 void FlagSetting::setDefault() {
     _currentValue = _defaultValue;
+    generation++;
     if (_storedValue != _currentValue) {
         nvs_erase_key(_handle, _keyName);
     }
@@ -601,6 +621,7 @@ Error FlagSetting::setStringValue(char* s) {
     }
     _currentValue = (strcasecmp(s, "on") == 0) || (strcasecmp(s, "true") == 0) || (strcasecmp(s, "enabled") == 0) ||
                     (strcasecmp(s, "yes") == 0) || (strcasecmp(s, "1") == 0);
+    generation++;
     // _storedValue is -1, 0, or 1
     // _currentValue is 0 or 1
     if (_storedValue != (int8_t)_currentValue) {
@@ -664,10 +685,12 @@ void IPaddrSetting::load() {
     } else {
         _currentValue = _storedValue;
     }
+    generation++;
 }
 
 void IPaddrSetting::setDefault() {
     _currentValue = _defaultValue;
+    generation++;
     if (_storedValue != _currentValue) {
         nvs_erase_key(_handle, _keyName);
     }
@@ -684,6 +707,7 @@ Error IPaddrSetting::setStringValue(char* s) {
         return Error::InvalidValue;
     }
     _currentValue = ipaddr;
+    generation++;
     if (_storedValue != _currentValue) {
         if (_currentValue == _defaultValue) {
             nvs_erase_key(_handle, _keyName);
@@ -107,6 +107,10 @@ public:
     static Setting*   List;
     Setting*          next() { return link; }
 
+    // Counts the changes to the value of any setting, by $ command, setDefault() or load(). Code
+    // that keeps values worked out from settings compares it, rather than the settings.
+    static uint32_t generation;
+
     Error check(char* s);
 
     static Error report_nvs_stats(const char* value, WebUI::AuthenticationLevel auth_level, WebUI::ESPResponseStream* out) {
@@ -435,6 +439,7 @@ public:
     FloatSetting* steps_per_mm;
     FloatSetting* max_rate;
     FloatSetting* acceleration;
+    FloatSetting* jerk;
     FloatSetting* max_travel;
     FloatSetting* run_current;
     FloatSetting* hold_current;
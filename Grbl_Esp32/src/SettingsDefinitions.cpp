@@ -37,6 +37,10 @@ IntSetting* laser_full_power;
 IntSetting*   status_mask;
 FloatSetting* junction_deviation;
 FloatSetting* arc_tolerance;
+IntSetting*   planner_blocks;
+IntSetting*   stepper_segments;
+IntSetting*   stepper_segment_rate;
+FloatSetting* merge_tolerance;
 
 FloatSetting*    homing_feed_rate;
 FloatSetting*    homing_seek_rate;
@@ -106,6 +110,7 @@ typedef struct {
     float       steps_per_mm;
     float       max_rate;
     float       acceleration;
+    float       jerk;
     float       max_travel;
     float       home_mpos;
     float       run_current;
@@ -117,6 +122,7 @@ axis_defaults_t axis_defaults[] = { { "X",
                                       DEFAULT_X_STEPS_PER_MM,
                                       DEFAULT_X_MAX_RATE,
                                       DEFAULT_X_ACCELERATION,
+                                      DEFAULT_X_JERK,
                                       DEFAULT_X_MAX_TRAVEL,
                                       DEFAULT_X_HOMING_MPOS,
                                       DEFAULT_X_CURRENT,
@@ -127,6 +133,7 @@ axis_defaults_t axis_defaults[] = { { "X",
                                       DEFAULT_Y_STEPS_PER_MM,
                                       DEFAULT_Y_MAX_RATE,
                                       DEFAULT_Y_ACCELERATION,
+                                      DEFAULT_Y_JERK,
                                       DEFAULT_Y_MAX_TRAVEL,
                                       DEFAULT_Y_HOMING_MPOS,
                                       DEFAULT_Y_CURRENT,
@@ -137,6 +144,7 @@ axis_defaults_t axis_defaults[] = { { "X",
                                       DEFAULT_Z_STEPS_PER_MM,
                                       DEFAULT_Z_MAX_RATE,
                                       DEFAULT_Z_ACCELERATION,
+                                      DEFAULT_Z_JERK,
                                       DEFAULT_Z_MAX_TRAVEL,
                                       DEFAULT_Z_HOMING_MPOS,
                                       DEFAULT_Z_CURRENT,
@@ -147,6 +155,7 @@ axis_defaults_t axis_defaults[] = { { "X",
                                       DEFAULT_A_STEPS_PER_MM,
                                       DEFAULT_A_MAX_RATE,
                                       DEFAULT_A_ACCELERATION,
+                                      DEFAULT_A_JERK,
                                       DEFAULT_A_MAX_TRAVEL,
                                       DEFAULT_A_HOMING_MPOS,
                                       DEFAULT_A_CURRENT,
@@ -157,6 +166,7 @@ axis_defaults_t axis_defaults[] = { { "X",
                                       DEFAULT_B_STEPS_PER_MM,
                                       DEFAULT_B_MAX_RATE,
                                       DEFAULT_B_ACCELERATION,
+                                      DEFAULT_B_JERK,
                                       DEFAULT_B_MAX_TRAVEL,
                                       DEFAULT_B_HOMING_MPOS,
                                       DEFAULT_B_CURRENT,
@@ -167,6 +177,7 @@ axis_defaults_t axis_defaults[] = { { "X",
                                       DEFAULT_C_STEPS_PER_MM,
                                       DEFAULT_C_MAX_RATE,
                                       DEFAULT_C_ACCELERATION,
+                                      DEFAULT_C_JERK,
                                       DEFAULT_C_MAX_TRAVEL,
                                       DEFAULT_C_HOMING_MPOS,
                                       DEFAULT_C_CURRENT,
@@ -226,7 +237,7 @@ static const char* makeGrblName(int axisNum, int base) {
     // if (axisNum > 2) return NULL;
     char buf[4];
     snprintf(buf, 4, "%d", axisNum + base);
-    char* retval = (char*)malloc(strlen(buf));
+    char* retval = (char*)malloc(strlen(buf) + 1);
     return strcpy(retval, buf);
 }
 
@@ -313,6 +324,12 @@ void make_settings() {
         axis_settings[axis]->home_mpos = setting;
     }
 
+    for (axis = MAX_N_AXIS - 1; axis >= 0; axis--) {
+        def          = &axis_defaults[axis];
+        auto setting = new FloatSetting(EXTENDED, WG, NULL, makename(def->name, "Jerk"), def->jerk, 0.0, 1000000.0);
+        setting->setAxis(axis);
+        axis_settings[axis]->jerk = setting;
+    }
     for (axis = MAX_N_AXIS - 1; axis >= 0; axis--) {
         def = &axis_defaults[axis];
         auto setting =
@@ -392,6 +409,11 @@ void make_settings() {
     arc_tolerance      = new FloatSetting(GRBL, WG, "12", "GCode/ArcTolerance", DEFAULT_ARC_TOLERANCE, 0, 1);
     junction_deviation = new FloatSetting(GRBL, WG, "11", "GCode/JunctionDeviation", DEFAULT_JUNCTION_DEVIATION, 0, 10);
     status_mask        = new IntSetting(GRBL, WG, "10", "Report/Status", DEFAULT_STATUS_REPORT_MASK, 0, 3);
+    planner_blocks     = new IntSetting(EXTENDED, WG, NULL, "Planner/Blocks", DEFAULT_PLANNER_BLOCKS, 8, 512);
+    merge_tolerance    = new FloatSetting(EXTENDED, WG, NULL, "Planner/MergeTolerance", DEFAULT_PLANNER_MERGE_TOLERANCE, 0, 1);
+    // The segment index is 8 bits. Above 1000 Hz, segment prep would cost more CPU than it gives in smoothness.
+    stepper_segments     = new IntSetting(EXTENDED, WG, NULL, "Stepper/Segments", DEFAULT_STEPPER_SEGMENTS, 3, 128);
+    stepper_segment_rate = new IntSetting(EXTENDED, WG, NULL, "Stepper/SegmentRate", DEFAULT_STEPPER_SEGMENT_RATE, 50, 1000);
 
     probe_invert                 = new FlagSetting(GRBL, WG, "6", "Probe/Invert", DEFAULT_INVERT_PROBE_PIN);
     limit_invert                 = new FlagSetting(GRBL, WG, "5", "Limits/Invert", DEFAULT_INVERT_LIMIT_PINS);
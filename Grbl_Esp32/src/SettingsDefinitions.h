@@ -40,6 +40,10 @@ extern IntSetting*  laser_full_power;
 extern IntSetting*   status_mask;
 extern FloatSetting* junction_deviation;
 extern FloatSetting* arc_tolerance;
+extern IntSetting*   planner_blocks;
+extern IntSetting*   stepper_segments;
+extern IntSetting*   stepper_segment_rate;
+extern FloatSetting* merge_tolerance;
 
 extern FloatSetting* homing_feed_rate;
 extern FloatSetting* homing_seek_rate;
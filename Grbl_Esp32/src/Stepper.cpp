@@ -29,7 +29,7 @@
 
 // Stores the planner block Bresenham algorithm execution data for the segments in the segment
 // buffer. Normally, this buffer is partially in-use, but, for the worst case scenario, it will
-// never exceed the number of accessible stepper buffer segments (SEGMENT_BUFFER_SIZE-1).
+// never exceed the number of accessible stepper buffer segments (segment_buffer_size-1).
 // NOTE: This data is copied from the prepped planner blocks so that the planner blocks may be
 // discarded when entirely consumed and completed by the segment buffer. Also, AMASS alters this
 // data for its own use.
@@ -38,8 +38,16 @@ typedef struct {
     uint32_t step_event_count;
     uint8_t  direction_bits;
     uint8_t  is_pwm_rate_adjusted;  // Tracks motions that require constant laser power/rate
+    uint32_t laser_period;          // Timer ticks per step event at the programmed rate, if is_pwm_rate_adjusted
+
+    // Laser raster. The pixel changes every raster_steps / raster_count steps of raster_axis.
+    const uint8_t* raster;        // Power of each pixel, in the planner's raster buffer. NULL if not a raster.
+    uint16_t       raster_count;  // Number of pixels
+    uint16_t       raster_end;    // Where the pixels end in the raster buffer
+    uint32_t       raster_steps;  // Steps of raster_axis
+    uint8_t        raster_axis;   // The axis with the most steps
 } st_block_t;
-static st_block_t st_block_buffer[SEGMENT_BUFFER_SIZE - 1];
+static st_block_t* st_block_buffer;  // Allocated by stepper_init()
 
 // Primary stepper segment ring buffer. Contains small, short line segments for the stepper
 // algorithm to execute, which are "checked-out" incrementally from the first block in the
@@ -52,7 +60,7 @@ typedef struct {
     uint8_t  amass_level;     // AMASS level for the ISR to execute this segment
     uint16_t spindle_rpm;     // TODO get rid of this.
 } segment_t;
-static segment_t segment_buffer[SEGMENT_BUFFER_SIZE];
+static segment_t* segment_buffer;  // Allocated by stepper_init()
 
 // Stepper ISR data struct. Contains the running data for the main stepper ISR.
 typedef struct {
@@ -65,48 +73,114 @@ typedef struct {
     uint8_t  step_pulse_time;  // Step pulse reset time after step rise
     uint8_t  step_outbits;     // The next stepping-bits to be output
     uint8_t  dir_outbits;
+    bool     dir_at_unstep;    // The next step is far enough off to set its direction as the pulse ends
     uint32_t steps[MAX_N_AXIS];
 
+    // Settings for the ISR, read by st_wake_up() rather than at every step
+    uint8_t  n_axis;
+    uint16_t pulse_us;         // pulse_microseconds
+    uint16_t dir_delay_us;     // direction_delay_microseconds
+    uint32_t dir_setup_ticks;  // Shortest step period, in ticks, that fits the pulse and the direction delay
+    bool     gpio_plan;        // Step through step_plan, not motors_step()
+    bool     pulse_timer;      // The pulse timer ends the step pulses. See st_end_pulse().
+
     uint16_t    step_count;        // Steps remaining in line segment motion
+    uint16_t    exec_period;       // Timer ticks per step event of the segment last loaded
+    uint16_t    i2s_ticks;         // Timer ticks of the step period that the I2S stream has not timed
+    bool        trains;            // Step pulses go out as RMT trains. See RMT_STEP_TRAINS.
     uint8_t     exec_block_index;  // Tracks the current st_block index. Change indicates new block.
     st_block_t* exec_block;        // Pointer to the block data for the segment being executed
     segment_t*  exec_segment;      // Pointer to the segment being executed
+
+    uint32_t raster_counter;  // Bresenham counter of the pixels against the steps of the raster axis
+    uint16_t raster_index;    // The pixel being burned
+    uint32_t raster_rpm;      // Spindle speed of the segment, which a pixel of 255 burns at
+    uint32_t raster_output;   // Spindle speed last set for a pixel
 } stepper_t;
 static stepper_t st;
 
+// The GPIO writes that step the motors, when st.gpio_plan. Made by st_wake_up().
+static motors_plan_t step_plan;
+
+// A step pulse is waiting for the pulse timer to end it. Outside st, so that st_reset() leaves it.
+static volatile bool pulse_pending = false;
+
 // Step segment ring buffer indices
 static volatile uint8_t segment_buffer_tail;
 static uint8_t          segment_buffer_head;
 static uint8_t          segment_next_head;
+static uint8_t          segment_buffer_size;  // From $Stepper/Segments
+
+double                   segment_time;  // min/segment
+static st_buffer_stats_t buffer_stats;
 
 // Used to avoid ISR nesting of the "Stepper Driver Interrupt". Should never occur though.
 static std::atomic<bool> busy;
 
 // Pointers for the step segment being prepped from the planner buffer. Accessed only by the
 // main program. Pointers may be planning segments or planner blocks ahead of what being executed.
-static plan_block_t* pl_block;       // Pointer to the planner block being prepped
-static st_block_t*   st_prep_block;  // Pointer to the stepper block data being prepped
+static plan_block_t*   pl_block;       // Pointer to the planner block being prepped
+static plan_profile_t* pl_profile;     // Pointer to the velocity profile of pl_block
+static plan_curve_t*   pl_curve;       // Pointer to the curve of pl_block. NULL for a straight line.
+static plan_ramp_t*    pl_ramp;        // Pointer to the S-curve ramp of pl_block
+static st_block_t*     st_prep_block;  // Pointer to the stepper block data being prepped
 
 // esp32 work around for disable in main loop
 uint64_t stepper_idle_counter;  // used to count down until time to disable stepper drivers
 bool     stepper_idle;
 
+// Steps and time in segment prep. See FIXED_POINT_PREP.
+#ifdef FIXED_POINT_PREP
+typedef int64_t prep_steps_t;  // Steps, Q16.16
+typedef int64_t prep_time_t;   // Timer ticks, Q16.16
+
+const int64_t PREP_ONE = 1 << 16;
+
+// Rounds up, so that a distance too small for the fraction still leaves a step to take, as it does in float.
+static inline prep_steps_t prep_steps(float steps) {
+    return ceilf(steps * PREP_ONE);
+}
+
+static inline prep_steps_t prep_ceil(prep_steps_t steps) {
+    return (steps + PREP_ONE - 1) & ~(PREP_ONE - 1);
+}
+
+static inline uint32_t prep_whole_steps(prep_steps_t steps) {
+    return steps >> 16;
+}
+#else
+typedef float prep_steps_t;  // Steps
+typedef float prep_time_t;   // Minutes
+
+static inline prep_steps_t prep_steps(float steps) {
+    return steps;
+}
+
+static inline prep_steps_t prep_ceil(prep_steps_t steps) {
+    return ceil(steps);
+}
+
+static inline uint32_t prep_whole_steps(prep_steps_t steps) {
+    return steps;
+}
+#endif
+
 // Segment preparation data struct. Contains all the necessary information to compute new segments
 // based on the current executing planner block.
 typedef struct {
     uint8_t  st_block_index;  // Index of stepper common data block being prepped
     PrepFlag recalculate_flag;
 
-    float dt_remainder;
-    float steps_remaining;
-    float step_per_mm;
-    float req_mm_increment;
+    prep_time_t  dt_remainder;
+    prep_steps_t steps_remaining;
+    float        step_per_mm;
+    float        req_mm_increment;
 
 #ifdef PARKING_ENABLE
-    uint8_t last_st_block_index;
-    float   last_steps_remaining;
-    float   last_step_per_mm;
-    float   last_dt_remainder;
+    uint8_t      last_st_block_index;
+    prep_steps_t last_steps_remaining;
+    float        last_step_per_mm;
+    prep_time_t  last_dt_remainder;
 #endif
 
     uint8_t ramp_type;    // Current segment ramp state
@@ -118,10 +192,23 @@ typedef struct {
     float accelerate_until;  // Acceleration ramp end measured from end of block (mm)
     float decelerate_after;  // Deceleration ramp start measured from end of block (mm)
 
+    // S-curve ramps of blocks with a jerk. See s_curve_advance().
+    float current_accel;  // Acceleration at the end of the segment buffer (mm/min^2)
+    float ramp_accel;     // Acceleration limit of the ramps (mm/min^2)
+    float ramp_jerk;      // Jerk of the ramps (mm/min^3)
+    float ramp_speed;     // End speed of the deceleration through the end of the block (mm/min)
+    float ramp_end_mm;    // End of that deceleration measured beyond the end of block (mm)
+
     float inv_rate;  // Used by PWM laser mode to speed up segment calculations.
     //uint16_t current_spindle_pwm;  // todo remove
     float current_spindle_rpm;
 
+    // Curved planner blocks. Each segment is a line of its own, with its own stepper block.
+    bool    st_block_used;            // A segment has been prepped from st_prep_block
+    int32_t curve_steps[MAX_N_AXIS];  // Steps from the start of the curve to the end of the segment buffer
+    float   curve_chord;              // Longest segment that stays within the arc tolerance (mm)
+    float   curve_dt;                 // Segment time that keeps to curve_chord at the top speed of the block (min)
+
 } st_prep_t;
 static st_prep_t prep;
 
@@ -191,6 +278,30 @@ stepper_id_t current_stepper = DEFAULT_STEPPER;
 */
 
 static void stepper_pulse_func();
+#ifdef RMT_STEP_TRAINS
+static void stepper_train_func();
+#endif
+
+// Scales the laser power by the step rate of the segment, against the programmed rate of the block,
+// so that the energy per mm stays the same as the machine speeds up and slows down. The steps of a
+// segment are evenly spaced, so the rate at which the segment is loaded holds until the next one.
+static uint32_t st_laser_rate_rpm(uint32_t rpm) {
+    uint32_t period = uint32_t(st.exec_segment->isrPeriod) << st.exec_segment->amass_level;
+    uint32_t ratio  = ((st.exec_block->laser_period << 8) + period / 2) / period;  // 8 fractional bits
+    return (rpm * MIN(ratio, 0xffff) + 0x80) >> 8;
+}
+
+// Sets the laser power for the pixel being burned. It is off after the last pixel.
+static void st_raster_power() {
+    uint32_t rpm = 0;
+    if (st.raster_index < st.exec_block->raster_count) {
+        rpm = (st.raster_rpm * st.exec_block->raster[st.raster_index] + 127) / 255;
+    }
+    if (rpm != st.raster_output) {
+        st.raster_output = rpm;
+        spindle->set_rpm(rpm);
+    }
+}
 
 // TODO: Replace direct updating of the int32 position counters in the ISR somehow. Perhaps use smaller
 // int8 variables and update position counters only when a segment completes. This can get complicated
@@ -204,7 +315,12 @@ void IRAM_ATTR onStepperDriverTimer(void* para) {
 
     bool expected = false;
     if (busy.compare_exchange_strong(expected, true)) {
-        stepper_pulse_func();
+#ifdef RMT_STEP_TRAINS
+        if (st.trains) {
+            stepper_train_func();
+        } else
+#endif
+            stepper_pulse_func();
 
         TIMERG0.hw_timer[STEP_TIMER_INDEX].config.alarm_en = TIMER_ALARM_EN;
 
@@ -212,60 +328,59 @@ void IRAM_ATTR onStepperDriverTimer(void* para) {
     }
 }
 
-/**
- * This phase of the ISR should ONLY create the pulses for the steppers.
- * This prevents jitter caused by the interval between the start of the
- * interrupt and the start of the pulses. DON'T add any logic ahead of the
- * call to this method that might cause variation in the timing. The aim
- * is to keep pulse timing as regular as possible.
- */
-static void stepper_pulse_func() {
-    auto n_axis = number_axis->get();
+// Ends the step pulse: lowers the step pins and, when the next step is far enough off, sets its
+// direction, so that neither the pulse nor the direction delay is spun out in the step ISR.
+static void IRAM_ATTR st_end_pulse() {
+    pulse_pending = false;
+    if (st.gpio_plan) {
+        motors_plan_unstep(step_plan);
+    } else {
+        motors_unstep();
+    }
+    if (st.dir_at_unstep && st.dir_outbits != motors_dir_mask) {
+        motors_direction(st.dir_outbits);
+    }
+}
 
-    if (motors_direction(st.dir_outbits)) {
-        auto wait_direction = direction_delay_microseconds->get();
-        if (wait_direction > 0) {
-            // Stepper drivers need some time between changing direction and doing a pulse.
-            switch (current_stepper) {
-                case ST_I2S_STREAM:
-                    i2s_out_push_sample(wait_direction);
-                    break;
-                case ST_I2S_STATIC:
-                case ST_TIMED: {
-                    // wait for step pulse time to complete...some time expired during code above
-                    //
-                    // If we are using GPIO stepping as opposed to RMT, record the
-                    // time that we turned on the direction pins so we can delay a bit.
-                    // If we are using RMT, we can't delay here.
-                    auto direction_pulse_start_time = esp_timer_get_time() + wait_direction;
-                    while ((esp_timer_get_time() - direction_pulse_start_time) < 0) {
-                        NOP();  // spin here until time to turn off step
-                    }
-                    break;
-                }
-                case ST_RMT:
-                    break;
-            }
-        }
+// Pulse timer ISR. Its alarm is armed by each step pulse, in ST_TIMED and ST_I2S_STATIC modes.
+void IRAM_ATTR onStepperPulseTimer(void* para) {
+    TIMERG0.int_clr_timers.t1 = 1;
+    if (pulse_pending) {
+        st_end_pulse();
     }
+}
 
-    // If we are using GPIO stepping as opposed to RMT, record the
-    // time that we turned on the step pins so we can turn them off
-    // at the end of this routine without incurring another interrupt.
-    // This is unnecessary with RMT and I2S stepping since both of
-    // those methods time the turn off automatically.
-    //
-    // NOTE: We could use direction_pulse_start_time + wait_direction, but let's play it safe
-    uint64_t step_pulse_start_time = esp_timer_get_time();
-    motors_step(st.step_outbits);
+// Returns true if segment prep has more motion to put in the segment buffer, so that the buffer
+// running low or empty is an underrun rather than the end of the motion.
+static bool st_prep_pending() {
+    if (pl_block != NULL) {
+        return true;
+    }
+    return !sys.step_control.executeSysMotion && plan_get_current_block() != NULL;
+}
 
+// Loads the next segment when the last one is done, and works out the axes to step at the next
+// step event with the Bresenham counters. Returns false, with the stepper gone idle, when there is
+// no segment left to run.
+static inline bool st_next_step(int n_axis) {
     // If there is no step segment, attempt to pop one from the stepper buffer
     if (st.exec_segment == NULL) {
         // Anything in the buffer? If so, load and initialize next step segment.
         if (segment_buffer_head != segment_buffer_tail) {
+            if (st_prep_pending()) {
+                int queued = segment_buffer_head - segment_buffer_tail;
+                if (queued < 0) {
+                    queued += segment_buffer_size;
+                }
+                if (queued < buffer_stats.low_water) {
+                    buffer_stats.low_water = queued;
+                }
+            }
             // Initialize new step segment and load number of steps to execute
             st.exec_segment = &segment_buffer[segment_buffer_tail];
+            buffer_stats.segments++;
             // Initialize step segment timing per step and load number of steps to execute.
+            st.exec_period = st.exec_segment->isrPeriod;
             Stepper_Timer_WritePeriod(st.exec_segment->isrPeriod);
             st.step_count = st.exec_segment->n_step;  // NOTE: Can sometimes be zero when moving slow.
             // If the new segment starts a new planner block, initialize stepper variables and counters.
@@ -277,6 +392,9 @@ static void stepper_pulse_func() {
                 for (int axis = 0; axis < n_axis; axis++) {
                     st.counter[axis] = (st.exec_block->step_event_count >> 1);
                 }
+                st.raster_counter = 0;
+                st.raster_index   = 0;
+                st.raster_output  = UINT32_MAX;
             }
             st.dir_outbits = st.exec_block->direction_bits;
             // Adjust Bresenham axis increment counters according to AMASS level.
@@ -284,9 +402,22 @@ static void stepper_pulse_func() {
                 st.steps[axis] = st.exec_block->steps[axis] >> st.exec_segment->amass_level;
             }
             // Set real-time spindle output as segment is loaded, just prior to the first step.
-            spindle->set_rpm(st.exec_segment->spindle_rpm);
+            uint32_t rpm = st.exec_segment->spindle_rpm;
+            if (st.exec_block->is_pwm_rate_adjusted) {
+                rpm = st_laser_rate_rpm(rpm);
+            }
+            if (st.exec_block->raster == NULL) {
+                spindle->set_rpm(rpm);
+            } else {
+                st.raster_rpm = rpm;
+                st_raster_power();
+            }
         } else {
-            // Segment buffer empty. Shutdown.
+            // Segment buffer empty. Shutdown. The steps just taken are not taken again on wake-up.
+            st.step_outbits = 0;
+            if (st_prep_pending() && !sys.step_control.endMotion) {
+                buffer_stats.underruns++;
+            }
             st_go_idle();
             if (sys.state != State::Jog) {  // added to prevent ... jog after probing crash
                 // Ensure pwm is set properly upon completion of rate-controlled motion.
@@ -295,7 +426,7 @@ static void stepper_pulse_func() {
                 }
             }
             cycle_stop = true;
-            return;  // Nothing to do but exit.
+            return false;
         }
     }
     // Check probing state.
@@ -319,6 +450,21 @@ static void stepper_pulse_func() {
         }
     }
 
+    // Move on to the next pixel as the raster axis crosses into it.
+    if (st.exec_block->raster != NULL && (st.step_outbits & bit(st.exec_block->raster_axis))) {
+        st.raster_counter += st.exec_block->raster_count;
+        if (st.raster_counter >= st.exec_block->raster_steps) {
+            do {
+                st.raster_counter -= st.exec_block->raster_steps;
+                st.raster_index++;
+            } while (st.raster_counter >= st.exec_block->raster_steps);
+            st_raster_power();
+            if (st.raster_index == st.exec_block->raster_count) {
+                plan_release_raster(st.exec_block->raster_end);
+            }
+        }
+    }
+
     // During a homing cycle, lock out and prevent desired axes from moving.
     if (sys.state == State::Homing) {
         st.step_outbits &= sys.homing_axis_lock;
@@ -327,36 +473,323 @@ static void stepper_pulse_func() {
     if (st.step_count == 0) {
         // Segment is complete. Discard current segment and advance segment indexing.
         st.exec_segment = NULL;
-        if (++segment_buffer_tail == SEGMENT_BUFFER_SIZE) {
+        if (++segment_buffer_tail == segment_buffer_size) {
             segment_buffer_tail = 0;
         }
     }
 
+    return true;
+}
+
+/**
+ * This phase of the ISR should ONLY create the pulses for the steppers.
+ * This prevents jitter caused by the interval between the start of the
+ * interrupt and the start of the pulses. DON'T add any logic ahead of the
+ * call to this method that might cause variation in the timing. The aim
+ * is to keep pulse timing as regular as possible.
+ */
+static void stepper_pulse_func() {
+    auto n_axis = st.n_axis;
+
+    // A step period shorter than the pulse leaves the last pulse to end here.
+    if (pulse_pending) {
+        st_end_pulse();
+    }
+
+    // The direction changes at most once a segment. Only then is it worth a call to each motor.
+    if (st.dir_outbits != motors_dir_mask && motors_direction(st.dir_outbits)) {
+        auto wait_direction = st.dir_delay_us;
+        if (wait_direction > 0) {
+            // Stepper drivers need some time between changing direction and doing a pulse.
+            switch (current_stepper) {
+                case ST_I2S_STREAM:
+                    i2s_out_push_sample(wait_direction);
+                    break;
+                case ST_I2S_STATIC:
+                case ST_TIMED: {
+                    // wait for step pulse time to complete...some time expired during code above
+                    //
+                    // If we are using GPIO stepping as opposed to RMT, record the
+                    // time that we turned on the direction pins so we can delay a bit.
+                    // If we are using RMT, we can't delay here.
+                    auto direction_pulse_start_time = esp_timer_get_time() + wait_direction;
+                    while ((esp_timer_get_time() - direction_pulse_start_time) < 0) {
+                        NOP();  // spin here until time to turn off step
+                    }
+                    break;
+                }
+                case ST_RMT:
+                    break;
+            }
+        }
+    }
+
+    // If we are using GPIO stepping as opposed to RMT, record the
+    // time that we turned on the step pins so we can turn them off
+    // at the end of this routine without incurring another interrupt.
+    // This is unnecessary with RMT and I2S stepping since both of
+    // those methods time the turn off automatically.
+    //
+    // NOTE: We could use direction_pulse_start_time + wait_direction, but let's play it safe
+    //
+    // With the pulse timer, the pulse ends in its interrupt instead.
+    uint64_t step_pulse_start_time = st.pulse_timer ? 0 : esp_timer_get_time();
+    if (st.gpio_plan) {
+        motors_plan_step(step_plan, st.step_outbits);
+    } else {
+        motors_step(st.step_outbits);
+    }
+    if (st.pulse_timer && st.step_outbits) {
+        pulse_pending = true;
+        timer_set_counter_value(STEP_TIMER_GROUP, PULSE_TIMER_INDEX, 0x00000000ULL);
+        TIMERG0.hw_timer[PULSE_TIMER_INDEX].config.alarm_en = TIMER_ALARM_EN;
+    }
+
+    if (!st_next_step(n_axis)) {
+        return;  // Nothing to do but exit.
+    }
+
     switch (current_stepper) {
         case ST_I2S_STREAM:
             // Generate the number of pulses needed to span pulse_microseconds
-            i2s_out_push_sample(pulse_microseconds->get());
+            i2s_out_push_sample(st.pulse_us);
             motors_unstep();
+#ifdef USE_I2S_STEPS
+            // The stream times the pulses in whole microseconds. Carry the rest of the step period
+            // to the next one, so that the step rate is exact on average.
+            st.i2s_ticks += st.exec_period;
+            i2s_out_set_pulse_period(st.i2s_ticks / ticksPerMicrosecond);
+            st.i2s_ticks %= ticksPerMicrosecond;
+#endif
             break;
         case ST_I2S_STATIC:
         case ST_TIMED:
+            if (st.pulse_timer) {
+                // The direction of the next step is set as this pulse ends, or now if there was
+                // no pulse, unless the step comes too soon after for the direction delay.
+                st.dir_at_unstep = st.exec_period >= st.dir_setup_ticks;
+                if (!pulse_pending && st.dir_at_unstep && st.dir_outbits != motors_dir_mask) {
+                    motors_direction(st.dir_outbits);
+                }
+                break;
+            }
             // wait for step pulse time to complete...some time expired during code above
-            while (esp_timer_get_time() - step_pulse_start_time < pulse_microseconds->get()) {
+            while (esp_timer_get_time() - step_pulse_start_time < st.pulse_us) {
                 NOP();  // spin here until time to turn off step
             }
-            motors_unstep();
+            if (st.gpio_plan) {
+                motors_plan_unstep(step_plan);
+            } else {
+                motors_unstep();
+            }
             break;
         case ST_RMT:
             break;
     }
 }
 
+#ifdef USE_I2S_STEPS
+// The I2S bits that step each axis, and the timer ticks from the start of the next sample to the
+// next step event of the I2S stream.
+static uint32_t i2s_step_bits[MAX_N_AXIS];
+static int32_t  i2s_wait_ticks;
+
+// Fills a DMA buffer of the I2S stream with the step pulses of the queued segments. The stream
+// calls this once for each buffer, in place of stepper_pulse_func() for each pulse, when every
+// motor steps through the I2S outputs. A sample holds all of the outputs for
+// I2S_OUT_USEC_PER_PULSE, so a pulse is the port data with the step bits of its axes flipped, and
+// the time between pulses is idle samples, written in runs. The time to the next step event is
+// kept in timer ticks, so the remainder of a sample carries over exactly. There is always an idle
+// sample after a pulse; a step period shorter than that stretches, so steps are never merged or
+// lost. Returns the samples filled: a pulse is not split between buffers.
+static uint32_t IRAM_ATTR stepper_fill_func(uint32_t* buf, uint32_t count) {
+    const int32_t sample_ticks   = I2S_OUT_USEC_PER_PULSE * ticksPerMicrosecond;
+    auto          n_axis         = st.n_axis;
+    auto          wait_direction = st.dir_delay_us;
+    uint32_t      pulse_samples  = MAX(st.pulse_us / I2S_OUT_USEC_PER_PULSE, 1);
+    uint32_t      dir_samples    = wait_direction > 0 ? MAX(wait_direction / I2S_OUT_USEC_PER_PULSE, 1) : 0;
+    uint32_t      pos            = 0;
+
+    motors_i2s_step_bits(i2s_step_bits);  // The motors of a ganged axis change while squaring
+    while (pos < count) {
+        uint32_t port_data = i2s_out_get_port_data();
+        if (i2s_wait_ticks >= sample_ticks) {
+            uint32_t idle = MIN(uint32_t(i2s_wait_ticks / sample_ticks), count - pos);
+            i2s_wait_ticks -= idle * sample_ticks;
+            while (idle--) {
+                buf[pos++] = port_data;
+            }
+            continue;
+        }
+        if (count - pos < dir_samples + pulse_samples + 1) {
+            break;  // Leave the pulse to the next buffer
+        }
+
+        uint32_t start = pos;
+        if (motors_direction(st.dir_outbits)) {
+            // Stepper drivers need some time between changing direction and doing a pulse.
+            port_data = i2s_out_get_port_data();
+            for (uint32_t i = 0; i < dir_samples; i++) {
+                buf[pos++] = port_data;
+            }
+        }
+        for (int axis = 0; axis < n_axis; axis++) {
+            if (st.step_outbits & bit(axis)) {
+                port_data ^= i2s_step_bits[axis];
+            }
+        }
+        for (uint32_t i = 0; i < pulse_samples; i++) {
+            buf[pos++] = port_data;
+        }
+
+        if (!st_next_step(n_axis)) {
+            i2s_wait_ticks = 0;
+            break;  // The stream pads this buffer and stops
+        }
+        i2s_wait_ticks += int32_t(st.exec_period) - int32_t(pos - start) * sample_ticks;
+        if (i2s_wait_ticks < sample_ticks) {
+            i2s_wait_ticks = sample_ticks;
+        }
+    }
+    return pos;
+}
+#endif
+
+#ifdef RMT_STEP_TRAINS
+// The step events worked out ahead of the one the step timer is waiting for, as a train of step
+// pulses for each axis.
+typedef struct {
+    rmt_item32_t items[MAX_N_AXIS][RMT_TRAIN_ITEMS];
+    uint8_t      step_bits;  // Axes with a pulse in the train
+    uint8_t      dir_bits;   // Direction of every step in the train
+    uint16_t     events;     // Step events, with or without steps. None if the train is empty.
+    uint32_t     ticks;      // Timer ticks from the start of the train to the step event after it
+} st_train_t;
+static st_train_t st_train;
+
+// Longest time from the start of a train to its last step event, in timer ticks. An RMT item waits
+// at most 32767 RMT ticks, and the direction delay of up to 1000 us comes on top of this.
+const uint32_t RMT_TRAIN_TICKS = 25000 * (ticksPerMicrosecond / RMT_TICKS_PER_MICROSECOND);
+
+// Works out the step events that follow into st_train, until a pulse train of an axis is full, the
+// train runs RMT_TRAIN_TICKS, the direction changes or the segment buffer runs dry. A train takes at
+// most one segment from the buffer, as the ISR would while it ran, so that prep keeps the buffer as
+// full, and as far ahead in the planner, as it does a step at a time. Each pulse comes
+// direction_delay_microseconds after its step event, as a single RMT step does; a step period
+// shorter than the pulse stretches, so steps are never merged or lost. Like the stepper ISR, it
+// takes the step already worked out first, so the events it leaves are the next train's to take.
+static void IRAM_ATTR st_fill_train(int n_axis) {
+    const uint32_t rmt_ticks = ticksPerMicrosecond / RMT_TICKS_PER_MICROSECOND;  // Timer ticks per RMT tick
+    uint32_t       pulse     = st.pulse_us * RMT_TICKS_PER_MICROSECOND;
+    uint32_t       delay     = MAX(st.dir_delay_us * RMT_TICKS_PER_MICROSECOND, 1);
+    uint32_t       end[MAX_N_AXIS];  // RMT tick at which the last pulse of each axis ends
+    uint8_t        count[MAX_N_AXIS];
+    uint8_t        pulses = 0;
+    uint32_t       ticks  = 0;
+    bool           loaded = false;  // A segment has been loaded
+
+    st_train.step_bits = 0;
+    st_train.dir_bits  = st.dir_outbits;
+    st_train.events    = 0;
+    for (int axis = 0; axis < n_axis; axis++) {
+        end[axis]   = 0;
+        count[axis] = 0;
+    }
+    while (pulses < RMT_TRAIN_ITEMS - 1 && ticks < RMT_TRAIN_TICKS && st.dir_outbits == st_train.dir_bits) {
+        if (st.exec_segment == NULL) {
+            if (segment_buffer_head == segment_buffer_tail) {
+                break;  // Take the step when a segment comes, or go idle
+            }
+            if (loaded) {
+                break;
+            }
+            loaded = true;
+        }
+        if (st.step_outbits) {
+            uint32_t at = ticks / rmt_ticks + delay;
+            for (int axis = 0; axis < n_axis; axis++) {
+                if (st.step_outbits & bit(axis)) {
+                    rmt_item32_t& item  = st_train.items[axis][count[axis]++];
+                    uint32_t      start = MAX(at, end[axis] + 1);
+                    item.duration0      = start - end[axis];
+                    item.level0         = 0;
+                    item.duration1      = pulse;
+                    item.level1         = 1;
+                    end[axis]           = start + pulse;
+                }
+            }
+            st_train.step_bits |= st.step_outbits;
+            pulses++;
+        }
+        st_train.events++;
+        st_next_step(n_axis);  // A segment is loaded or queued, so this does not go idle
+        ticks += st.exec_period;
+    }
+    for (int axis = 0; axis < n_axis; axis++) {
+        st_train.items[axis][count[axis]].val = 0;
+    }
+    st_train.ticks = ticks;
+}
+
+// Takes the place of stepper_pulse_func() when step pulses go out as trains. Each interrupt sends
+// the train worked out at the last one, works out the next, and waits for the step event after the
+// train. With no train ready, when the stepper has just woken up or the segment buffer ran dry, it
+// takes a single step as stepper_pulse_func() does, and goes idle if no segment has come.
+static void IRAM_ATTR stepper_train_func() {
+    auto n_axis = st.n_axis;
+
+    if (st_train.events == 0) {
+        st_fill_train(n_axis);
+        if (st_train.events == 0) {
+            stepper_pulse_func();
+            return;
+        }
+    }
+    motors_direction(st_train.dir_bits);
+    motors_send_trains(st_train.items, st_train.step_bits);
+    uint32_t ticks = st_train.ticks;
+    st_fill_train(n_axis);
+    // The fill wrote the step period of each segment it loaded. Wait for the whole train instead.
+    timer_set_alarm_value(STEP_TIMER_GROUP, STEP_TIMER_INDEX, ticks);
+}
+#endif
+
+// Allocates the segment buffer with $Stepper/Segments segments and sets the segment time from
+// $Stepper/SegmentRate. Called at startup, after the settings are loaded; like the planner buffer,
+// the segment buffer cannot be resized while segments may be queued, so changes to either setting
+// take effect at the next restart.
 void stepper_init() {
     busy.store(false); 
     
     grbl_msg_sendf(CLIENT_SERIAL, MsgLevel::Info, "Axis count %d", number_axis->get());
     grbl_msg_sendf(CLIENT_SERIAL, MsgLevel::Info, "%s", stepper_names[current_stepper]);
 
+    free(segment_buffer);
+    free(st_block_buffer);
+    segment_buffer_size = stepper_segments->get();
+    segment_buffer      = (segment_t*)calloc(segment_buffer_size, sizeof(segment_t));
+    st_block_buffer     = (st_block_t*)calloc(segment_buffer_size - 1, sizeof(st_block_t));
+    if (segment_buffer == NULL || st_block_buffer == NULL) {
+        grbl_msg_sendf(CLIENT_SERIAL, MsgLevel::Error, "No memory for %d segments", segment_buffer_size);
+        free(segment_buffer);
+        free(st_block_buffer);
+        segment_buffer_size = SEGMENT_BUFFER_SIZE;
+        segment_buffer      = (segment_t*)calloc(segment_buffer_size, sizeof(segment_t));
+        st_block_buffer     = (st_block_t*)calloc(segment_buffer_size - 1, sizeof(st_block_t));
+    }
+    buffer_stats           = {};
+    buffer_stats.size      = segment_buffer_size;
+    buffer_stats.rate      = stepper_segment_rate->get();
+    buffer_stats.low_water = segment_buffer_size;
+
+    segment_time = 1.0 / (buffer_stats.rate * 60.0);
+    // The segments queued ahead of the ISR are all the time the rest of Grbl has to refill them.
+    float lead_ms = (segment_buffer_size - 1) * 1000.0 / buffer_stats.rate;
+    if (lead_ms < MIN_SEGMENT_BUFFER_MS) {
+        grbl_msg_sendf(CLIENT_SERIAL, MsgLevel::Warning, "Segment buffer holds only %.0f ms", lead_ms);
+    }
+    grbl_msg_sendf(CLIENT_SERIAL, MsgLevel::Info, "Segments %d at %d Hz", segment_buffer_size, buffer_stats.rate);
+
 #ifdef USE_I2S_STEPS
     // I2S stepper stream mode use callback but timer interrupt
     i2s_out_set_pulse_callback(stepper_pulse_func);
@@ -388,7 +821,7 @@ void stepper_switch(stepper_id_t new_stepper) {
 void st_wake_up() {
     //grbl_msg_sendf(CLIENT_SERIAL, MsgLevel::Info, "st_wake_up");
     // Enable stepper drivers.
-    motors_set_disable(false);
+    bool enabled = motors_set_disable(false);
     stepper_idle = false;
 
     // Initialize step pulse timing from settings. Here to ensure updating after re-writing.
@@ -404,6 +837,44 @@ void st_wake_up() {
     st.step_pulse_time = -(((pulse_microseconds->get() - 2) * ticksPerMicrosecond) >> 3);
 #endif
 
+    st.n_axis       = number_axis->get();
+    st.pulse_us     = pulse_microseconds->get();
+    st.dir_delay_us = direction_delay_microseconds->get();
+    // With every step pin on a GPIO, step through the GPIO registers. The plan is made again here,
+    // as the settings and ganged_mode it comes from may have changed since the last motion.
+    st.gpio_plan = current_stepper == ST_TIMED && motors_step_plan(&step_plan);
+    // Step pulses from the step timer end in an interrupt of the pulse timer, rather than in a
+    // spin at the end of each step.
+    st.pulse_timer     = current_stepper == ST_TIMED || current_stepper == ST_I2S_STATIC;
+    st.dir_setup_ticks = (st.pulse_us + st.dir_delay_us) * ticksPerMicrosecond;
+    timer_set_alarm_value(STEP_TIMER_GROUP, PULSE_TIMER_INDEX, st.pulse_us * ticksPerMicrosecond);
+
+#ifdef USE_I2S_STEPS
+    // Fill the I2S stream a buffer at a time when the step pulses of every motor can be written
+    // straight into its samples, and a pulse at a time otherwise.
+    i2s_out_set_fill_callback(motors_i2s_step_bits(i2s_step_bits) ? stepper_fill_func : NULL);
+#endif
+#ifdef RMT_STEP_TRAINS
+    // The stepper works a train ahead of the motors, so the steps of laser power, probing and
+    // homing still go out one at a time.
+    st.trains = current_stepper == ST_RMT && !spindle->inLaserMode() && sys_probe_state != Probe::Active &&
+                sys.state != State::Homing && motors_rmt_trains();
+#endif
+
+    // Drivers that need time after they are enabled get it before the first interrupt, rather than
+    // in a spin here. The I2S stream starts at once, so it still waits.
+    auto enable_delay = enable_delay_microseconds->get();
+    if (enabled && enable_delay != 0) {
+        if (current_stepper == ST_I2S_STREAM) {
+            auto enable_start_time = esp_timer_get_time() + enable_delay;
+            while ((esp_timer_get_time() - enable_start_time) < 0) {
+                NOP();
+            }
+        } else {
+            Stepper_Timer_WritePeriod(enable_delay * ticksPerMicrosecond);
+        }
+    }
+
     // Enable Stepper Driver Interrupt
     Stepper_Timer_Start();
 }
@@ -430,6 +901,9 @@ void st_reset() {
     segment_next_head   = 1;
     st.step_outbits     = 0;
     st.dir_outbits      = 0;  // Initialize direction bits to default.
+#ifdef RMT_STEP_TRAINS
+    st_train.events = 0;
+#endif
     // TODO do we need to turn step pins off?
 }
 
@@ -463,7 +937,7 @@ void st_go_idle() {
 void st_update_plan_block_parameters() {
     if (pl_block != NULL) {  // Ignore if at start of a new block.
         prep.recalculate_flag.recalculate = 1;
-        pl_block->entry_speed_sqr         = prep.current_speed * prep.current_speed;  // Update entry speed.
+        pl_profile->entry_speed_sqr       = prep.current_speed * prep.current_speed;  // Update entry speed.
         pl_block                          = NULL;  // Flag st_prep_segment() to load and check active velocity profile.
     }
 }
@@ -507,7 +981,365 @@ void st_parking_restore_buffer() {
 // Increments the step segment buffer block data ring buffer.
 static uint8_t st_next_block_index(uint8_t block_index) {
     block_index++;
-    return block_index == (SEGMENT_BUFFER_SIZE - 1) ? 0 : block_index;
+    return block_index == (segment_buffer_size - 1) ? 0 : block_index;
+}
+
+/* S-curve ramps. A block with a jerk changes speed with the acceleration held within the block
+   acceleration, and changed at no more than the jerk: the acceleration rises from zero, holds,
+   and falls back to zero. Segment prep carries the current acceleration from block to block, so
+   a ramp through many short blocks is one S-curve, not one per block.
+     The planner plans the entry speed of each block for the deceleration through it, which may
+   end several blocks ahead (see plan_ramp_t). Prep speeds up to the nominal speed of the block
+   as fast as the jerk allows, and starts to slow down at the last moment from which that
+   deceleration still ends at its end speed. At any time, the rest of the move is an s_curve_t,
+   worked out again at each segment from the current speed and acceleration. The stepper ISR
+   still runs constant-rate segments.
+     A feed hold slows down on a linear ramp, as in a block without a jerk, and starts from the
+   acceleration it finds.
+*/
+
+// A change of speed: a jerk phase, a phase at constant acceleration and a jerk phase that brings
+// the acceleration back to zero. Then a cruise.
+typedef struct {
+    float jerk[3];  // (mm/min^3)
+    float time[3];  // (min)
+} s_curve_t;
+
+// Plans the fastest change from the speed and acceleration to end_speed, at zero acceleration.
+static void s_curve_plan(s_curve_t* curve, float speed, float accel, float end_speed) {
+    float jerk  = prep.ramp_jerk;
+    float limit = prep.ramp_accel;
+    // Plan a speed-up. A slow-down is its mirror image.
+    float sign = speed + accel * fabs(accel) / (2 * jerk) > end_speed ? -1.0 : 1.0;
+    float gain = (end_speed - speed) * sign;
+    accel *= sign;
+    // Without a hold, the peak acceleration gives a gain of (2 * peak^2 - accel^2) / (2 * jerk).
+    float peak = MAX(sqrt(MAX(jerk * gain + 0.5 * accel * accel, 0.0)), accel);
+    float hold = 0.0;
+    if (peak > limit) {
+        // Hold at the limit. An acceleration above it, as from a block with a higher one, comes down to it.
+        float ramps = accel < limit ? (limit * limit - 0.5 * accel * accel) / jerk : 0.5 * accel * accel / jerk;
+        hold        = MAX((gain - ramps) / limit, 0.0);
+        peak        = limit;
+    }
+    curve->jerk[0] = peak >= accel ? sign * jerk : -sign * jerk;
+    curve->time[0] = fabs(peak - accel) / jerk;
+    curve->jerk[1] = 0.0;
+    curve->time[1] = hold;
+    curve->jerk[2] = -sign * jerk;
+    curve->time[2] = peak / jerk;
+}
+
+// Follows a curve for a time, from the speed and acceleration, and updates them. Returns the distance.
+static float s_curve_move(const s_curve_t* curve, float time, float& speed, float& accel) {
+    float mm = 0.0;
+    for (int i = 0; i < 3; i++) {
+        float t = MIN(time, curve->time[i]);
+        float j = curve->jerk[i];
+        mm += t * (speed + t * (0.5 * accel + t * j / 6.0));
+        speed += t * (accel + 0.5 * t * j);
+        accel += t * j;
+        time -= t;
+    }
+    if (time > 0.0) {  // Cruise
+        accel = 0.0;
+        mm += speed * time;
+    }
+    return mm;
+}
+
+// Returns the end speed of the deceleration from the speed and acceleration. The planner plans the
+// ramps after it from zero acceleration, so an acceleration left from speeding up must be gone by
+// then, even below the end speed of the ramp.
+static float s_curve_decel_speed(float speed, float accel) {
+    return MAX(MIN(prep.ramp_speed, speed + accel * fabs(accel) / (2 * prep.ramp_jerk)), 0.0);
+}
+
+// Returns how much further the deceleration through the end of the block could start, after
+// leaving the speed and acceleration mm_remaining before the end of the block. Negative if it
+// must already have started.
+static float s_curve_slack(float speed, float accel, float mm_remaining) {
+    float mm          = mm_remaining + prep.ramp_end_mm;
+    float decel_speed = s_curve_decel_speed(speed, accel);
+    if (accel > 0.0 || decel_speed < speed + accel * fabs(accel) / (2 * prep.ramp_jerk)) {
+        s_curve_t curve;
+        s_curve_plan(&curve, speed, accel, decel_speed);
+        mm -= s_curve_move(&curve, curve.time[0] + curve.time[1] + curve.time[2], speed, accel);
+    }
+    return mm;
+}
+
+// Returns the time the curve takes to cover mm from the speed and acceleration. The distance is a
+// cubic in time within a jerk phase, and a quadratic at constant acceleration, so it is solved in the
+// phase it ends in: the quadratic exactly, and a jerk phase from there by Newton's method, which
+// is close to start with, as the jerk adds little over the time of a segment.
+static float s_curve_time(const s_curve_t* curve, float mm, float speed, float accel) {
+    float time = 0.0;
+    for (int i = 0; i < 3; i++) {
+        float t = curve->time[i];
+        float j = curve->jerk[i];
+        if (t * (speed + t * (0.5 * accel + t * j / 6.0)) >= mm) {
+            // Solve speed * t + accel * t^2 / 2 = mm, in a form that keeps its precision when accel is small.
+            float root = speed + sqrt(MAX(speed * speed + 2 * accel * mm, 0.0));
+            float x    = root > 0.0 ? MIN(2 * mm / root, t) : t;
+            for (int n = 0; n < 4 && j != 0.0; n++) {
+                float v = speed + x * (accel + 0.5 * x * j);
+                if (v <= 0.0) {
+                    break;
+                }
+                float dx = (x * (speed + x * (0.5 * accel + x * j / 6.0)) - mm) / v;
+                x        = MAX(MIN(x - dx, t), 0.0);
+                if (fabs(dx) < 1e-6 * x) {
+                    break;
+                }
+            }
+            return time + x;
+        }
+        mm -= t * (speed + t * (0.5 * accel + t * j / 6.0));
+        speed += t * (accel + 0.5 * t * j);
+        accel += t * j;
+        time += t;
+    }
+    return time + mm / speed;  // Cruise
+}
+
+// How early the deceleration may start, in steps, to save finding the last moment exactly.
+const float S_CURVE_SLACK_STEPS = 0.1;
+
+// Advances the S-curve by time_var, updating mm_remaining, the current speed and acceleration.
+// RAMP_S_CURVE heads for the maximum speed, until it is time to decelerate, and RAMP_S_CURVE_DECEL
+// for the end speed of the deceleration. Returns false at the end of the block, with mm_remaining
+// at zero and time_var cut to the time it took.
+static bool s_curve_advance(float& time_var, float& mm_remaining) {
+    float time_left = time_var;
+    while (true) {
+        bool      decel = prep.ramp_type == RAMP_S_CURVE_DECEL;
+        s_curve_t curve;
+        float     end_speed = prep.maximum_speed;
+        if (decel) {
+            end_speed = s_curve_decel_speed(prep.current_speed, prep.current_accel);
+        }
+        s_curve_plan(&curve, prep.current_speed, prep.current_accel, end_speed);
+        float time  = time_left;
+        float speed = prep.current_speed;
+        float accel = prep.current_accel;
+        float mm    = s_curve_move(&curve, time, speed, accel);
+        bool  end   = false;
+        if (decel && end_speed == 0.0 && mm < mm_remaining) {
+            float stop = curve.time[0] + curve.time[1] + curve.time[2];
+            if (stop <= time) {
+                // Stopped. Whatever rounding leaves of the block is covered as the speed reaches zero.
+                time = stop;
+                mm   = mm_remaining;
+                end  = true;
+            }
+        } else if (mm >= mm_remaining) {
+            // The block ends in the time.
+            time  = MIN(s_curve_time(&curve, mm_remaining, prep.current_speed, prep.current_accel), time);
+            speed = prep.current_speed;
+            accel = prep.current_accel;
+            s_curve_move(&curve, time, speed, accel);
+            if (decel && end_speed == 0.0) {
+                speed = 0.0;  // Stopped, up to rounding
+                accel = 0.0;
+            }
+            mm  = mm_remaining;
+            end = true;
+        }
+        float slack;
+        if (!decel && (slack = s_curve_slack(speed, accel, mm_remaining - mm)) < 0.0) {
+            // Find the last moment to start the deceleration. The slack falls through the time, so the
+            // Illinois variant of regula falsi closes in on where it crosses zero, from the side where it
+            // is left, until that is within S_CURVE_SLACK_STEPS.
+            float low        = 0.0;
+            float low_slack  = s_curve_slack(prep.current_speed, prep.current_accel, mm_remaining);
+            float high       = time;
+            float high_slack = slack;
+            float tolerance  = S_CURVE_SLACK_STEPS / prep.step_per_mm;
+            int   side       = 0;
+            for (int i = 0; i < 8 && low_slack > tolerance; i++) {
+                float t = (low * high_slack - high * low_slack) / (high_slack - low_slack);
+                speed   = prep.current_speed;
+                accel   = prep.current_accel;
+                mm      = s_curve_move(&curve, t, speed, accel);
+                slack   = s_curve_slack(speed, accel, mm_remaining - mm);
+                if (slack < 0.0) {
+                    high       = t;
+                    high_slack = slack;
+                    if (side < 0) {
+                        low_slack *= 0.5;
+                    }
+                    side = -1;
+                } else {
+                    low       = t;
+                    low_slack = slack;
+                    if (side > 0) {
+                        high_slack *= 0.5;
+                    }
+                    side = 1;
+                }
+            }
+            time           = low;
+            speed          = prep.current_speed;
+            accel          = prep.current_accel;
+            mm             = s_curve_move(&curve, time, speed, accel);
+            end            = false;
+            prep.ramp_type = RAMP_S_CURVE_DECEL;
+        }
+        prep.current_speed = speed;
+        prep.current_accel = accel;
+        mm_remaining -= mm;
+        time_left -= time;
+        if (end) {
+            mm_remaining = 0.0;
+            time_var -= time_left;
+            return false;
+        }
+        if (time_left <= 0.0) {
+            return true;
+        }
+    }
+}
+
+/* Curved planner blocks. A G2/G3 arc or G5 spline is a single planner block, and each of its
+   segments is prepped as a short line between two points on the curve, rounded to whole steps.
+   The axis directions change along the curve, so every segment gets a stepper block of its own,
+   and the ISR restarts its Bresenham counters for each. The stepper block ring holds as many
+   blocks as the segment buffer holds segments, so the block being prepped is never in use.
+*/
+
+// Sets up segment prep for a newly loaded curved planner block.
+static void st_prep_curve_block() {
+    // A chord of the curve moves some axis by a whole step if it is at least sqrt(n) times the
+    // coarsest step of the n axes that move. Taking that as the step length gives each segment
+    // a step, as it does for a line.
+    float   mm_per_step = 0.0;
+    uint8_t n_moving    = 0;
+    auto    n_axis      = number_axis->get();
+    for (uint8_t idx = 0; idx < n_axis; idx++) {
+        if (idx == pl_curve->axis_0 || idx == pl_curve->axis_1 || pl_curve->delta[idx] != 0.0) {
+            mm_per_step = MAX(mm_per_step, 1.0 / axis_settings[idx]->steps_per_mm->get());
+            n_moving++;
+        }
+    }
+    prep.step_per_mm     = 1.0 / (sqrt(n_moving) * mm_per_step);
+    prep.steps_remaining = prep_steps(prep.step_per_mm * pl_profile->millimeters);
+    memset(prep.curve_steps, 0, sizeof(prep.curve_steps));
+    // Segments are chords of the curve. Keep them within the arc tolerance around the tightest bend.
+    float tolerance  = arc_tolerance->get();
+    float radius     = pl_curve->radius;
+    prep.curve_chord = radius > tolerance ? 2 * sqrt(tolerance * (2 * radius - tolerance)) : 2 * radius;
+}
+
+// Returns the timer ticks per step event of a block at its programmed rate, for st_laser_rate_rpm().
+static uint32_t st_prep_laser_period(float mm_per_event) {
+    float ticks = (fStepperTimer * 60.0) * prep.inv_rate * mm_per_event;
+    return ticks < 0xffffff ? ticks : 0xffffff;  // Room for the fraction bits of the rate ratio
+}
+
+// Loads the next stepper block with the steps from the end of the segment buffer to the point
+// mm_remaining from the end of the curve, and returns the number of step events. Returns zero,
+// and loads nothing, if the point rounds to the same steps.
+static uint32_t st_prep_curve_segment(float mm_remaining) {
+    int32_t steps[MAX_N_AXIS];
+    uint8_t idx;
+    auto    n_axis = number_axis->get();
+    if (mm_remaining > 0.0) {
+        float offset[MAX_N_AXIS];
+        plan_curve_point(pl_curve, pl_curve->length - mm_remaining, offset);
+        for (idx = 0; idx < n_axis; idx++) {
+            steps[idx] = lround(offset[idx] * axis_settings[idx]->steps_per_mm->get());
+        }
+    } else {
+        // End exactly where the planner ended the block.
+        for (idx = 0; idx < n_axis; idx++) {
+            steps[idx] = (pl_block->direction_bits & bit(idx)) ? -(int32_t)pl_block->steps[idx] : pl_block->steps[idx];
+        }
+    }
+    uint32_t step_event_count = 0;
+    for (idx = 0; idx < n_axis; idx++) {
+        step_event_count = MAX(step_event_count, (uint32_t)labs(steps[idx] - prep.curve_steps[idx]));
+    }
+    if (step_event_count == 0) {
+        return 0;
+    }
+    if (prep.st_block_used) {
+        bool is_pwm_rate_adjusted           = st_prep_block->is_pwm_rate_adjusted;
+        prep.st_block_index                 = st_next_block_index(prep.st_block_index);
+        st_prep_block                       = &st_block_buffer[prep.st_block_index];
+        st_prep_block->is_pwm_rate_adjusted = is_pwm_rate_adjusted;
+        st_prep_block->raster               = NULL;
+    }
+    st_prep_block->direction_bits = 0;
+    float chord_sqr               = 0.0;
+    for (idx = 0; idx < n_axis; idx++) {
+        int32_t delta = steps[idx] - prep.curve_steps[idx];
+        if (delta < 0) {
+            st_prep_block->direction_bits |= bit(idx);
+        }
+        st_prep_block->steps[idx] = labs(delta) << maxAmassLevel;
+        prep.curve_steps[idx]     = steps[idx];
+        float mm                  = delta / axis_settings[idx]->steps_per_mm->get();
+        chord_sqr += mm * mm;
+    }
+    st_prep_block->step_event_count = step_event_count << maxAmassLevel;
+    if (st_prep_block->is_pwm_rate_adjusted) {
+        st_prep_block->laser_period = st_prep_laser_period(sqrt(chord_sqr) / step_event_count);
+    }
+    prep.st_block_used = true;
+    return step_event_count;
+}
+
+// Fractional bits of the step periods that segment prep works out, in timer ticks, before they are
+// rounded to the whole ticks of the ISR period.
+const int PREP_PERIOD_SHIFT = 8;
+
+// Returns the timer ticks per step, with PREP_PERIOD_SHIFT fractional bits, for a segment that takes
+// dt minutes over the given distance in steps, partial_step of which is left for the next segment to
+// execute. The time of that partial step is carried to the next segment. A segment with no steps
+// carries all of its time.
+static uint32_t st_prep_step_period(float dt, prep_steps_t steps, prep_steps_t partial_step) {
+#ifdef FIXED_POINT_PREP
+    prep_time_t ticks = prep_time_t(dt * (fStepperTimer * 60.0f * PREP_ONE)) + prep.dt_remainder;
+    if (steps <= 0) {
+        prep.dt_remainder = ticks;
+        return UINT32_MAX;
+    }
+    prep.dt_remainder = partial_step * ticks / steps;
+    return MIN(((ticks << PREP_PERIOD_SHIFT) + steps / 2) / steps, prep_time_t(UINT32_MAX));
+#else
+    dt += prep.dt_remainder;  // Apply previous segment partial step execute time
+    if (steps <= 0.0) {
+        prep.dt_remainder = dt;
+        return UINT32_MAX;
+    }
+    // dt is in minutes so inv_rate is in minutes
+    float inv_rate    = dt / steps;  // Compute adjusted step rate inverse
+    prep.dt_remainder = partial_step * inv_rate;
+    // fStepperTimer is in units of timerTicks/sec, so the dimensional analysis is
+    // timerTicks/sec * 60 sec/minute * minutes = timerTicks
+    float period = (fStepperTimer * 60.0f * (1 << PREP_PERIOD_SHIFT)) * inv_rate;  // (timerTicks/step)
+    return period < 4294967040.0f ? uint32_t(period + 0.5f) : UINT32_MAX;
+#endif
+}
+
+// Rounds the ISR period, with PREP_PERIOD_SHIFT fractional bits, to whole timer ticks. The time that
+// the n_isr interrupts of the segment gain or lose by it is carried to the next segment, like the
+// time of a partial step, so the steps come at the planned rate on average however the period falls
+// between ticks. This matters most to the I2S stream, which counts time in coarser units still. The
+// ISR period is stored as 16 bits, so a longer one is limited to the largest value that fits.
+static uint16_t st_prep_isr_period(uint32_t period, uint32_t n_isr) {
+    uint32_t ticks = (period + (1 << (PREP_PERIOD_SHIFT - 1))) >> PREP_PERIOD_SHIFT;
+    if (ticks > 0xffff) {
+        return 0xffff;
+    }
+    int64_t gained = (int64_t(period) - (int64_t(ticks) << PREP_PERIOD_SHIFT)) * n_isr;
+#ifdef FIXED_POINT_PREP
+    prep.dt_remainder += gained << (16 - PREP_PERIOD_SHIFT);
+#else
+    prep.dt_remainder += gained * (1.0f / (fStepperTimer * 60.0f * (1 << PREP_PERIOD_SHIFT)));
+#endif
+    return ticks;
 }
 
 /* Prepares step segment buffer. Continuously called from main program.
@@ -542,6 +1374,9 @@ void st_prep_buffer() {
             if (pl_block == NULL) {
                 return;  // No planner blocks. Exit.
             }
+            pl_profile = plan_get_profile(pl_block);
+            pl_curve   = plan_get_curve(pl_block);
+            pl_ramp    = plan_get_ramp(pl_block);
 
             // Check if we need to only recompute the velocity profile or load a new block.
             if (prep.recalculate_flag.recalculate) {
@@ -573,18 +1408,46 @@ void st_prep_buffer() {
                 }
                 st_prep_block->step_event_count = pl_block->step_event_count << maxAmassLevel;
 
+                // Count the pixels of a raster on the axis with the most steps.
+                st_prep_block->raster = plan_get_raster(pl_block);
+                if (st_prep_block->raster != NULL) {
+                    uint8_t raster_axis = 0;
+                    for (idx = 1; idx < n_axis; idx++) {
+                        if (pl_block->steps[idx] > pl_block->steps[raster_axis]) {
+                            raster_axis = idx;
+                        }
+                    }
+                    st_prep_block->raster_axis  = raster_axis;
+                    st_prep_block->raster_steps = pl_block->steps[raster_axis];
+                    st_prep_block->raster_count = pl_block->raster_count;
+                    st_prep_block->raster_end   = pl_block->raster_start + pl_block->raster_count;
+                }
+
                 // Initialize segment buffer data for generating the segments.
-                prep.steps_remaining  = (float)pl_block->step_event_count;
-                prep.step_per_mm      = prep.steps_remaining / pl_block->millimeters;
+                if (pl_curve == NULL) {
+#ifdef FIXED_POINT_PREP
+                    prep.steps_remaining = pl_block->step_event_count * PREP_ONE;
+#else
+                    prep.steps_remaining = (float)pl_block->step_event_count;
+#endif
+                    prep.step_per_mm = pl_block->step_event_count / pl_profile->millimeters;
+                } else {
+                    st_prep_curve_block();
+                }
                 prep.req_mm_increment = REQ_MM_INCREMENT_SCALAR / prep.step_per_mm;
-                prep.dt_remainder     = 0.0;  // Reset for new segment block
+                prep.dt_remainder     = 0;  // Reset for new segment block
+                prep.st_block_used    = false;
                 if ((sys.step_control.executeHold) || prep.recalculate_flag.decelOverride) {
                     // New block loaded mid-hold. Override planner block entry speed to enforce deceleration.
                     prep.current_speed                  = prep.exit_speed;
-                    pl_block->entry_speed_sqr           = prep.exit_speed * prep.exit_speed;
+                    pl_profile->entry_speed_sqr         = prep.exit_speed * prep.exit_speed;
                     prep.recalculate_flag.decelOverride = 0;
+                } else if (prep.ramp_type >= RAMP_S_CURVE && pl_profile->entry_speed_sqr > 0.0) {
+                    // Carry on from the S-curve of the block before, which ends no faster than planned.
+                    pl_profile->entry_speed_sqr = prep.current_speed * prep.current_speed;
                 } else {
-                    prep.current_speed = sqrt(pl_block->entry_speed_sqr);
+                    prep.current_speed = sqrt(pl_profile->entry_speed_sqr);
+                    prep.current_accel = 0.0;
                 }
 
                 st_prep_block->is_pwm_rate_adjusted = false;  // set default value
@@ -594,6 +1457,7 @@ void st_prep_buffer() {
                         // Pre-compute inverse programmed rate to speed up PWM updating per step segment.
                         prep.inv_rate                       = 1.0 / pl_block->programmed_rate;
                         st_prep_block->is_pwm_rate_adjusted = true;
+                        st_prep_block->laser_period         = st_prep_laser_period(1.0 / prep.step_per_mm);
                     }
                 }
             }
@@ -604,24 +1468,45 @@ void st_prep_buffer() {
              hold, override the planner velocities and decelerate to the target exit speed.
             */
             prep.mm_complete  = 0.0;  // Default velocity profile complete at 0.0mm from end of block.
-            float inv_2_accel = 0.5 / pl_block->acceleration;
+            float inv_2_accel = 0.5 / pl_profile->acceleration;
             if (sys.step_control.executeHold) {  // [Forced Deceleration to Zero Velocity]
                 // Compute velocity profile parameters for a feed hold in-progress. This profile overrides
                 // the planner block profile, enforcing a deceleration to zero speed.
-                prep.ramp_type = RAMP_DECEL;
+                prep.ramp_type     = RAMP_DECEL;
+                prep.current_accel = 0.0;
                 // Compute decelerate distance relative to end of block.
-                float decel_dist = pl_block->millimeters - inv_2_accel * pl_block->entry_speed_sqr;
+                float decel_dist = pl_profile->millimeters - inv_2_accel * pl_profile->entry_speed_sqr;
                 if (decel_dist < 0.0) {
                     // Deceleration through entire planner block. End of feed hold is not in this block.
-                    prep.exit_speed = sqrt(pl_block->entry_speed_sqr - 2 * pl_block->acceleration * pl_block->millimeters);
+                    prep.exit_speed = sqrt(pl_profile->entry_speed_sqr - 2 * pl_profile->acceleration * pl_profile->millimeters);
                 } else {
                     prep.mm_complete = decel_dist;  // End of feed hold.
                     prep.exit_speed  = 0.0;
                 }
+            } else if (pl_ramp->jerk != 0.0) {  // [S-Curve Ramps]
+                prep.maximum_speed = plan_compute_profile_nominal_speed(pl_block);
+                plan_ramp_t exit_ramp;
+                if (sys.step_control.executeSysMotion) {
+                    exit_ramp.end_speed   = 0.0;  // Enforce stop at end of system motion.
+                    exit_ramp.end_mm      = 0.0;
+                    exit_ramp.accel_limit = pl_profile->acceleration;
+                    exit_ramp.jerk_limit  = pl_ramp->jerk;
+                } else {
+                    plan_get_exec_block_exit_ramp(&exit_ramp);
+                }
+                prep.ramp_speed  = exit_ramp.end_speed;
+                prep.ramp_end_mm = exit_ramp.end_mm;
+                prep.ramp_accel  = MIN(pl_profile->acceleration, exit_ramp.accel_limit);
+                prep.ramp_jerk   = MIN(pl_ramp->jerk, exit_ramp.jerk_limit);
+                if (s_curve_slack(prep.current_speed, prep.current_accel, pl_profile->millimeters) > 0.0) {
+                    prep.ramp_type = RAMP_S_CURVE;
+                } else {
+                    prep.ramp_type = RAMP_S_CURVE_DECEL;
+                }
             } else {  // [Normal Operation]
                 // Compute or recompute velocity profile parameters of the prepped planner block.
                 prep.ramp_type        = RAMP_ACCEL;  // Initialize as acceleration ramp.
-                prep.accelerate_until = pl_block->millimeters;
+                prep.accelerate_until = pl_profile->millimeters;
                 float exit_speed_sqr;
                 float nominal_speed;
                 if (sys.step_control.executeSysMotion) {
@@ -633,15 +1518,15 @@ void st_prep_buffer() {
 
                 nominal_speed            = plan_compute_profile_nominal_speed(pl_block);
                 float nominal_speed_sqr  = nominal_speed * nominal_speed;
-                float intersect_distance = 0.5 * (pl_block->millimeters + inv_2_accel * (pl_block->entry_speed_sqr - exit_speed_sqr));
-                if (pl_block->entry_speed_sqr > nominal_speed_sqr) {  // Only occurs during override reductions.
-                    prep.accelerate_until = pl_block->millimeters - inv_2_accel * (pl_block->entry_speed_sqr - nominal_speed_sqr);
+                float intersect_distance = 0.5 * (pl_profile->millimeters + inv_2_accel * (pl_profile->entry_speed_sqr - exit_speed_sqr));
+                if (pl_profile->entry_speed_sqr > nominal_speed_sqr) {  // Only occurs during override reductions.
+                    prep.accelerate_until = pl_profile->millimeters - inv_2_accel * (pl_profile->entry_speed_sqr - nominal_speed_sqr);
                     if (prep.accelerate_until <= 0.0) {  // Deceleration-only.
                         prep.ramp_type = RAMP_DECEL;
-                        // prep.decelerate_after = pl_block->millimeters;
+                        // prep.decelerate_after = pl_profile->millimeters;
                         // prep.maximum_speed = prep.current_speed;
                         // Compute override block exit speed since it doesn't match the planner exit speed.
-                        prep.exit_speed = sqrt(pl_block->entry_speed_sqr - 2 * pl_block->acceleration * pl_block->millimeters);
+                        prep.exit_speed = sqrt(pl_profile->entry_speed_sqr - 2 * pl_profile->acceleration * pl_profile->millimeters);
                         prep.recalculate_flag.decelOverride = 1;  // Flag to load next block as deceleration override.
                         // TODO: Determine correct handling of parameters in deceleration-only.
                         // Can be tricky since entry speed will be current speed, as in feed holds.
@@ -653,26 +1538,26 @@ void st_prep_buffer() {
                         prep.ramp_type        = RAMP_DECEL_OVERRIDE;
                     }
                 } else if (intersect_distance > 0.0) {
-                    if (intersect_distance < pl_block->millimeters) {  // Either trapezoid or triangle types
+                    if (intersect_distance < pl_profile->millimeters) {  // Either trapezoid or triangle types
                         // NOTE: For acceleration-cruise and cruise-only types, following calculation will be 0.0.
                         prep.decelerate_after = inv_2_accel * (nominal_speed_sqr - exit_speed_sqr);
                         if (prep.decelerate_after < intersect_distance) {  // Trapezoid type
                             prep.maximum_speed = nominal_speed;
-                            if (pl_block->entry_speed_sqr == nominal_speed_sqr) {
+                            if (pl_profile->entry_speed_sqr == nominal_speed_sqr) {
                                 // Cruise-deceleration or cruise-only type.
                                 prep.ramp_type = RAMP_CRUISE;
                             } else {
                                 // Full-trapezoid or acceleration-cruise types
-                                prep.accelerate_until -= inv_2_accel * (nominal_speed_sqr - pl_block->entry_speed_sqr);
+                                prep.accelerate_until -= inv_2_accel * (nominal_speed_sqr - pl_profile->entry_speed_sqr);
                             }
                         } else {  // Triangle type
                             prep.accelerate_until = intersect_distance;
                             prep.decelerate_after = intersect_distance;
-                            prep.maximum_speed    = sqrt(2.0 * pl_block->acceleration * intersect_distance + exit_speed_sqr);
+                            prep.maximum_speed    = sqrt(2.0 * pl_profile->acceleration * intersect_distance + exit_speed_sqr);
                         }
                     } else {  // Deceleration-only type
                         prep.ramp_type = RAMP_DECEL;
-                        // prep.decelerate_after = pl_block->millimeters;
+                        // prep.decelerate_after = pl_profile->millimeters;
                         // prep.maximum_speed = prep.current_speed;
                     }
                 } else {  // Acceleration-only type
@@ -682,6 +1567,16 @@ void st_prep_buffer() {
                 }
             }
 
+            // Shorten the segments of a curve so that none is a longer chord than curve_chord. The block
+            // runs no faster than its maximum speed, or the speed it starts at when slowing down.
+            if (pl_curve != NULL) {
+                float top_speed = prep.current_speed;
+                if (prep.ramp_type != RAMP_DECEL) {
+                    top_speed = MAX(top_speed, prep.maximum_speed);
+                }
+                prep.curve_dt = top_speed > 0.0 ? MIN(segment_time, prep.curve_chord / top_speed) : segment_time;
+            }
+
             sys.step_control.updateSpindleRpm = true;  // Force update whenever updating block.
         }
 
@@ -693,7 +1588,7 @@ void st_prep_buffer() {
 
         /*------------------------------------------------------------------------------------
             Compute the average velocity of this new segment by determining the total distance
-          traveled over the segment time DT_SEGMENT. The following code first attempts to create
+          traveled over the segment time segment_time. The following code first attempts to create
           a full segment based on the current ramp conditions. If the segment time is incomplete
           when terminating at a ramp state change, the code will continue to loop through the
           progressing ramp states to fill the remaining segment execution time. However, if
@@ -705,13 +1600,14 @@ void st_prep_buffer() {
           the end of planner block (typical) or mid-block at the end of a forced deceleration,
           such as from a feed hold.
         */
-        float dt_max   = DT_SEGMENT;                                // Maximum segment time
-        float dt       = 0.0;                                       // Initialize segment time
-        float time_var = dt_max;                                    // Time worker variable
-        float mm_var;                                               // mm-Distance worker variable
-        float speed_var;                                            // Speed worker variable
-        float mm_remaining = pl_block->millimeters;                 // New segment distance from end of block.
-        float minimum_mm   = mm_remaining - prep.req_mm_increment;  // Guarantee at least one step.
+        float dt_segment = pl_curve == NULL ? segment_time : prep.curve_dt;  // Segment time
+        float dt_max     = dt_segment;                                     // Maximum segment time
+        float dt         = 0.0;                                            // Initialize segment time
+        float time_var   = dt_max;                                         // Time worker variable
+        float mm_var;                                                      // mm-Distance worker variable
+        float speed_var;                                                   // Speed worker variable
+        float mm_remaining = pl_profile->millimeters;                      // New segment distance from end of block.
+        float minimum_mm   = mm_remaining - prep.req_mm_increment;         // Guarantee at least one step.
 
         if (minimum_mm < 0.0) {
             minimum_mm = 0.0;
@@ -720,27 +1616,31 @@ void st_prep_buffer() {
         do {
             switch (prep.ramp_type) {
                 case RAMP_DECEL_OVERRIDE:
-                    speed_var = pl_block->acceleration * time_var;
+                    speed_var = pl_profile->acceleration * time_var;
                     mm_var    = time_var * (prep.current_speed - 0.5 * speed_var);
                     mm_remaining -= mm_var;
                     if ((mm_remaining < prep.accelerate_until) || (mm_var <= 0)) {
                         // Cruise or cruise-deceleration types only for deceleration override.
                         mm_remaining       = prep.accelerate_until;  // NOTE: 0.0 at EOB
-                        time_var           = 2.0 * (pl_block->millimeters - mm_remaining) / (prep.current_speed + prep.maximum_speed);
+                        time_var           = 2.0 * (pl_profile->millimeters - mm_remaining) / (prep.current_speed + prep.maximum_speed);
                         prep.ramp_type     = RAMP_CRUISE;
                         prep.current_speed = prep.maximum_speed;
                     } else {  // Mid-deceleration override ramp.
                         prep.current_speed -= speed_var;
                     }
                     break;
+                case RAMP_S_CURVE:
+                case RAMP_S_CURVE_DECEL:
+                    s_curve_advance(time_var, mm_remaining);
+                    break;
                 case RAMP_ACCEL:
                     // NOTE: Acceleration ramp only computes during first do-while loop.
-                    speed_var = pl_block->acceleration * time_var;
+                    speed_var = pl_profile->acceleration * time_var;
                     mm_remaining -= time_var * (prep.current_speed + 0.5 * speed_var);
                     if (mm_remaining < prep.accelerate_until) {  // End of acceleration ramp.
                         // Acceleration-cruise, acceleration-deceleration ramp junction, or end of block.
                         mm_remaining = prep.accelerate_until;  // NOTE: 0.0 at EOB
-                        time_var     = 2.0 * (pl_block->millimeters - mm_remaining) / (prep.current_speed + prep.maximum_speed);
+                        time_var     = 2.0 * (pl_profile->millimeters - mm_remaining) / (prep.current_speed + prep.maximum_speed);
                         if (mm_remaining == prep.decelerate_after) {
                             prep.ramp_type = RAMP_DECEL;
                         } else {
@@ -767,8 +1667,8 @@ void st_prep_buffer() {
                     break;
                 default:  // case RAMP_DECEL:
                     // NOTE: mm_var used as a misc worker variable to prevent errors when near zero speed.
-                    speed_var = pl_block->acceleration * time_var;  // Used as delta speed (mm/min)
-                    if (prep.current_speed > speed_var) {           // Check if at or below zero speed.
+                    speed_var = pl_profile->acceleration * time_var;  // Used as delta speed (mm/min)
+                    if (prep.current_speed > speed_var) {             // Check if at or below zero speed.
                         // Compute distance from end of segment to end of block.
                         mm_var = mm_remaining - time_var * (prep.current_speed - 0.5 * speed_var);  // (mm)
                         if (mm_var > prep.mm_complete) {                                            // Typical case. In deceleration ramp.
@@ -790,7 +1690,7 @@ void st_prep_buffer() {
                 if (mm_remaining > minimum_mm) {  // Check for very slow segments with zero steps.
                     // Increase segment time to ensure at least one step in segment. Override and loop
                     // through distance calculations until minimum_mm or mm_complete.
-                    dt_max += DT_SEGMENT;
+                    dt_max += segment_time;
                     time_var = dt_max - dt;
                 } else {
                     break;  // **Complete** Exit loop. Segment execution time maxed.
@@ -801,19 +1701,12 @@ void st_prep_buffer() {
         /* -----------------------------------------------------------------------------------
           Compute spindle speed PWM output for step segment
         */
-        if (st_prep_block->is_pwm_rate_adjusted || sys.step_control.updateSpindleRpm) {
+        // NOTE: A rate adjusted laser (M4) gets the full power here. The ISR scales it by the step rate of
+        // each segment as it loads it, rather than by the speed at the end of the segment.
+        if (sys.step_control.updateSpindleRpm) {
             if (pl_block->spindle != SpindleState::Disable) {
-                float rpm = pl_block->spindle_speed;
                 // NOTE: Feed and rapid overrides are independent of PWM value and do not alter laser power/rate.
-                if (st_prep_block->is_pwm_rate_adjusted) {
-                    rpm *= (prep.current_speed * prep.inv_rate);
-                    //grbl_msg_sendf(CLIENT_SERIAL, MsgLevel::Info, "RPM %.2f", rpm);
-                    //grbl_msg_sendf(CLIENT_SERIAL, MsgLevel::Info, "Rates CV %.2f IV %.2f RPM %.2f", prep.current_speed, prep.inv_rate, rpm);
-                }
-                // If current_speed is zero, then may need to be rpm_min*(100/MAX_SPINDLE_SPEED_OVERRIDE)
-                // but this would be instantaneous only and during a motion. May not matter at all.
-
-                prep.current_spindle_rpm = rpm;
+                prep.current_spindle_rpm = pl_block->spindle_speed;
             } else {
                 sys.spindle_speed        = 0.0;
                 prep.current_spindle_rpm = 0.0;
@@ -830,12 +1723,20 @@ void st_prep_buffer() {
            However, since floats have only 7.2 significant digits, long moves with extremely
            high step counts can exceed the precision of floats, which can lead to lost steps.
            Fortunately, this scenario is highly unlikely and unrealistic in CNC machines
-           supported by Grbl (i.e. exceeding 10 meters axis travel at 200 step/mm).
+           supported by Grbl (i.e. exceeding 10 meters axis travel at 200 step/mm). With
+           FIXED_POINT_PREP, steps are counted down from the exact step count of the block, so none
+           are lost however long the block is.
         */
-        float step_dist_remaining    = prep.step_per_mm * mm_remaining;             // Convert mm_remaining to steps
-        float n_steps_remaining      = ceil(step_dist_remaining);                   // Round-up current steps remaining
-        float last_n_steps_remaining = ceil(prep.steps_remaining);                  // Round-up last steps remaining
-        prep_segment->n_step         = last_n_steps_remaining - n_steps_remaining;  // Compute number of steps to execute.
+        // Convert mm_remaining to steps, then round up the current and last steps remaining.
+        prep_steps_t step_dist_remaining    = MIN(prep_steps(prep.step_per_mm * mm_remaining), prep.steps_remaining);
+        prep_steps_t n_steps_remaining      = prep_ceil(step_dist_remaining);
+        prep_steps_t last_n_steps_remaining = prep_ceil(prep.steps_remaining);
+        if (pl_curve == NULL) {
+            prep_segment->n_step = prep_whole_steps(last_n_steps_remaining - n_steps_remaining);  // Compute number of steps to execute.
+        } else {
+            prep_segment->n_step         = st_prep_curve_segment(mm_remaining);  // A line of its own, to the point on the curve.
+            prep_segment->st_block_index = prep.st_block_index;
+        }
 
         // Bail if we are at the end of a feed hold and don't have a step to execute.
         if (prep_segment->n_step == 0) {
@@ -861,38 +1762,46 @@ void st_prep_buffer() {
         // typically very small and do not adversely effect performance, but ensures that Grbl
         // outputs the exact acceleration and velocity profiles as computed by the planner.
 
-        dt += prep.dt_remainder;  // Apply previous segment partial step execute time
-        // dt is in minutes so inv_rate is in minutes
-        float inv_rate = dt / (last_n_steps_remaining - step_dist_remaining);  // Compute adjusted step rate inverse
+        uint32_t period;
+        if (pl_curve == NULL) {
+            period = st_prep_step_period(dt, last_n_steps_remaining - step_dist_remaining, n_steps_remaining - step_dist_remaining);
+        } else {
+            // A curve segment ends on a whole step, so there is no partial step to carry. A segment without a
+            // step, where the curve turns back on an axis, is not queued and its time goes to the next one.
+            period = st_prep_step_period(dt, prep_steps(prep_segment->n_step), 0);
+        }
 
-        // Compute CPU cycles per step for the prepped segment.
-        // fStepperTimer is in units of timerTicks/sec, so the dimensional analysis is
-        // timerTicks/sec * 60 sec/minute * minutes = timerTicks
-        uint32_t timerTicks = ceil((fStepperTimer * 60) * inv_rate);  // (timerTicks/step)
-        int      level;
+        if (prep_segment->n_step != 0 || pl_curve == NULL) {
+            // Compute CPU cycles per step for the prepped segment.
+            int level;
 
-        // Compute step timing and multi-axis smoothing level.
-        for (level = 0; level < maxAmassLevel; level++) {
-            if (timerTicks < amassThreshold) {
-                break;
+            // Compute step timing and multi-axis smoothing level.
+            for (level = 0; level < maxAmassLevel; level++) {
+                if (period < (amassThreshold << PREP_PERIOD_SHIFT)) {
+                    break;
+                }
+                period >>= 1;
+            }
+            prep_segment->amass_level = level;
+            prep_segment->n_step <<= level;
+            prep_segment->isrPeriod = st_prep_isr_period(period, prep_segment->n_step);
+
+            // Segment complete! Increment segment buffer indices, so stepper ISR can immediately execute it.
+            segment_buffer_head = segment_next_head;
+            if (++segment_next_head == segment_buffer_size) {
+                segment_next_head = 0;
+            }
+            int queued = segment_buffer_head - segment_buffer_tail;
+            if (queued < 0) {
+                queued += segment_buffer_size;
+            }
+            if (queued > buffer_stats.high_water) {
+                buffer_stats.high_water = queued;
             }
-            timerTicks >>= 1;
-        }
-        prep_segment->amass_level = level;
-        prep_segment->n_step <<= level;
-        // isrPeriod is stored as 16 bits, so limit timerTicks to the
-        // largest value that will fit in a uint16_t.
-        prep_segment->isrPeriod = timerTicks > 0xffff ? 0xffff : timerTicks;
-
-        // Segment complete! Increment segment buffer indices, so stepper ISR can immediately execute it.
-        segment_buffer_head = segment_next_head;
-        if (++segment_next_head == SEGMENT_BUFFER_SIZE) {
-            segment_next_head = 0;
         }
         // Update the appropriate planner and segment data.
-        pl_block->millimeters = mm_remaining;
-        prep.steps_remaining  = n_steps_remaining;
-        prep.dt_remainder     = (n_steps_remaining - step_dist_remaining) * inv_rate;
+        pl_profile->millimeters = mm_remaining;
+        prep.steps_remaining    = n_steps_remaining;
         // Check for exit conditions and flag to load next planner block.
         if (mm_remaining == prep.mm_complete) {
             // End of planner block or forced-termination. No more distance to be executed.
@@ -937,6 +1846,10 @@ float st_get_realtime_rate() {
     }
 }
 
+st_buffer_stats_t st_get_buffer_stats() {
+    return buffer_stats;
+}
+
 // The argument is in units of ticks of the timer that generates ISRs
 void IRAM_ATTR Stepper_Timer_WritePeriod(uint16_t timerTicks) {
     if (current_stepper == ST_I2S_STREAM) {
@@ -963,6 +1876,15 @@ void IRAM_ATTR Stepper_Timer_Init() {
     timer_set_counter_value(STEP_TIMER_GROUP, STEP_TIMER_INDEX, 0x00000000ULL);
     timer_enable_intr(STEP_TIMER_GROUP, STEP_TIMER_INDEX);
     timer_isr_register(STEP_TIMER_GROUP, STEP_TIMER_INDEX, onStepperDriverTimer, NULL, 0, NULL);
+
+    // The pulse timer counts on from each step pulse, which restarts its count and arms its alarm
+    // to end the pulse.
+    config.counter_en  = TIMER_START;
+    config.alarm_en    = TIMER_ALARM_DIS;
+    config.auto_reload = false;
+    timer_init(STEP_TIMER_GROUP, PULSE_TIMER_INDEX, &config);
+    timer_enable_intr(STEP_TIMER_GROUP, PULSE_TIMER_INDEX);
+    timer_isr_register(STEP_TIMER_GROUP, PULSE_TIMER_INDEX, onStepperPulseTimer, NULL, 0, NULL);
 }
 
 void IRAM_ATTR Stepper_Timer_Start() {
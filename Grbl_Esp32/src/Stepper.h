@@ -32,12 +32,14 @@
 #include "Config.h"
 
 // Some useful constants.
-const double DT_SEGMENT              = (1.0 / (ACCELERATION_TICKS_PER_SECOND * 60.0));  // min/segment
 const double REQ_MM_INCREMENT_SCALAR = 1.25;
+const int    MIN_SEGMENT_BUFFER_MS   = 20;  // Less lead time in the segment buffer draws a warning at startup
 const int    RAMP_ACCEL              = 0;
 const int    RAMP_CRUISE             = 1;
 const int    RAMP_DECEL              = 2;
 const int    RAMP_DECEL_OVERRIDE     = 3;
+const int    RAMP_S_CURVE            = 4;  // In a block with a jerk. See s_curve_advance().
+const int    RAMP_S_CURVE_DECEL      = 5;
 
 struct PrepFlag {
     uint8_t recalculate : 1;
@@ -64,8 +66,9 @@ const int ticksPerMicrosecond = fStepperTimer / 1000000;
 const uint32_t amassThreshold = fStepperTimer / 8000;
 const int maxAmassLevel = 3;  // Each level increase doubles the threshold
 
-const timer_group_t STEP_TIMER_GROUP = TIMER_GROUP_0;
-const timer_idx_t   STEP_TIMER_INDEX = TIMER_0;
+const timer_group_t STEP_TIMER_GROUP  = TIMER_GROUP_0;
+const timer_idx_t   STEP_TIMER_INDEX  = TIMER_0;
+const timer_idx_t   PULSE_TIMER_INDEX = TIMER_1;  // Ends the step pulses in ST_TIMED and ST_I2S_STATIC modes
 
 // esp32 work around for diable in main loop
 extern uint64_t stepper_idle_counter;
@@ -93,6 +96,19 @@ enum stepper_id_t {
 extern const char*  stepper_names[];
 extern stepper_id_t current_stepper;
 
+// Time of one step segment in minutes, from $Stepper/SegmentRate. Set by stepper_init().
+extern double segment_time;
+
+// Segment buffer fill levels and underruns since startup. See st_get_buffer_stats().
+typedef struct {
+    uint8_t  size;        // Segments in the buffer, from $Stepper/Segments. One is always left empty.
+    uint16_t rate;        // Segments per second, from $Stepper/SegmentRate
+    uint8_t  high_water;  // Most segments ever queued
+    uint8_t  low_water;   // Fewest segments queued when the ISR took one with more motion to prepare
+    uint32_t underruns;   // Times the ISR found the buffer empty with more motion to prepare
+    uint32_t segments;    // Segments the ISR has loaded
+} st_buffer_stats_t;
+
 // -- Task handles for use in the notifications
 void IRAM_ATTR onSteppertimer();
 void IRAM_ATTR onStepperOffTimer();
@@ -124,6 +140,9 @@ void st_update_plan_block_parameters();
 // Called by realtime status reporting if realtime rate reporting is enabled in config.h.
 float st_get_realtime_rate();
 
+// Returns the segment buffer statistics, for tuning $Stepper/Segments and $Stepper/SegmentRate.
+st_buffer_stats_t st_get_buffer_stats();
+
 // disable (or enable) steppers via STEPPERS_DISABLE_PIN
 bool get_stepper_disable();  // returns the state of the pin
 
@@ -0,0 +1,115 @@
+/*
+  TxQueue.cpp - Queues of output to the clients
+  Part of Grbl_ESP32
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Grbl.h"
+
+static_assert(TX_SLOT_SIZE <= 255, "TX_SLOT_SIZE must fit the length of a slot");
+static_assert(TX_SLOTS <= 255, "TX_QUEUE_DEPTH is too large");
+
+// There is one queue of output, for all the clients.
+static portMUX_TYPE tx_queue_spinlock = portMUX_INITIALIZER_UNLOCKED;
+
+TxQueue::TxQueue() : _n_free(TX_SLOTS) {
+    for (int i = 0; i < TX_SLOTS; i++) {
+        _free[i] = TX_SLOTS - 1 - i;
+    }
+    memset(_queues, 0, sizeof(_queues));
+}
+
+uint8_t TxQueue::put(const char* text, size_t len, uint8_t clients, Kind kind) {
+    size_t  n_slots = (len + TX_SLOT_SIZE - 1) / TX_SLOT_SIZE;
+    uint8_t full    = 0;
+    uint8_t refs    = 0;
+    if (n_slots == 0) {
+        return 0;
+    }
+
+    portENTER_CRITICAL(&tx_queue_spinlock);
+    for (uint8_t client = 0; client < CLIENT_COUNT; client++) {
+        if (bit_istrue(clients, bit(client))) {
+            if (client == CLIENT_INPUT || _queues[client].count + n_slots > TX_QUEUE_DEPTH) {
+                full |= bit(client);
+            } else {
+                refs++;
+            }
+        }
+    }
+    // The queues with room hold fewer than TX_SLOTS - n_slots slots between them, so the slots
+    // are there.
+    if (refs && _n_free >= n_slots) {
+        for (size_t i = 0; i < n_slots; i++) {
+            uint8_t index = _free[--_n_free];
+            Slot&   slot  = _slots[index];
+            slot.refs     = refs;
+            slot.len      = MIN(len, TX_SLOT_SIZE);
+            slot.kind     = kind;
+            slot.last     = i == n_slots - 1;
+            memcpy(slot.text, text, slot.len);
+            text += slot.len;
+            len  -= slot.len;
+            for (uint8_t client = 0; client < CLIENT_COUNT; client++) {
+                if (bit_istrue(clients, bit(client)) && bit_isfalse(full, bit(client))) {
+                    Queue&  queue    = _queues[client];
+                    uint8_t tail     = (queue.head + queue.count) % TX_QUEUE_DEPTH;
+                    queue.slot[tail] = index;
+                    queue.count++;
+                    if (kind == Status && slot.last) {
+                        queue.statuses++;
+                    }
+                }
+            }
+        }
+    } else {
+        full = clients;
+    }
+    portEXIT_CRITICAL(&tx_queue_spinlock);
+    return full;
+}
+
+// Takes the slot at the head of the queue, and frees it if no other client still has it queued.
+void TxQueue::pop(Queue& queue) {
+    uint8_t index = queue.slot[queue.head];
+    Slot&   slot  = _slots[index];
+    queue.head    = (queue.head + 1) % TX_QUEUE_DEPTH;
+    queue.count--;
+    queue.partial = !slot.last;
+    if (slot.kind == Status && slot.last) {
+        queue.statuses--;
+    }
+    if (--slot.refs == 0) {
+        _free[_n_free++] = index;
+    }
+}
+
+size_t TxQueue::get(uint8_t client, char* buf) {
+    Queue& queue = _queues[client];
+    size_t len   = 0;
+    portENTER_CRITICAL(&tx_queue_spinlock);
+    // Skip the status reports that a newer one follows
+    while (queue.count && !queue.partial && _slots[queue.slot[queue.head]].kind == Status && queue.statuses > 1) {
+        do {
+            pop(queue);
+        } while (queue.partial);
+    }
+    if (queue.count) {
+        Slot& slot = _slots[queue.slot[queue.head]];
+        len        = slot.len;
+        memcpy(buf, slot.text, len);
+        pop(queue);
+    }
+    portEXIT_CRITICAL(&tx_queue_spinlock);
+    return len;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+/*
+  TxQueue.h - Header for the queues of output to the clients
+  Part of Grbl_ESP32
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TX_SLOT_SIZE
+#    define TX_SLOT_SIZE 128  // Bytes of text in a slot. Longer messages take several.
+#endif
+#ifndef TX_QUEUE_DEPTH
+#    define TX_QUEUE_DEPTH 16  // Slots each client can have waiting
+#endif
+
+// Every slot in use is queued for at least one client, and CLIENT_INPUT gets no output, so the
+// clients can fill their queues without running out of slots.
+const int TX_SLOTS = TX_QUEUE_DEPTH * (CLIENT_COUNT - 1);
+
+// The output waiting for each client. Any task or interrupt can put() a message, which is copied
+// once into shared slots and queued for every client it goes to; clientTxTask() is the only
+// consumer, and takes the output of each client with get() as the client can send it. A slot is
+// freed when the last client it was queued for has taken it. Both sides hold a spinlock only to
+// copy text and move indices, never while a client sends.
+//
+// A client that is slow only fills its own queue. What happens then is up to the producer: put()
+// returns the clients a message could not be queued for. A status report is never queued behind a
+// newer one: the older is skipped, as it is out of date.
+class TxQueue {
+public:
+    enum Kind : uint8_t {
+        Message,
+        Status,  // A status report. May be dropped or skipped.
+    };
+
+private:
+    struct Slot {
+        uint8_t refs;  // Clients it is queued for
+        uint8_t len;
+        Kind    kind;
+        bool    last;  // The last slot of its message
+        char    text[TX_SLOT_SIZE];
+    };
+
+    struct Queue {
+        uint8_t slot[TX_QUEUE_DEPTH];
+        uint8_t head;
+        uint8_t count;
+        uint8_t statuses;  // Status reports queued
+        bool    partial;   // Part of the message at the head has been taken
+    };
+
+    Slot    _slots[TX_SLOTS];
+    uint8_t _free[TX_SLOTS];
+    uint8_t _n_free;
+    Queue   _queues[CLIENT_COUNT];
+
+    void pop(Queue& queue);
+
+public:
+    TxQueue();
+
+    // Producer. Queues the text, as one message, for each client in the mask that has room for it.
+    // Returns the mask of those that had not.
+    uint8_t put(const char* text, size_t len, uint8_t clients, Kind kind);
+
+    // Consumer. Copies the next slot of output for the client to buf, which holds TX_SLOT_SIZE
+    // bytes. Returns the length, or 0 if nothing is waiting.
+    size_t get(uint8_t client, char* buf);
+};
@@ -11,7 +11,13 @@
 #include "soc/dport_reg.h"
 #include "soc/rtc.h"
 
-Uart::Uart(int uart_num) : _uart_num(uart_port_t(uart_num)), _pushback(-1) {}
+Uart::Uart(int uart_num) : _uart_num(uart_port_t(uart_num)), _pushback(-1), _rx_buffer_size(256), _tx_buffer_size(0) {}
+
+// The driver needs more than the hardware FIFO for receiving, and either that or nothing for sending.
+void Uart::setBufferSizes(size_t rx_size, size_t tx_size) {
+    _rx_buffer_size = rx_size > UART_FIFO_LEN ? rx_size : UART_FIFO_LEN + 1;
+    _tx_buffer_size = tx_size > UART_FIFO_LEN ? tx_size : 0;
+}
 
 void Uart::begin(unsigned long baudrate, Data dataBits, Stop stopBits, Parity parity) {
     //    uart_driver_delete(_uart_num);
@@ -26,7 +32,11 @@ void Uart::begin(unsigned long baudrate, Data dataBits, Stop stopBits, Parity pa
     if (uart_param_config(_uart_num, &conf) != ESP_OK) {
         return;
     };
-    uart_driver_install(_uart_num, 256, 0, 0, NULL, 0);
+    uart_driver_install(_uart_num, _rx_buffer_size, _tx_buffer_size, 0, NULL, 0);
+}
+
+bool Uart::setHwFlowCtrl(int rx_threshold) {
+    return uart_set_hw_flow_ctrl(_uart_num, UART_HW_FLOWCTRL_CTS_RTS, rx_threshold) != ESP_OK;
 }
 
 int Uart::available() {
@@ -6,6 +6,8 @@ class Uart : public Stream {
 private:
     uart_port_t _uart_num;
     int         _pushback;
+    size_t      _rx_buffer_size;
+    size_t      _tx_buffer_size;
 
 public:
     enum class Data : int {
@@ -30,7 +32,9 @@ public:
     Uart(int uart_num);
     bool          setHalfDuplex();
     bool          setPins(int tx_pin, int rx_pin, int rts_pin = -1, int cts_pin = -1);
+    void          setBufferSizes(size_t rx_size, size_t tx_size);  // Before begin()
     void          begin(unsigned long baud, Data dataBits, Stop stopBits, Parity parity);
+    bool          setHwFlowCtrl(int rx_threshold);  // After begin(), with the RTS and CTS pins set
     int           available(void) override;
     int           read(void) override;
     int           read(TickType_t timeout);
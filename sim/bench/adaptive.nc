@@ -0,0 +1,5 @@
+; Adaptive kinematic segments, for machines with custom kinematics: segments
+; up to 20 mm long, halved until the motors, moving straight, stay within
+; 0.01 mm of the programmed line.
+$Kinematics/SegmentLength=20
+$Kinematics/SegmentTolerance=0.01
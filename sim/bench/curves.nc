@@ -0,0 +1,88 @@
+; Tangent half circles of radius 5 mm, turning alternately clockwise and
+; counterclockwise, then the same wave as G5 cubic splines, at 6000 mm/min.
+; The curves meet without corners, so the bends limit the feed here.
+G21 G90 G94
+G0 X0 Y0
+G1 F6000
+G2 X10 Y0 I5 J0
+G3 X20 Y0 I5 J0
+G2 X30 Y0 I5 J0
+G3 X40 Y0 I5 J0
+G2 X50 Y0 I5 J0
+G3 X60 Y0 I5 J0
+G2 X70 Y0 I5 J0
+G3 X80 Y0 I5 J0
+G2 X90 Y0 I5 J0
+G3 X100 Y0 I5 J0
+G2 X110 Y0 I5 J0
+G3 X120 Y0 I5 J0
+G2 X130 Y0 I5 J0
+G3 X140 Y0 I5 J0
+G2 X150 Y0 I5 J0
+G3 X160 Y0 I5 J0
+G2 X170 Y0 I5 J0
+G3 X180 Y0 I5 J0
+G2 X190 Y0 I5 J0
+G3 X200 Y0 I5 J0
+G2 X210 Y0 I5 J0
+G3 X220 Y0 I5 J0
+G2 X230 Y0 I5 J0
+G3 X240 Y0 I5 J0
+G2 X250 Y0 I5 J0
+G3 X260 Y0 I5 J0
+G2 X270 Y0 I5 J0
+G3 X280 Y0 I5 J0
+G2 X290 Y0 I5 J0
+G3 X300 Y0 I5 J0
+G2 X310 Y0 I5 J0
+G3 X320 Y0 I5 J0
+G2 X330 Y0 I5 J0
+G3 X340 Y0 I5 J0
+G2 X350 Y0 I5 J0
+G3 X360 Y0 I5 J0
+G2 X370 Y0 I5 J0
+G3 X380 Y0 I5 J0
+G2 X390 Y0 I5 J0
+G3 X400 Y0 I5 J0
+G0 X0 Y20
+G5 X10 Y20 I0 J6.6667 P0 Q6.6667
+G5 X20 Y20 P0 Q-6.6667
+G5 X30 Y20 P0 Q6.6667
+G5 X40 Y20 P0 Q-6.6667
+G5 X50 Y20 P0 Q6.6667
+G5 X60 Y20 P0 Q-6.6667
+G5 X70 Y20 P0 Q6.6667
+G5 X80 Y20 P0 Q-6.6667
+G5 X90 Y20 P0 Q6.6667
+G5 X100 Y20 P0 Q-6.6667
+G5 X110 Y20 P0 Q6.6667
+G5 X120 Y20 P0 Q-6.6667
+G5 X130 Y20 P0 Q6.6667
+G5 X140 Y20 P0 Q-6.6667
+G5 X150 Y20 P0 Q6.6667
+G5 X160 Y20 P0 Q-6.6667
+G5 X170 Y20 P0 Q6.6667
+G5 X180 Y20 P0 Q-6.6667
+G5 X190 Y20 P0 Q6.6667
+G5 X200 Y20 P0 Q-6.6667
+G5 X210 Y20 P0 Q6.6667
+G5 X220 Y20 P0 Q-6.6667
+G5 X230 Y20 P0 Q6.6667
+G5 X240 Y20 P0 Q-6.6667
+G5 X250 Y20 P0 Q6.6667
+G5 X260 Y20 P0 Q-6.6667
+G5 X270 Y20 P0 Q6.6667
+G5 X280 Y20 P0 Q-6.6667
+G5 X290 Y20 P0 Q6.6667
+G5 X300 Y20 P0 Q-6.6667
+G5 X310 Y20 P0 Q6.6667
+G5 X320 Y20 P0 Q-6.6667
+G5 X330 Y20 P0 Q6.6667
+G5 X340 Y20 P0 Q-6.6667
+G5 X350 Y20 P0 Q6.6667
+G5 X360 Y20 P0 Q-6.6667
+G5 X370 Y20 P0 Q6.6667
+G5 X380 Y20 P0 Q-6.6667
+G5 X390 Y20 P0 Q6.6667
+G5 X400 Y20 P0 Q-6.6667
+G0 X0 Y0
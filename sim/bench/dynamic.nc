@@ -0,0 +1,4 @@
+; Dynamic laser power from startup: M4 scales the power with the speed, so
+; that corners, where the machine slows down, are not burned darker. Startup
+; lines run at every reset, so the mode holds for the files that follow.
+$N0=M4S1000
@@ -0,0 +1,8 @@
+; A machine fast enough that acceleration, not the rate limit, shapes the
+; motion: 20000 mm/min rapids (33 kHz steps) and 1000 mm/sec^2.
+$110=20000
+$111=20000
+$112=20000
+$120=1000
+$121=1000
+$122=1000
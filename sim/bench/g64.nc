@@ -0,0 +1,4 @@
+; Continuous mode from startup: corners are rounded by arcs that stay within
+; 0.05 mm of them. Startup lines run at every reset, so the mode holds for the
+; files that follow.
+$N0=G64P0.05
@@ -0,0 +1,5 @@
+; S-curve ramps for the fast machine. With a jerk of 20000 mm/sec^3, the
+; acceleration takes 50 ms to build up to its limit and 50 ms to fall back.
+$X/Jerk=20000
+$Y/Jerk=20000
+$Z/Jerk=20000
@@ -0,0 +1,2 @@
+; Laser mode: S words change power along the path without stopping.
+$32=1
@@ -0,0 +1,3 @@
+; Merge consecutive lines whose vertices stay within 0.001 mm of the merged
+; line, as a CAM post with a tighter tolerance than the machine needs would.
+$Planner/MergeTolerance=0.001
@@ -0,0 +1,3147 @@
+; A circle of radius 50 mm in 0.1 mm chords at 6000 mm/min, like CAM output
+; of a spline. Look-ahead depth, not the junctions, limits the feed here.
+G21 G90 G94
+G0 X50 Y0
+G1 F6000
+X49.9999 Y0.1000
+X49.9996 Y0.2000
+X49.9991 Y0.3000
+X49.9984 Y0.3999
+X49.9975 Y0.4999
+X49.9964 Y0.5999
+X49.9951 Y0.6999
+X49.9936 Y0.7999
+X49.9919 Y0.8998
+X49.9900 Y0.9998
+X49.9879 Y1.0998
+X49.9856 Y1.1997
+X49.9831 Y1.2997
+X49.9804 Y1.3996
+X49.9775 Y1.4996
+X49.9744 Y1.5995
+X49.9711 Y1.6995
+X49.9676 Y1.7994
+X49.9639 Y1.8993
+X49.9600 Y1.9992
+X49.9559 Y2.0991
+X49.9516 Y2.1990
+X49.9471 Y2.2989
+X49.9424 Y2.3988
+X49.9375 Y2.4986
+X49.9324 Y2.5985
+X49.9271 Y2.6983
+X49.9216 Y2.7982
+X49.9159 Y2.8980
+X49.9101 Y2.9978
+X49.9040 Y3.0976
+X49.8977 Y3.1974
+X49.8912 Y3.2972
+X49.8845 Y3.3969
+X49.8776 Y3.4967
+X49.8705 Y3.5964
+X49.8632 Y3.6961
+X49.8557 Y3.7959
+X49.8480 Y3.8955
+X49.8401 Y3.9952
+X49.8320 Y4.0949
+X49.8237 Y4.1945
+X49.8153 Y4.2941
+X49.8066 Y4.3938
+X49.7977 Y4.4933
+X49.7886 Y4.5929
+X49.7793 Y4.6925
+X49.7698 Y4.7920
+X49.7602 Y4.8915
+X49.7503 Y4.9910
+X49.7402 Y5.0905
+X49.7299 Y5.1900
+X49.7194 Y5.2894
+X49.7088 Y5.3888
+X49.6979 Y5.4882
+X49.6868 Y5.5876
+X49.6755 Y5.6869
+X49.6641 Y5.7863
+X49.6524 Y5.8856
+X49.6405 Y5.9848
+X49.6285 Y6.0841
+X49.6162 Y6.1833
+X49.6037 Y6.2825
+X49.5911 Y6.3817
+X49.5782 Y6.4809
+X49.5651 Y6.5800
+X49.5519 Y6.6791
+X49.5384 Y6.7782
+X49.5248 Y6.8772
+X49.5109 Y6.9763
+X49.4969 Y7.0753
+X49.4826 Y7.1742
+X49.4682 Y7.2732
+X49.4535 Y7.3721
+X49.4387 Y7.4709
+X49.4237 Y7.5698
+X49.4084 Y7.6686
+X49.3930 Y7.7674
+X49.3774 Y7.8662
+X49.3615 Y7.9649
+X49.3455 Y8.0636
+X49.3293 Y8.1622
+X49.3129 Y8.2609
+X49.2962 Y8.3595
+X49.2794 Y8.4580
+X49.2624 Y8.5566
+X49.2452 Y8.6551
+X49.2278 Y8.7535
+X49.2102 Y8.8519
+X49.1924 Y8.9503
+X49.1744 Y9.0487
+X49.1562 Y9.1470
+X49.1378 Y9.2453
+X49.1192 Y9.3435
+X49.1004 Y9.4417
+X49.0815 Y9.5399
+X49.0623 Y9.6380
+X49.0429 Y9.7361
+X49.0234 Y9.8342
+X49.0036 Y9.9322
+X48.9836 Y10.0302
+X48.9635 Y10.1281
+X48.9431 Y10.2260
+X48.9226 Y10.3239
+X48.9018 Y10.4217
+X48.8809 Y10.5194
+X48.8598 Y10.6172
+X48.8384 Y10.7148
+X48.8169 Y10.8125
+X48.7952 Y10.9101
+X48.7733 Y11.0076
+X48.7512 Y11.1052
+X48.7289 Y11.2026
+X48.7064 Y11.3000
+X48.6837 Y11.3974
+X48.6608 Y11.4948
+X48.6377 Y11.5920
+X48.6144 Y11.6893
+X48.5909 Y11.7865
+X48.5673 Y11.8836
+X48.5434 Y11.9807
+X48.5194 Y12.0778
+X48.4951 Y12.1748
+X48.4707 Y12.2717
+X48.4460 Y12.3686
+X48.4212 Y12.4655
+X48.3962 Y12.5623
+X48.3709 Y12.6590
+X48.3455 Y12.7557
+X48.3199 Y12.8524
+X48.2941 Y12.9490
+X48.2681 Y13.0456
+X48.2420 Y13.1420
+X48.2156 Y13.2385
+X48.1890 Y13.3349
+X48.1622 Y13.4312
+X48.1353 Y13.5275
+X48.1081 Y13.6237
+X48.0808 Y13.7199
+X48.0533 Y13.8160
+X48.0255 Y13.9121
+X47.9976 Y14.0081
+X47.9695 Y14.1041
+X47.9412 Y14.2000
+X47.9127 Y14.2958
+X47.8840 Y14.3916
+X47.8552 Y14.4873
+X47.8261 Y14.5830
+X47.7968 Y14.6786
+X47.7674 Y14.7742
+X47.7378 Y14.8696
+X47.7079 Y14.9651
+X47.6779 Y15.0605
+X47.6477 Y15.1558
+X47.6173 Y15.2510
+X47.5867 Y15.3462
+X47.5559 Y15.4413
+X47.5249 Y15.5364
+X47.4938 Y15.6314
+X47.4624 Y15.7264
+X47.4309 Y15.8212
+X47.3991 Y15.9161
+X47.3672 Y16.0108
+X47.3351 Y16.1055
+X47.3028 Y16.2001
+X47.2703 Y16.2947
+X47.2376 Y16.3892
+X47.2048 Y16.4836
+X47.1717 Y16.5780
+X47.1385 Y16.6723
+X47.1050 Y16.7665
+X47.0714 Y16.8607
+X47.0376 Y16.9548
+X47.0036 Y17.0488
+X46.9694 Y17.1428
+X46.9350 Y17.2367
+X46.9005 Y17.3305
+X46.8657 Y17.4242
+X46.8308 Y17.5179
+X46.7957 Y17.6115
+X46.7604 Y17.7051
+X46.7249 Y17.7985
+X46.6892 Y17.8919
+X46.6533 Y17.9853
+X46.6172 Y18.0785
+X46.5810 Y18.1717
+X46.5446 Y18.2648
+X46.5079 Y18.3579
+X46.4711 Y18.4508
+X46.4341 Y18.5437
+X46.3970 Y18.6366
+X46.3596 Y18.7293
+X46.3221 Y18.8220
+X46.2843 Y18.9146
+X46.2464 Y19.0071
+X46.2083 Y19.0995
+X46.1700 Y19.1919
+X46.1316 Y19.2842
+X46.0929 Y19.3764
+X46.0541 Y19.4685
+X46.0150 Y19.5606
+X45.9758 Y19.6526
+X45.9364 Y19.7445
+X45.8969 Y19.8363
+X45.8571 Y19.9280
+X45.8172 Y20.0197
+X45.7770 Y20.1113
+X45.7367 Y20.2028
+X45.6962 Y20.2942
+X45.6556 Y20.3855
+X45.6147 Y20.4768
+X45.5737 Y20.5680
+X45.5324 Y20.6591
+X45.4910 Y20.7501
+X45.4494 Y20.8410
+X45.4077 Y20.9319
+X45.3657 Y21.0226
+X45.3236 Y21.1133
+X45.2813 Y21.2039
+X45.2388 Y21.2944
+X45.1961 Y21.3848
+X45.1533 Y21.4752
+X45.1102 Y21.5654
+X45.0670 Y21.6556
+X45.0236 Y21.7457
+X44.9800 Y21.8356
+X44.9363 Y21.9255
+X44.8924 Y22.0154
+X44.8482 Y22.1051
+X44.8039 Y22.1947
+X44.7595 Y22.2843
+X44.7148 Y22.3737
+X44.6700 Y22.4631
+X44.6250 Y22.5524
+X44.5798 Y22.6416
+X44.5344 Y22.7307
+X44.4889 Y22.8197
+X44.4432 Y22.9086
+X44.3973 Y22.9975
+X44.3512 Y23.0862
+X44.3049 Y23.1748
+X44.2585 Y23.2634
+X44.2119 Y23.3519
+X44.1651 Y23.4402
+X44.1181 Y23.5285
+X44.0710 Y23.6167
+X44.0237 Y23.7048
+X43.9762 Y23.7927
+X43.9285 Y23.8806
+X43.8807 Y23.9684
+X43.8327 Y24.0561
+X43.7845 Y24.1437
+X43.7361 Y24.2312
+X43.6876 Y24.3187
+X43.6388 Y24.4060
+X43.5899 Y24.4932
+X43.5409 Y24.5803
+X43.4916 Y24.6673
+X43.4422 Y24.7543
+X43.3926 Y24.8411
+X43.3429 Y24.9278
+X43.2929 Y25.0144
+X43.2428 Y25.1010
+X43.1925 Y25.1874
+X43.1421 Y25.2737
+X43.0915 Y25.3599
+X43.0407 Y25.4460
+X42.9897 Y25.5321
+X42.9385 Y25.6180
+X42.8872 Y25.7038
+X42.8357 Y25.7895
+X42.7841 Y25.8751
+X42.7323 Y25.9606
+X42.6803 Y26.0460
+X42.6281 Y26.1313
+X42.5757 Y26.2165
+X42.5232 Y26.3016
+X42.4706 Y26.3866
+X42.4177 Y26.4715
+X42.3647 Y26.5562
+X42.3115 Y26.6409
+X42.2581 Y26.7255
+X42.2046 Y26.8099
+X42.1509 Y26.8943
+X42.0970 Y26.9785
+X42.0430 Y27.0626
+X41.9888 Y27.1466
+X41.9344 Y27.2306
+X41.8799 Y27.3144
+X41.8252 Y27.3981
+X41.7703 Y27.4816
+X41.7153 Y27.5651
+X41.6601 Y27.6485
+X41.6047 Y27.7317
+X41.5492 Y27.8149
+X41.4935 Y27.8979
+X41.4376 Y27.9808
+X41.3815 Y28.0636
+X41.3253 Y28.1463
+X41.2690 Y28.2289
+X41.2124 Y28.3114
+X41.1557 Y28.3937
+X41.0989 Y28.4760
+X41.0419 Y28.5581
+X40.9847 Y28.6401
+X40.9273 Y28.7220
+X40.8698 Y28.8038
+X40.8121 Y28.8855
+X40.7543 Y28.9670
+X40.6963 Y29.0485
+X40.6381 Y29.1298
+X40.5798 Y29.2110
+X40.5213 Y29.2921
+X40.4626 Y29.3731
+X40.4038 Y29.4539
+X40.3448 Y29.5347
+X40.2857 Y29.6153
+X40.2264 Y29.6958
+X40.1669 Y29.7762
+X40.1073 Y29.8564
+X40.0475 Y29.9366
+X39.9875 Y30.0166
+X39.9274 Y30.0965
+X39.8672 Y30.1763
+X39.8067 Y30.2560
+X39.7462 Y30.3355
+X39.6854 Y30.4149
+X39.6245 Y30.4942
+X39.5635 Y30.5734
+X39.5022 Y30.6525
+X39.4409 Y30.7314
+X39.3793 Y30.8102
+X39.3176 Y30.8889
+X39.2558 Y30.9675
+X39.1938 Y31.0459
+X39.1316 Y31.1242
+X39.0693 Y31.2024
+X39.0068 Y31.2805
+X38.9442 Y31.3584
+X38.8814 Y31.4362
+X38.8185 Y31.5139
+X38.7554 Y31.5915
+X38.6921 Y31.6689
+X38.6287 Y31.7462
+X38.5651 Y31.8234
+X38.5014 Y31.9005
+X38.4376 Y31.9774
+X38.3735 Y32.0542
+X38.3094 Y32.1309
+X38.2450 Y32.2074
+X38.1805 Y32.2838
+X38.1159 Y32.3601
+X38.0511 Y32.4363
+X37.9862 Y32.5123
+X37.9211 Y32.5882
+X37.8558 Y32.6640
+X37.7905 Y32.7396
+X37.7249 Y32.8151
+X37.6592 Y32.8905
+X37.5934 Y32.9657
+X37.5274 Y33.0408
+X37.4612 Y33.1158
+X37.3949 Y33.1907
+X37.3285 Y33.2654
+X37.2619 Y33.3400
+X37.1951 Y33.4144
+X37.1282 Y33.4887
+X37.0612 Y33.5629
+X36.9940 Y33.6369
+X36.9267 Y33.7109
+X36.8592 Y33.7846
+X36.7915 Y33.8583
+X36.7238 Y33.9318
+X36.6558 Y34.0051
+X36.5878 Y34.0784
+X36.5195 Y34.1515
+X36.4512 Y34.2244
+X36.3827 Y34.2973
+X36.3140 Y34.3700
+X36.2452 Y34.4425
+X36.1762 Y34.5149
+X36.1072 Y34.5872
+X36.0379 Y34.6593
+X35.9685 Y34.7313
+X35.8990 Y34.8032
+X35.8293 Y34.8749
+X35.7595 Y34.9465
+X35.6896 Y35.0179
+X35.6195 Y35.0892
+X35.5492 Y35.1604
+X35.4788 Y35.2314
+X35.4083 Y35.3023
+X35.3377 Y35.3730
+X35.2669 Y35.4436
+X35.1959 Y35.5141
+X35.1248 Y35.5844
+X35.0536 Y35.6545
+X34.9822 Y35.7246
+X34.9107 Y35.7945
+X34.8391 Y35.8642
+X34.7673 Y35.9338
+X34.6953 Y36.0032
+X34.6233 Y36.0726
+X34.5511 Y36.1417
+X34.4787 Y36.2107
+X34.4062 Y36.2796
+X34.3336 Y36.3483
+X34.2609 Y36.4169
+X34.1880 Y36.4854
+X34.1149 Y36.5537
+X34.0418 Y36.6218
+X33.9685 Y36.6898
+X33.8950 Y36.7577
+X33.8215 Y36.8254
+X33.7478 Y36.8929
+X33.6739 Y36.9604
+X33.5999 Y37.0276
+X33.5258 Y37.0947
+X33.4516 Y37.1617
+X33.3772 Y37.2285
+X33.3027 Y37.2952
+X33.2280 Y37.3617
+X33.1533 Y37.4281
+X33.0783 Y37.4943
+X33.0033 Y37.5604
+X32.9281 Y37.6263
+X32.8528 Y37.6921
+X32.7774 Y37.7577
+X32.7018 Y37.8232
+X32.6261 Y37.8885
+X32.5503 Y37.9537
+X32.4743 Y38.0187
+X32.3982 Y38.0835
+X32.3220 Y38.1483
+X32.2456 Y38.2128
+X32.1692 Y38.2772
+X32.0925 Y38.3415
+X32.0158 Y38.4056
+X31.9389 Y38.4695
+X31.8620 Y38.5333
+X31.7848 Y38.5969
+X31.7076 Y38.6604
+X31.6302 Y38.7238
+X31.5527 Y38.7869
+X31.4751 Y38.8500
+X31.3973 Y38.9128
+X31.3195 Y38.9755
+X31.2414 Y39.0381
+X31.1633 Y39.1005
+X31.0851 Y39.1627
+X31.0067 Y39.2248
+X30.9282 Y39.2867
+X30.8496 Y39.3485
+X30.7708 Y39.4101
+X30.6919 Y39.4716
+X30.6130 Y39.5329
+X30.5338 Y39.5940
+X30.4546 Y39.6550
+X30.3752 Y39.7158
+X30.2958 Y39.7765
+X30.2161 Y39.8370
+X30.1364 Y39.8973
+X30.0566 Y39.9575
+X29.9766 Y40.0175
+X29.8965 Y40.0774
+X29.8163 Y40.1371
+X29.7360 Y40.1966
+X29.6556 Y40.2560
+X29.5750 Y40.3152
+X29.4943 Y40.3743
+X29.4135 Y40.4332
+X29.3326 Y40.4919
+X29.2516 Y40.5505
+X29.1704 Y40.6089
+X29.0892 Y40.6672
+X29.0078 Y40.7253
+X28.9263 Y40.7832
+X28.8447 Y40.8410
+X28.7629 Y40.8986
+X28.6811 Y40.9560
+X28.5991 Y41.0133
+X28.5171 Y41.0704
+X28.4349 Y41.1273
+X28.3526 Y41.1841
+X28.2702 Y41.2407
+X28.1876 Y41.2972
+X28.1050 Y41.3535
+X28.0222 Y41.4096
+X27.9394 Y41.4655
+X27.8564 Y41.5213
+X27.7733 Y41.5770
+X27.6901 Y41.6324
+X27.6068 Y41.6877
+X27.5234 Y41.7428
+X27.4399 Y41.7978
+X27.3562 Y41.8526
+X27.2725 Y41.9072
+X27.1886 Y41.9616
+X27.1046 Y42.0159
+X27.0206 Y42.0700
+X26.9364 Y42.1240
+X26.8521 Y42.1778
+X26.7677 Y42.2314
+X26.6832 Y42.2848
+X26.5986 Y42.3381
+X26.5139 Y42.3912
+X26.4290 Y42.4442
+X26.3441 Y42.4969
+X26.2591 Y42.5495
+X26.1739 Y42.6019
+X26.0887 Y42.6542
+X26.0033 Y42.7063
+X25.9179 Y42.7582
+X25.8323 Y42.8099
+X25.7467 Y42.8615
+X25.6609 Y42.9129
+X25.5750 Y42.9641
+X25.4891 Y43.0152
+X25.4030 Y43.0661
+X25.3168 Y43.1168
+X25.2306 Y43.1673
+X25.1442 Y43.2177
+X25.0577 Y43.2679
+X24.9711 Y43.3179
+X24.8845 Y43.3678
+X24.7977 Y43.4174
+X24.7108 Y43.4670
+X24.6238 Y43.5163
+X24.5368 Y43.5654
+X24.4496 Y43.6144
+X24.3623 Y43.6632
+X24.2750 Y43.7119
+X24.1875 Y43.7603
+X24.0999 Y43.8086
+X24.0123 Y43.8567
+X23.9245 Y43.9046
+X23.8367 Y43.9524
+X23.7488 Y44.0000
+X23.6607 Y44.0474
+X23.5726 Y44.0946
+X23.4844 Y44.1416
+X23.3960 Y44.1885
+X23.3076 Y44.2352
+X23.2191 Y44.2817
+X23.1305 Y44.3281
+X23.0418 Y44.3742
+X22.9531 Y44.4202
+X22.8642 Y44.4660
+X22.7752 Y44.5117
+X22.6862 Y44.5571
+X22.5970 Y44.6024
+X22.5078 Y44.6475
+X22.4184 Y44.6924
+X22.3290 Y44.7372
+X22.2395 Y44.7817
+X22.1499 Y44.8261
+X22.0602 Y44.8703
+X21.9705 Y44.9143
+X21.8806 Y44.9582
+X21.7907 Y45.0019
+X21.7006 Y45.0453
+X21.6105 Y45.0886
+X21.5203 Y45.1318
+X21.4300 Y45.1747
+X21.3396 Y45.2175
+X21.2491 Y45.2601
+X21.1586 Y45.3025
+X21.0680 Y45.3447
+X20.9772 Y45.3867
+X20.8864 Y45.4286
+X20.7956 Y45.4703
+X20.7046 Y45.5118
+X20.6135 Y45.5531
+X20.5224 Y45.5942
+X20.4312 Y45.6352
+X20.3399 Y45.6759
+X20.2485 Y45.7165
+X20.1570 Y45.7569
+X20.0655 Y45.7971
+X19.9739 Y45.8372
+X19.8822 Y45.8770
+X19.7904 Y45.9167
+X19.6985 Y45.9562
+X19.6066 Y45.9955
+X19.5146 Y46.0346
+X19.4225 Y46.0735
+X19.3303 Y46.1123
+X19.2380 Y46.1508
+X19.1457 Y46.1892
+X19.0533 Y46.2274
+X18.9608 Y46.2654
+X18.8683 Y46.3032
+X18.7756 Y46.3409
+X18.6829 Y46.3783
+X18.5902 Y46.4156
+X18.4973 Y46.4527
+X18.4044 Y46.4896
+X18.3114 Y46.5263
+X18.2183 Y46.5628
+X18.1251 Y46.5991
+X18.0319 Y46.6353
+X17.9386 Y46.6713
+X17.8453 Y46.7070
+X17.7518 Y46.7426
+X17.6583 Y46.7780
+X17.5647 Y46.8132
+X17.4711 Y46.8483
+X17.3774 Y46.8831
+X17.2836 Y46.9178
+X17.1897 Y46.9522
+X17.0958 Y46.9865
+X17.0018 Y47.0206
+X16.9077 Y47.0545
+X16.8136 Y47.0882
+X16.7194 Y47.1218
+X16.6251 Y47.1551
+X16.5308 Y47.1883
+X16.4364 Y47.2212
+X16.3419 Y47.2540
+X16.2474 Y47.2866
+X16.1528 Y47.3190
+X16.0582 Y47.3512
+X15.9634 Y47.3832
+X15.8687 Y47.4150
+X15.7738 Y47.4467
+X15.6789 Y47.4781
+X15.5839 Y47.5094
+X15.4889 Y47.5405
+X15.3938 Y47.5713
+X15.2986 Y47.6020
+X15.2034 Y47.6325
+X15.1081 Y47.6628
+X15.0128 Y47.6929
+X14.9174 Y47.7229
+X14.8219 Y47.7526
+X14.7264 Y47.7821
+X14.6308 Y47.8115
+X14.5352 Y47.8407
+X14.4395 Y47.8696
+X14.3437 Y47.8984
+X14.2479 Y47.9270
+X14.1520 Y47.9554
+X14.0561 Y47.9836
+X13.9601 Y48.0116
+X13.8641 Y48.0394
+X13.7680 Y48.0671
+X13.6718 Y48.0945
+X13.5756 Y48.1217
+X13.4794 Y48.1488
+X13.3831 Y48.1757
+X13.2867 Y48.2023
+X13.1903 Y48.2288
+X13.0938 Y48.2551
+X12.9973 Y48.2812
+X12.9007 Y48.3071
+X12.8041 Y48.3328
+X12.7074 Y48.3583
+X12.6107 Y48.3836
+X12.5139 Y48.4087
+X12.4171 Y48.4336
+X12.3202 Y48.4584
+X12.2233 Y48.4829
+X12.1263 Y48.5073
+X12.0292 Y48.5314
+X11.9322 Y48.5554
+X11.8351 Y48.5791
+X11.7379 Y48.6027
+X11.6407 Y48.6261
+X11.5434 Y48.6493
+X11.4461 Y48.6722
+X11.3487 Y48.6950
+X11.2513 Y48.7176
+X11.1539 Y48.7400
+X11.0564 Y48.7622
+X10.9589 Y48.7843
+X10.8613 Y48.8061
+X10.7637 Y48.8277
+X10.6660 Y48.8491
+X10.5683 Y48.8703
+X10.4706 Y48.8914
+X10.3728 Y48.9122
+X10.2749 Y48.9329
+X10.1771 Y48.9533
+X10.0791 Y48.9736
+X9.9812 Y48.9936
+X9.8832 Y49.0135
+X9.7852 Y49.0332
+X9.6871 Y49.0526
+X9.5890 Y49.0719
+X9.4908 Y49.0910
+X9.3926 Y49.1099
+X9.2944 Y49.1285
+X9.1961 Y49.1470
+X9.0978 Y49.1653
+X8.9995 Y49.1834
+X8.9011 Y49.2013
+X8.8027 Y49.2190
+X8.7043 Y49.2365
+X8.6058 Y49.2538
+X8.5073 Y49.2709
+X8.4088 Y49.2879
+X8.3102 Y49.3046
+X8.2116 Y49.3211
+X8.1129 Y49.3374
+X8.0142 Y49.3535
+X7.9155 Y49.3695
+X7.8168 Y49.3852
+X7.7180 Y49.4007
+X7.6192 Y49.4161
+X7.5204 Y49.4312
+X7.4215 Y49.4461
+X7.3226 Y49.4609
+X7.2237 Y49.4754
+X7.1247 Y49.4898
+X7.0258 Y49.5039
+X6.9267 Y49.5179
+X6.8277 Y49.5316
+X6.7286 Y49.5452
+X6.6296 Y49.5585
+X6.5304 Y49.5717
+X6.4313 Y49.5847
+X6.3321 Y49.5974
+X6.2329 Y49.6100
+X6.1337 Y49.6223
+X6.0345 Y49.6345
+X5.9352 Y49.6465
+X5.8359 Y49.6583
+X5.7366 Y49.6698
+X5.6373 Y49.6812
+X5.5379 Y49.6924
+X5.4385 Y49.7033
+X5.3391 Y49.7141
+X5.2397 Y49.7247
+X5.1402 Y49.7351
+X5.0408 Y49.7453
+X4.9413 Y49.7552
+X4.8418 Y49.7650
+X4.7422 Y49.7746
+X4.6427 Y49.7840
+X4.5431 Y49.7932
+X4.4436 Y49.8022
+X4.3440 Y49.8109
+X4.2443 Y49.8195
+X4.1447 Y49.8279
+X4.0450 Y49.8361
+X3.9454 Y49.8441
+X3.8457 Y49.8519
+X3.7460 Y49.8595
+X3.6463 Y49.8669
+X3.5466 Y49.8741
+X3.4468 Y49.8811
+X3.3471 Y49.8878
+X3.2473 Y49.8944
+X3.1475 Y49.9008
+X3.0477 Y49.9070
+X2.9479 Y49.9130
+X2.8481 Y49.9188
+X2.7483 Y49.9244
+X2.6484 Y49.9298
+X2.5486 Y49.9350
+X2.4487 Y49.9400
+X2.3488 Y49.9448
+X2.2489 Y49.9494
+X2.1491 Y49.9538
+X2.0492 Y49.9580
+X1.9493 Y49.9620
+X1.8493 Y49.9658
+X1.7494 Y49.9694
+X1.6495 Y49.9728
+X1.5496 Y49.9760
+X1.4496 Y49.9790
+X1.3497 Y49.9818
+X1.2497 Y49.9844
+X1.1497 Y49.9868
+X1.0498 Y49.9890
+X0.9498 Y49.9910
+X0.8498 Y49.9928
+X0.7499 Y49.9944
+X0.6499 Y49.9958
+X0.5499 Y49.9970
+X0.4499 Y49.9980
+X0.3500 Y49.9988
+X0.2500 Y49.9994
+X0.1500 Y49.9998
+X0.0500 Y50.0000
+X-0.0500 Y50.0000
+X-0.1500 Y49.9998
+X-0.2500 Y49.9994
+X-0.3500 Y49.9988
+X-0.4499 Y49.9980
+X-0.5499 Y49.9970
+X-0.6499 Y49.9958
+X-0.7499 Y49.9944
+X-0.8498 Y49.9928
+X-0.9498 Y49.9910
+X-1.0498 Y49.9890
+X-1.1497 Y49.9868
+X-1.2497 Y49.9844
+X-1.3497 Y49.9818
+X-1.4496 Y49.9790
+X-1.5496 Y49.9760
+X-1.6495 Y49.9728
+X-1.7494 Y49.9694
+X-1.8493 Y49.9658
+X-1.9493 Y49.9620
+X-2.0492 Y49.9580
+X-2.1491 Y49.9538
+X-2.2489 Y49.9494
+X-2.3488 Y49.9448
+X-2.4487 Y49.9400
+X-2.5486 Y49.9350
+X-2.6484 Y49.9298
+X-2.7483 Y49.9244
+X-2.8481 Y49.9188
+X-2.9479 Y49.9130
+X-3.0477 Y49.9070
+X-3.1475 Y49.9008
+X-3.2473 Y49.8944
+X-3.3471 Y49.8878
+X-3.4468 Y49.8811
+X-3.5466 Y49.8741
+X-3.6463 Y49.8669
+X-3.7460 Y49.8595
+X-3.8457 Y49.8519
+X-3.9454 Y49.8441
+X-4.0450 Y49.8361
+X-4.1447 Y49.8279
+X-4.2443 Y49.8195
+X-4.3440 Y49.8109
+X-4.4436 Y49.8022
+X-4.5431 Y49.7932
+X-4.6427 Y49.7840
+X-4.7422 Y49.7746
+X-4.8418 Y49.7650
+X-4.9413 Y49.7552
+X-5.0408 Y49.7453
+X-5.1402 Y49.7351
+X-5.2397 Y49.7247
+X-5.3391 Y49.7141
+X-5.4385 Y49.7033
+X-5.5379 Y49.6924
+X-5.6373 Y49.6812
+X-5.7366 Y49.6698
+X-5.8359 Y49.6583
+X-5.9352 Y49.6465
+X-6.0345 Y49.6345
+X-6.1337 Y49.6223
+X-6.2329 Y49.6100
+X-6.3321 Y49.5974
+X-6.4313 Y49.5847
+X-6.5304 Y49.5717
+X-6.6296 Y49.5585
+X-6.7286 Y49.5452
+X-6.8277 Y49.5316
+X-6.9267 Y49.5179
+X-7.0258 Y49.5039
+X-7.1247 Y49.4898
+X-7.2237 Y49.4754
+X-7.3226 Y49.4609
+X-7.4215 Y49.4461
+X-7.5204 Y49.4312
+X-7.6192 Y49.4161
+X-7.7180 Y49.4007
+X-7.8168 Y49.3852
+X-7.9155 Y49.3695
+X-8.0142 Y49.3535
+X-8.1129 Y49.3374
+X-8.2116 Y49.3211
+X-8.3102 Y49.3046
+X-8.4088 Y49.2879
+X-8.5073 Y49.2709
+X-8.6058 Y49.2538
+X-8.7043 Y49.2365
+X-8.8027 Y49.2190
+X-8.9011 Y49.2013
+X-8.9995 Y49.1834
+X-9.0978 Y49.1653
+X-9.1961 Y49.1470
+X-9.2944 Y49.1285
+X-9.3926 Y49.1099
+X-9.4908 Y49.0910
+X-9.5890 Y49.0719
+X-9.6871 Y49.0526
+X-9.7852 Y49.0332
+X-9.8832 Y49.0135
+X-9.9812 Y48.9936
+X-10.0791 Y48.9736
+X-10.1771 Y48.9533
+X-10.2749 Y48.9329
+X-10.3728 Y48.9122
+X-10.4706 Y48.8914
+X-10.5683 Y48.8703
+X-10.6660 Y48.8491
+X-10.7637 Y48.8277
+X-10.8613 Y48.8061
+X-10.9589 Y48.7843
+X-11.0564 Y48.7622
+X-11.1539 Y48.7400
+X-11.2513 Y48.7176
+X-11.3487 Y48.6950
+X-11.4461 Y48.6722
+X-11.5434 Y48.6493
+X-11.6407 Y48.6261
+X-11.7379 Y48.6027
+X-11.8351 Y48.5791
+X-11.9322 Y48.5554
+X-12.0292 Y48.5314
+X-12.1263 Y48.5073
+X-12.2233 Y48.4829
+X-12.3202 Y48.4584
+X-12.4171 Y48.4336
+X-12.5139 Y48.4087
+X-12.6107 Y48.3836
+X-12.7074 Y48.3583
+X-12.8041 Y48.3328
+X-12.9007 Y48.3071
+X-12.9973 Y48.2812
+X-13.0938 Y48.2551
+X-13.1903 Y48.2288
+X-13.2867 Y48.2023
+X-13.3831 Y48.1757
+X-13.4794 Y48.1488
+X-13.5756 Y48.1217
+X-13.6718 Y48.0945
+X-13.7680 Y48.0671
+X-13.8641 Y48.0394
+X-13.9601 Y48.0116
+X-14.0561 Y47.9836
+X-14.1520 Y47.9554
+X-14.2479 Y47.9270
+X-14.3437 Y47.8984
+X-14.4395 Y47.8696
+X-14.5352 Y47.8407
+X-14.6308 Y47.8115
+X-14.7264 Y47.7821
+X-14.8219 Y47.7526
+X-14.9174 Y47.7229
+X-15.0128 Y47.6929
+X-15.1081 Y47.6628
+X-15.2034 Y47.6325
+X-15.2986 Y47.6020
+X-15.3938 Y47.5713
+X-15.4889 Y47.5405
+X-15.5839 Y47.5094
+X-15.6789 Y47.4781
+X-15.7738 Y47.4467
+X-15.8687 Y47.4150
+X-15.9634 Y47.3832
+X-16.0582 Y47.3512
+X-16.1528 Y47.3190
+X-16.2474 Y47.2866
+X-16.3419 Y47.2540
+X-16.4364 Y47.2212
+X-16.5308 Y47.1883
+X-16.6251 Y47.1551
+X-16.7194 Y47.1218
+X-16.8136 Y47.0882
+X-16.9077 Y47.0545
+X-17.0018 Y47.0206
+X-17.0958 Y46.9865
+X-17.1897 Y46.9522
+X-17.2836 Y46.9178
+X-17.3774 Y46.8831
+X-17.4711 Y46.8483
+X-17.5647 Y46.8132
+X-17.6583 Y46.7780
+X-17.7518 Y46.7426
+X-17.8453 Y46.7070
+X-17.9386 Y46.6713
+X-18.0319 Y46.6353
+X-18.1251 Y46.5991
+X-18.2183 Y46.5628
+X-18.3114 Y46.5263
+X-18.4044 Y46.4896
+X-18.4973 Y46.4527
+X-18.5902 Y46.4156
+X-18.6829 Y46.3783
+X-18.7756 Y46.3409
+X-18.8683 Y46.3032
+X-18.9608 Y46.2654
+X-19.0533 Y46.2274
+X-19.1457 Y46.1892
+X-19.2380 Y46.1508
+X-19.3303 Y46.1123
+X-19.4225 Y46.0735
+X-19.5146 Y46.0346
+X-19.6066 Y45.9955
+X-19.6985 Y45.9562
+X-19.7904 Y45.9167
+X-19.8822 Y45.8770
+X-19.9739 Y45.8372
+X-20.0655 Y45.7971
+X-20.1570 Y45.7569
+X-20.2485 Y45.7165
+X-20.3399 Y45.6759
+X-20.4312 Y45.6352
+X-20.5224 Y45.5942
+X-20.6135 Y45.5531
+X-20.7046 Y45.5118
+X-20.7956 Y45.4703
+X-20.8864 Y45.4286
+X-20.9772 Y45.3867
+X-21.0680 Y45.3447
+X-21.1586 Y45.3025
+X-21.2491 Y45.2601
+X-21.3396 Y45.2175
+X-21.4300 Y45.1747
+X-21.5203 Y45.1318
+X-21.6105 Y45.0886
+X-21.7006 Y45.0453
+X-21.7907 Y45.0019
+X-21.8806 Y44.9582
+X-21.9705 Y44.9143
+X-22.0602 Y44.8703
+X-22.1499 Y44.8261
+X-22.2395 Y44.7817
+X-22.3290 Y44.7372
+X-22.4184 Y44.6924
+X-22.5078 Y44.6475
+X-22.5970 Y44.6024
+X-22.6862 Y44.5571
+X-22.7752 Y44.5117
+X-22.8642 Y44.4660
+X-22.9531 Y44.4202
+X-23.0418 Y44.3742
+X-23.1305 Y44.3281
+X-23.2191 Y44.2817
+X-23.3076 Y44.2352
+X-23.3960 Y44.1885
+X-23.4844 Y44.1416
+X-23.5726 Y44.0946
+X-23.6607 Y44.0474
+X-23.7488 Y44.0000
+X-23.8367 Y43.9524
+X-23.9245 Y43.9046
+X-24.0123 Y43.8567
+X-24.0999 Y43.8086
+X-24.1875 Y43.7603
+X-24.2750 Y43.7119
+X-24.3623 Y43.6632
+X-24.4496 Y43.6144
+X-24.5368 Y43.5654
+X-24.6238 Y43.5163
+X-24.7108 Y43.4670
+X-24.7977 Y43.4174
+X-24.8845 Y43.3678
+X-24.9711 Y43.3179
+X-25.0577 Y43.2679
+X-25.1442 Y43.2177
+X-25.2306 Y43.1673
+X-25.3168 Y43.1168
+X-25.4030 Y43.0661
+X-25.4891 Y43.0152
+X-25.5750 Y42.9641
+X-25.6609 Y42.9129
+X-25.7467 Y42.8615
+X-25.8323 Y42.8099
+X-25.9179 Y42.7582
+X-26.0033 Y42.7063
+X-26.0887 Y42.6542
+X-26.1739 Y42.6019
+X-26.2591 Y42.5495
+X-26.3441 Y42.4969
+X-26.4290 Y42.4442
+X-26.5139 Y42.3912
+X-26.5986 Y42.3381
+X-26.6832 Y42.2848
+X-26.7677 Y42.2314
+X-26.8521 Y42.1778
+X-26.9364 Y42.1240
+X-27.0206 Y42.0700
+X-27.1046 Y42.0159
+X-27.1886 Y41.9616
+X-27.2725 Y41.9072
+X-27.3562 Y41.8526
+X-27.4399 Y41.7978
+X-27.5234 Y41.7428
+X-27.6068 Y41.6877
+X-27.6901 Y41.6324
+X-27.7733 Y41.5770
+X-27.8564 Y41.5213
+X-27.9394 Y41.4655
+X-28.0222 Y41.4096
+X-28.1050 Y41.3535
+X-28.1876 Y41.2972
+X-28.2702 Y41.2407
+X-28.3526 Y41.1841
+X-28.4349 Y41.1273
+X-28.5171 Y41.0704
+X-28.5991 Y41.0133
+X-28.6811 Y40.9560
+X-28.7629 Y40.8986
+X-28.8447 Y40.8410
+X-28.9263 Y40.7832
+X-29.0078 Y40.7253
+X-29.0892 Y40.6672
+X-29.1704 Y40.6089
+X-29.2516 Y40.5505
+X-29.3326 Y40.4919
+X-29.4135 Y40.4332
+X-29.4943 Y40.3743
+X-29.5750 Y40.3152
+X-29.6556 Y40.2560
+X-29.7360 Y40.1966
+X-29.8163 Y40.1371
+X-29.8965 Y40.0774
+X-29.9766 Y40.0175
+X-30.0566 Y39.9575
+X-30.1364 Y39.8973
+X-30.2161 Y39.8370
+X-30.2958 Y39.7765
+X-30.3752 Y39.7158
+X-30.4546 Y39.6550
+X-30.5338 Y39.5940
+X-30.6130 Y39.5329
+X-30.6919 Y39.4716
+X-30.7708 Y39.4101
+X-30.8496 Y39.3485
+X-30.9282 Y39.2867
+X-31.0067 Y39.2248
+X-31.0851 Y39.1627
+X-31.1633 Y39.1005
+X-31.2414 Y39.0381
+X-31.3195 Y38.9755
+X-31.3973 Y38.9128
+X-31.4751 Y38.8500
+X-31.5527 Y38.7869
+X-31.6302 Y38.7238
+X-31.7076 Y38.6604
+X-31.7848 Y38.5969
+X-31.8620 Y38.5333
+X-31.9389 Y38.4695
+X-32.0158 Y38.4056
+X-32.0925 Y38.3415
+X-32.1692 Y38.2772
+X-32.2456 Y38.2128
+X-32.3220 Y38.1483
+X-32.3982 Y38.0835
+X-32.4743 Y38.0187
+X-32.5503 Y37.9537
+X-32.6261 Y37.8885
+X-32.7018 Y37.8232
+X-32.7774 Y37.7577
+X-32.8528 Y37.6921
+X-32.9281 Y37.6263
+X-33.0033 Y37.5604
+X-33.0783 Y37.4943
+X-33.1533 Y37.4281
+X-33.2280 Y37.3617
+X-33.3027 Y37.2952
+X-33.3772 Y37.2285
+X-33.4516 Y37.1617
+X-33.5258 Y37.0947
+X-33.5999 Y37.0276
+X-33.6739 Y36.9604
+X-33.7478 Y36.8929
+X-33.8215 Y36.8254
+X-33.8950 Y36.7577
+X-33.9685 Y36.6898
+X-34.0418 Y36.6218
+X-34.1149 Y36.5537
+X-34.1880 Y36.4854
+X-34.2609 Y36.4169
+X-34.3336 Y36.3483
+X-34.4062 Y36.2796
+X-34.4787 Y36.2107
+X-34.5511 Y36.1417
+X-34.6233 Y36.0726
+X-34.6953 Y36.0032
+X-34.7673 Y35.9338
+X-34.8391 Y35.8642
+X-34.9107 Y35.7945
+X-34.9822 Y35.7246
+X-35.0536 Y35.6545
+X-35.1248 Y35.5844
+X-35.1959 Y35.5141
+X-35.2669 Y35.4436
+X-35.3377 Y35.3730
+X-35.4083 Y35.3023
+X-35.4788 Y35.2314
+X-35.5492 Y35.1604
+X-35.6195 Y35.0892
+X-35.6896 Y35.0179
+X-35.7595 Y34.9465
+X-35.8293 Y34.8749
+X-35.8990 Y34.8032
+X-35.9685 Y34.7313
+X-36.0379 Y34.6593
+X-36.1072 Y34.5872
+X-36.1762 Y34.5149
+X-36.2452 Y34.4425
+X-36.3140 Y34.3700
+X-36.3827 Y34.2973
+X-36.4512 Y34.2244
+X-36.5195 Y34.1515
+X-36.5878 Y34.0784
+X-36.6558 Y34.0051
+X-36.7238 Y33.9318
+X-36.7915 Y33.8583
+X-36.8592 Y33.7846
+X-36.9267 Y33.7109
+X-36.9940 Y33.6369
+X-37.0612 Y33.5629
+X-37.1282 Y33.4887
+X-37.1951 Y33.4144
+X-37.2619 Y33.3400
+X-37.3285 Y33.2654
+X-37.3949 Y33.1907
+X-37.4612 Y33.1158
+X-37.5274 Y33.0408
+X-37.5934 Y32.9657
+X-37.6592 Y32.8905
+X-37.7249 Y32.8151
+X-37.7905 Y32.7396
+X-37.8558 Y32.6640
+X-37.9211 Y32.5882
+X-37.9862 Y32.5123
+X-38.0511 Y32.4363
+X-38.1159 Y32.3601
+X-38.1805 Y32.2838
+X-38.2450 Y32.2074
+X-38.3094 Y32.1309
+X-38.3735 Y32.0542
+X-38.4376 Y31.9774
+X-38.5014 Y31.9005
+X-38.5651 Y31.8234
+X-38.6287 Y31.7462
+X-38.6921 Y31.6689
+X-38.7554 Y31.5915
+X-38.8185 Y31.5139
+X-38.8814 Y31.4362
+X-38.9442 Y31.3584
+X-39.0068 Y31.2805
+X-39.0693 Y31.2024
+X-39.1316 Y31.1242
+X-39.1938 Y31.0459
+X-39.2558 Y30.9675
+X-39.3176 Y30.8889
+X-39.3793 Y30.8102
+X-39.4409 Y30.7314
+X-39.5022 Y30.6525
+X-39.5635 Y30.5734
+X-39.6245 Y30.4942
+X-39.6854 Y30.4149
+X-39.7462 Y30.3355
+X-39.8067 Y30.2560
+X-39.8672 Y30.1763
+X-39.9274 Y30.0965
+X-39.9875 Y30.0166
+X-40.0475 Y29.9366
+X-40.1073 Y29.8564
+X-40.1669 Y29.7762
+X-40.2264 Y29.6958
+X-40.2857 Y29.6153
+X-40.3448 Y29.5347
+X-40.4038 Y29.4539
+X-40.4626 Y29.3731
+X-40.5213 Y29.2921
+X-40.5798 Y29.2110
+X-40.6381 Y29.1298
+X-40.6963 Y29.0485
+X-40.7543 Y28.9670
+X-40.8121 Y28.8855
+X-40.8698 Y28.8038
+X-40.9273 Y28.7220
+X-40.9847 Y28.6401
+X-41.0419 Y28.5581
+X-41.0989 Y28.4760
+X-41.1557 Y28.3937
+X-41.2124 Y28.3114
+X-41.2690 Y28.2289
+X-41.3253 Y28.1463
+X-41.3815 Y28.0636
+X-41.4376 Y27.9808
+X-41.4935 Y27.8979
+X-41.5492 Y27.8149
+X-41.6047 Y27.7317
+X-41.6601 Y27.6485
+X-41.7153 Y27.5651
+X-41.7703 Y27.4816
+X-41.8252 Y27.3981
+X-41.8799 Y27.3144
+X-41.9344 Y27.2306
+X-41.9888 Y27.1466
+X-42.0430 Y27.0626
+X-42.0970 Y26.9785
+X-42.1509 Y26.8943
+X-42.2046 Y26.8099
+X-42.2581 Y26.7255
+X-42.3115 Y26.6409
+X-42.3647 Y26.5562
+X-42.4177 Y26.4715
+X-42.4706 Y26.3866
+X-42.5232 Y26.3016
+X-42.5757 Y26.2165
+X-42.6281 Y26.1313
+X-42.6803 Y26.0460
+X-42.7323 Y25.9606
+X-42.7841 Y25.8751
+X-42.8357 Y25.7895
+X-42.8872 Y25.7038
+X-42.9385 Y25.6180
+X-42.9897 Y25.5321
+X-43.0407 Y25.4460
+X-43.0915 Y25.3599
+X-43.1421 Y25.2737
+X-43.1925 Y25.1874
+X-43.2428 Y25.1010
+X-43.2929 Y25.0144
+X-43.3429 Y24.9278
+X-43.3926 Y24.8411
+X-43.4422 Y24.7543
+X-43.4916 Y24.6673
+X-43.5409 Y24.5803
+X-43.5899 Y24.4932
+X-43.6388 Y24.4060
+X-43.6876 Y24.3187
+X-43.7361 Y24.2312
+X-43.7845 Y24.1437
+X-43.8327 Y24.0561
+X-43.8807 Y23.9684
+X-43.9285 Y23.8806
+X-43.9762 Y23.7927
+X-44.0237 Y23.7048
+X-44.0710 Y23.6167
+X-44.1181 Y23.5285
+X-44.1651 Y23.4402
+X-44.2119 Y23.3519
+X-44.2585 Y23.2634
+X-44.3049 Y23.1748
+X-44.3512 Y23.0862
+X-44.3973 Y22.9975
+X-44.4432 Y22.9086
+X-44.4889 Y22.8197
+X-44.5344 Y22.7307
+X-44.5798 Y22.6416
+X-44.6250 Y22.5524
+X-44.6700 Y22.4631
+X-44.7148 Y22.3737
+X-44.7595 Y22.2843
+X-44.8039 Y22.1947
+X-44.8482 Y22.1051
+X-44.8924 Y22.0154
+X-44.9363 Y21.9255
+X-44.9800 Y21.8356
+X-45.0236 Y21.7457
+X-45.0670 Y21.6556
+X-45.1102 Y21.5654
+X-45.1533 Y21.4752
+X-45.1961 Y21.3848
+X-45.2388 Y21.2944
+X-45.2813 Y21.2039
+X-45.3236 Y21.1133
+X-45.3657 Y21.0226
+X-45.4077 Y20.9319
+X-45.4494 Y20.8410
+X-45.4910 Y20.7501
+X-45.5324 Y20.6591
+X-45.5737 Y20.5680
+X-45.6147 Y20.4768
+X-45.6556 Y20.3855
+X-45.6962 Y20.2942
+X-45.7367 Y20.2028
+X-45.7770 Y20.1113
+X-45.8172 Y20.0197
+X-45.8571 Y19.9280
+X-45.8969 Y19.8363
+X-45.9364 Y19.7445
+X-45.9758 Y19.6526
+X-46.0150 Y19.5606
+X-46.0541 Y19.4685
+X-46.0929 Y19.3764
+X-46.1316 Y19.2842
+X-46.1700 Y19.1919
+X-46.2083 Y19.0995
+X-46.2464 Y19.0071
+X-46.2843 Y18.9146
+X-46.3221 Y18.8220
+X-46.3596 Y18.7293
+X-46.3970 Y18.6366
+X-46.4341 Y18.5437
+X-46.4711 Y18.4508
+X-46.5079 Y18.3579
+X-46.5446 Y18.2648
+X-46.5810 Y18.1717
+X-46.6172 Y18.0785
+X-46.6533 Y17.9853
+X-46.6892 Y17.8919
+X-46.7249 Y17.7985
+X-46.7604 Y17.7051
+X-46.7957 Y17.6115
+X-46.8308 Y17.5179
+X-46.8657 Y17.4242
+X-46.9005 Y17.3305
+X-46.9350 Y17.2367
+X-46.9694 Y17.1428
+X-47.0036 Y17.0488
+X-47.0376 Y16.9548
+X-47.0714 Y16.8607
+X-47.1050 Y16.7665
+X-47.1385 Y16.6723
+X-47.1717 Y16.5780
+X-47.2048 Y16.4836
+X-47.2376 Y16.3892
+X-47.2703 Y16.2947
+X-47.3028 Y16.2001
+X-47.3351 Y16.1055
+X-47.3672 Y16.0108
+X-47.3991 Y15.9161
+X-47.4309 Y15.8212
+X-47.4624 Y15.7264
+X-47.4938 Y15.6314
+X-47.5249 Y15.5364
+X-47.5559 Y15.4413
+X-47.5867 Y15.3462
+X-47.6173 Y15.2510
+X-47.6477 Y15.1558
+X-47.6779 Y15.0605
+X-47.7079 Y14.9651
+X-47.7378 Y14.8696
+X-47.7674 Y14.7742
+X-47.7968 Y14.6786
+X-47.8261 Y14.5830
+X-47.8552 Y14.4873
+X-47.8840 Y14.3916
+X-47.9127 Y14.2958
+X-47.9412 Y14.2000
+X-47.9695 Y14.1041
+X-47.9976 Y14.0081
+X-48.0255 Y13.9121
+X-48.0533 Y13.8160
+X-48.0808 Y13.7199
+X-48.1081 Y13.6237
+X-48.1353 Y13.5275
+X-48.1622 Y13.4312
+X-48.1890 Y13.3349
+X-48.2156 Y13.2385
+X-48.2420 Y13.1420
+X-48.2681 Y13.0456
+X-48.2941 Y12.9490
+X-48.3199 Y12.8524
+X-48.3455 Y12.7557
+X-48.3709 Y12.6590
+X-48.3962 Y12.5623
+X-48.4212 Y12.4655
+X-48.4460 Y12.3686
+X-48.4707 Y12.2717
+X-48.4951 Y12.1748
+X-48.5194 Y12.0778
+X-48.5434 Y11.9807
+X-48.5673 Y11.8836
+X-48.5909 Y11.7865
+X-48.6144 Y11.6893
+X-48.6377 Y11.5920
+X-48.6608 Y11.4948
+X-48.6837 Y11.3974
+X-48.7064 Y11.3000
+X-48.7289 Y11.2026
+X-48.7512 Y11.1052
+X-48.7733 Y11.0076
+X-48.7952 Y10.9101
+X-48.8169 Y10.8125
+X-48.8384 Y10.7148
+X-48.8598 Y10.6172
+X-48.8809 Y10.5194
+X-48.9018 Y10.4217
+X-48.9226 Y10.3239
+X-48.9431 Y10.2260
+X-48.9635 Y10.1281
+X-48.9836 Y10.0302
+X-49.0036 Y9.9322
+X-49.0234 Y9.8342
+X-49.0429 Y9.7361
+X-49.0623 Y9.6380
+X-49.0815 Y9.5399
+X-49.1004 Y9.4417
+X-49.1192 Y9.3435
+X-49.1378 Y9.2453
+X-49.1562 Y9.1470
+X-49.1744 Y9.0487
+X-49.1924 Y8.9503
+X-49.2102 Y8.8519
+X-49.2278 Y8.7535
+X-49.2452 Y8.6551
+X-49.2624 Y8.5566
+X-49.2794 Y8.4580
+X-49.2962 Y8.3595
+X-49.3129 Y8.2609
+X-49.3293 Y8.1622
+X-49.3455 Y8.0636
+X-49.3615 Y7.9649
+X-49.3774 Y7.8662
+X-49.3930 Y7.7674
+X-49.4084 Y7.6686
+X-49.4237 Y7.5698
+X-49.4387 Y7.4709
+X-49.4535 Y7.3721
+X-49.4682 Y7.2732
+X-49.4826 Y7.1742
+X-49.4969 Y7.0753
+X-49.5109 Y6.9763
+X-49.5248 Y6.8772
+X-49.5384 Y6.7782
+X-49.5519 Y6.6791
+X-49.5651 Y6.5800
+X-49.5782 Y6.4809
+X-49.5911 Y6.3817
+X-49.6037 Y6.2825
+X-49.6162 Y6.1833
+X-49.6285 Y6.0841
+X-49.6405 Y5.9848
+X-49.6524 Y5.8856
+X-49.6641 Y5.7863
+X-49.6755 Y5.6869
+X-49.6868 Y5.5876
+X-49.6979 Y5.4882
+X-49.7088 Y5.3888
+X-49.7194 Y5.2894
+X-49.7299 Y5.1900
+X-49.7402 Y5.0905
+X-49.7503 Y4.9910
+X-49.7602 Y4.8915
+X-49.7698 Y4.7920
+X-49.7793 Y4.6925
+X-49.7886 Y4.5929
+X-49.7977 Y4.4933
+X-49.8066 Y4.3938
+X-49.8153 Y4.2941
+X-49.8237 Y4.1945
+X-49.8320 Y4.0949
+X-49.8401 Y3.9952
+X-49.8480 Y3.8955
+X-49.8557 Y3.7959
+X-49.8632 Y3.6961
+X-49.8705 Y3.5964
+X-49.8776 Y3.4967
+X-49.8845 Y3.3969
+X-49.8912 Y3.2972
+X-49.8977 Y3.1974
+X-49.9040 Y3.0976
+X-49.9101 Y2.9978
+X-49.9159 Y2.8980
+X-49.9216 Y2.7982
+X-49.9271 Y2.6983
+X-49.9324 Y2.5985
+X-49.9375 Y2.4986
+X-49.9424 Y2.3988
+X-49.9471 Y2.2989
+X-49.9516 Y2.1990
+X-49.9559 Y2.0991
+X-49.9600 Y1.9992
+X-49.9639 Y1.8993
+X-49.9676 Y1.7994
+X-49.9711 Y1.6995
+X-49.9744 Y1.5995
+X-49.9775 Y1.4996
+X-49.9804 Y1.3996
+X-49.9831 Y1.2997
+X-49.9856 Y1.1997
+X-49.9879 Y1.0998
+X-49.9900 Y0.9998
+X-49.9919 Y0.8998
+X-49.9936 Y0.7999
+X-49.9951 Y0.6999
+X-49.9964 Y0.5999
+X-49.9975 Y0.4999
+X-49.9984 Y0.3999
+X-49.9991 Y0.3000
+X-49.9996 Y0.2000
+X-49.9999 Y0.1000
+X-50.0000 Y0.0000
+X-49.9999 Y-0.1000
+X-49.9996 Y-0.2000
+X-49.9991 Y-0.3000
+X-49.9984 Y-0.3999
+X-49.9975 Y-0.4999
+X-49.9964 Y-0.5999
+X-49.9951 Y-0.6999
+X-49.9936 Y-0.7999
+X-49.9919 Y-0.8998
+X-49.9900 Y-0.9998
+X-49.9879 Y-1.0998
+X-49.9856 Y-1.1997
+X-49.9831 Y-1.2997
+X-49.9804 Y-1.3996
+X-49.9775 Y-1.4996
+X-49.9744 Y-1.5995
+X-49.9711 Y-1.6995
+X-49.9676 Y-1.7994
+X-49.9639 Y-1.8993
+X-49.9600 Y-1.9992
+X-49.9559 Y-2.0991
+X-49.9516 Y-2.1990
+X-49.9471 Y-2.2989
+X-49.9424 Y-2.3988
+X-49.9375 Y-2.4986
+X-49.9324 Y-2.5985
+X-49.9271 Y-2.6983
+X-49.9216 Y-2.7982
+X-49.9159 Y-2.8980
+X-49.9101 Y-2.9978
+X-49.9040 Y-3.0976
+X-49.8977 Y-3.1974
+X-49.8912 Y-3.2972
+X-49.8845 Y-3.3969
+X-49.8776 Y-3.4967
+X-49.8705 Y-3.5964
+X-49.8632 Y-3.6961
+X-49.8557 Y-3.7959
+X-49.8480 Y-3.8955
+X-49.8401 Y-3.9952
+X-49.8320 Y-4.0949
+X-49.8237 Y-4.1945
+X-49.8153 Y-4.2941
+X-49.8066 Y-4.3938
+X-49.7977 Y-4.4933
+X-49.7886 Y-4.5929
+X-49.7793 Y-4.6925
+X-49.7698 Y-4.7920
+X-49.7602 Y-4.8915
+X-49.7503 Y-4.9910
+X-49.7402 Y-5.0905
+X-49.7299 Y-5.1900
+X-49.7194 Y-5.2894
+X-49.7088 Y-5.3888
+X-49.6979 Y-5.4882
+X-49.6868 Y-5.5876
+X-49.6755 Y-5.6869
+X-49.6641 Y-5.7863
+X-49.6524 Y-5.8856
+X-49.6405 Y-5.9848
+X-49.6285 Y-6.0841
+X-49.6162 Y-6.1833
+X-49.6037 Y-6.2825
+X-49.5911 Y-6.3817
+X-49.5782 Y-6.4809
+X-49.5651 Y-6.5800
+X-49.5519 Y-6.6791
+X-49.5384 Y-6.7782
+X-49.5248 Y-6.8772
+X-49.5109 Y-6.9763
+X-49.4969 Y-7.0753
+X-49.4826 Y-7.1742
+X-49.4682 Y-7.2732
+X-49.4535 Y-7.3721
+X-49.4387 Y-7.4709
+X-49.4237 Y-7.5698
+X-49.4084 Y-7.6686
+X-49.3930 Y-7.7674
+X-49.3774 Y-7.8662
+X-49.3615 Y-7.9649
+X-49.3455 Y-8.0636
+X-49.3293 Y-8.1622
+X-49.3129 Y-8.2609
+X-49.2962 Y-8.3595
+X-49.2794 Y-8.4580
+X-49.2624 Y-8.5566
+X-49.2452 Y-8.6551
+X-49.2278 Y-8.7535
+X-49.2102 Y-8.8519
+X-49.1924 Y-8.9503
+X-49.1744 Y-9.0487
+X-49.1562 Y-9.1470
+X-49.1378 Y-9.2453
+X-49.1192 Y-9.3435
+X-49.1004 Y-9.4417
+X-49.0815 Y-9.5399
+X-49.0623 Y-9.6380
+X-49.0429 Y-9.7361
+X-49.0234 Y-9.8342
+X-49.0036 Y-9.9322
+X-48.9836 Y-10.0302
+X-48.9635 Y-10.1281
+X-48.9431 Y-10.2260
+X-48.9226 Y-10.3239
+X-48.9018 Y-10.4217
+X-48.8809 Y-10.5194
+X-48.8598 Y-10.6172
+X-48.8384 Y-10.7148
+X-48.8169 Y-10.8125
+X-48.7952 Y-10.9101
+X-48.7733 Y-11.0076
+X-48.7512 Y-11.1052
+X-48.7289 Y-11.2026
+X-48.7064 Y-11.3000
+X-48.6837 Y-11.3974
+X-48.6608 Y-11.4948
+X-48.6377 Y-11.5920
+X-48.6144 Y-11.6893
+X-48.5909 Y-11.7865
+X-48.5673 Y-11.8836
+X-48.5434 Y-11.9807
+X-48.5194 Y-12.0778
+X-48.4951 Y-12.1748
+X-48.4707 Y-12.2717
+X-48.4460 Y-12.3686
+X-48.4212 Y-12.4655
+X-48.3962 Y-12.5623
+X-48.3709 Y-12.6590
+X-48.3455 Y-12.7557
+X-48.3199 Y-12.8524
+X-48.2941 Y-12.9490
+X-48.2681 Y-13.0456
+X-48.2420 Y-13.1420
+X-48.2156 Y-13.2385
+X-48.1890 Y-13.3349
+X-48.1622 Y-13.4312
+X-48.1353 Y-13.5275
+X-48.1081 Y-13.6237
+X-48.0808 Y-13.7199
+X-48.0533 Y-13.8160
+X-48.0255 Y-13.9121
+X-47.9976 Y-14.0081
+X-47.9695 Y-14.1041
+X-47.9412 Y-14.2000
+X-47.9127 Y-14.2958
+X-47.8840 Y-14.3916
+X-47.8552 Y-14.4873
+X-47.8261 Y-14.5830
+X-47.7968 Y-14.6786
+X-47.7674 Y-14.7742
+X-47.7378 Y-14.8696
+X-47.7079 Y-14.9651
+X-47.6779 Y-15.0605
+X-47.6477 Y-15.1558
+X-47.6173 Y-15.2510
+X-47.5867 Y-15.3462
+X-47.5559 Y-15.4413
+X-47.5249 Y-15.5364
+X-47.4938 Y-15.6314
+X-47.4624 Y-15.7264
+X-47.4309 Y-15.8212
+X-47.3991 Y-15.9161
+X-47.3672 Y-16.0108
+X-47.3351 Y-16.1055
+X-47.3028 Y-16.2001
+X-47.2703 Y-16.2947
+X-47.2376 Y-16.3892
+X-47.2048 Y-16.4836
+X-47.1717 Y-16.5780
+X-47.1385 Y-16.6723
+X-47.1050 Y-16.7665
+X-47.0714 Y-16.8607
+X-47.0376 Y-16.9548
+X-47.0036 Y-17.0488
+X-46.9694 Y-17.1428
+X-46.9350 Y-17.2367
+X-46.9005 Y-17.3305
+X-46.8657 Y-17.4242
+X-46.8308 Y-17.5179
+X-46.7957 Y-17.6115
+X-46.7604 Y-17.7051
+X-46.7249 Y-17.7985
+X-46.6892 Y-17.8919
+X-46.6533 Y-17.9853
+X-46.6172 Y-18.0785
+X-46.5810 Y-18.1717
+X-46.5446 Y-18.2648
+X-46.5079 Y-18.3579
+X-46.4711 Y-18.4508
+X-46.4341 Y-18.5437
+X-46.3970 Y-18.6366
+X-46.3596 Y-18.7293
+X-46.3221 Y-18.8220
+X-46.2843 Y-18.9146
+X-46.2464 Y-19.0071
+X-46.2083 Y-19.0995
+X-46.1700 Y-19.1919
+X-46.1316 Y-19.2842
+X-46.0929 Y-19.3764
+X-46.0541 Y-19.4685
+X-46.0150 Y-19.5606
+X-45.9758 Y-19.6526
+X-45.9364 Y-19.7445
+X-45.8969 Y-19.8363
+X-45.8571 Y-19.9280
+X-45.8172 Y-20.0197
+X-45.7770 Y-20.1113
+X-45.7367 Y-20.2028
+X-45.6962 Y-20.2942
+X-45.6556 Y-20.3855
+X-45.6147 Y-20.4768
+X-45.5737 Y-20.5680
+X-45.5324 Y-20.6591
+X-45.4910 Y-20.7501
+X-45.4494 Y-20.8410
+X-45.4077 Y-20.9319
+X-45.3657 Y-21.0226
+X-45.3236 Y-21.1133
+X-45.2813 Y-21.2039
+X-45.2388 Y-21.2944
+X-45.1961 Y-21.3848
+X-45.1533 Y-21.4752
+X-45.1102 Y-21.5654
+X-45.0670 Y-21.6556
+X-45.0236 Y-21.7457
+X-44.9800 Y-21.8356
+X-44.9363 Y-21.9255
+X-44.8924 Y-22.0154
+X-44.8482 Y-22.1051
+X-44.8039 Y-22.1947
+X-44.7595 Y-22.2843
+X-44.7148 Y-22.3737
+X-44.6700 Y-22.4631
+X-44.6250 Y-22.5524
+X-44.5798 Y-22.6416
+X-44.5344 Y-22.7307
+X-44.4889 Y-22.8197
+X-44.4432 Y-22.9086
+X-44.3973 Y-22.9975
+X-44.3512 Y-23.0862
+X-44.3049 Y-23.1748
+X-44.2585 Y-23.2634
+X-44.2119 Y-23.3519
+X-44.1651 Y-23.4402
+X-44.1181 Y-23.5285
+X-44.0710 Y-23.6167
+X-44.0237 Y-23.7048
+X-43.9762 Y-23.7927
+X-43.9285 Y-23.8806
+X-43.8807 Y-23.9684
+X-43.8327 Y-24.0561
+X-43.7845 Y-24.1437
+X-43.7361 Y-24.2312
+X-43.6876 Y-24.3187
+X-43.6388 Y-24.4060
+X-43.5899 Y-24.4932
+X-43.5409 Y-24.5803
+X-43.4916 Y-24.6673
+X-43.4422 Y-24.7543
+X-43.3926 Y-24.8411
+X-43.3429 Y-24.9278
+X-43.2929 Y-25.0144
+X-43.2428 Y-25.1010
+X-43.1925 Y-25.1874
+X-43.1421 Y-25.2737
+X-43.0915 Y-25.3599
+X-43.0407 Y-25.4460
+X-42.9897 Y-25.5321
+X-42.9385 Y-25.6180
+X-42.8872 Y-25.7038
+X-42.8357 Y-25.7895
+X-42.7841 Y-25.8751
+X-42.7323 Y-25.9606
+X-42.6803 Y-26.0460
+X-42.6281 Y-26.1313
+X-42.5757 Y-26.2165
+X-42.5232 Y-26.3016
+X-42.4706 Y-26.3866
+X-42.4177 Y-26.4715
+X-42.3647 Y-26.5562
+X-42.3115 Y-26.6409
+X-42.2581 Y-26.7255
+X-42.2046 Y-26.8099
+X-42.1509 Y-26.8943
+X-42.0970 Y-26.9785
+X-42.0430 Y-27.0626
+X-41.9888 Y-27.1466
+X-41.9344 Y-27.2306
+X-41.8799 Y-27.3144
+X-41.8252 Y-27.3981
+X-41.7703 Y-27.4816
+X-41.7153 Y-27.5651
+X-41.6601 Y-27.6485
+X-41.6047 Y-27.7317
+X-41.5492 Y-27.8149
+X-41.4935 Y-27.8979
+X-41.4376 Y-27.9808
+X-41.3815 Y-28.0636
+X-41.3253 Y-28.1463
+X-41.2690 Y-28.2289
+X-41.2124 Y-28.3114
+X-41.1557 Y-28.3937
+X-41.0989 Y-28.4760
+X-41.0419 Y-28.5581
+X-40.9847 Y-28.6401
+X-40.9273 Y-28.7220
+X-40.8698 Y-28.8038
+X-40.8121 Y-28.8855
+X-40.7543 Y-28.9670
+X-40.6963 Y-29.0485
+X-40.6381 Y-29.1298
+X-40.5798 Y-29.2110
+X-40.5213 Y-29.2921
+X-40.4626 Y-29.3731
+X-40.4038 Y-29.4539
+X-40.3448 Y-29.5347
+X-40.2857 Y-29.6153
+X-40.2264 Y-29.6958
+X-40.1669 Y-29.7762
+X-40.1073 Y-29.8564
+X-40.0475 Y-29.9366
+X-39.9875 Y-30.0166
+X-39.9274 Y-30.0965
+X-39.8672 Y-30.1763
+X-39.8067 Y-30.2560
+X-39.7462 Y-30.3355
+X-39.6854 Y-30.4149
+X-39.6245 Y-30.4942
+X-39.5635 Y-30.5734
+X-39.5022 Y-30.6525
+X-39.4409 Y-30.7314
+X-39.3793 Y-30.8102
+X-39.3176 Y-30.8889
+X-39.2558 Y-30.9675
+X-39.1938 Y-31.0459
+X-39.1316 Y-31.1242
+X-39.0693 Y-31.2024
+X-39.0068 Y-31.2805
+X-38.9442 Y-31.3584
+X-38.8814 Y-31.4362
+X-38.8185 Y-31.5139
+X-38.7554 Y-31.5915
+X-38.6921 Y-31.6689
+X-38.6287 Y-31.7462
+X-38.5651 Y-31.8234
+X-38.5014 Y-31.9005
+X-38.4376 Y-31.9774
+X-38.3735 Y-32.0542
+X-38.3094 Y-32.1309
+X-38.2450 Y-32.2074
+X-38.1805 Y-32.2838
+X-38.1159 Y-32.3601
+X-38.0511 Y-32.4363
+X-37.9862 Y-32.5123
+X-37.9211 Y-32.5882
+X-37.8558 Y-32.6640
+X-37.7905 Y-32.7396
+X-37.7249 Y-32.8151
+X-37.6592 Y-32.8905
+X-37.5934 Y-32.9657
+X-37.5274 Y-33.0408
+X-37.4612 Y-33.1158
+X-37.3949 Y-33.1907
+X-37.3285 Y-33.2654
+X-37.2619 Y-33.3400
+X-37.1951 Y-33.4144
+X-37.1282 Y-33.4887
+X-37.0612 Y-33.5629
+X-36.9940 Y-33.6369
+X-36.9267 Y-33.7109
+X-36.8592 Y-33.7846
+X-36.7915 Y-33.8583
+X-36.7238 Y-33.9318
+X-36.6558 Y-34.0051
+X-36.5878 Y-34.0784
+X-36.5195 Y-34.1515
+X-36.4512 Y-34.2244
+X-36.3827 Y-34.2973
+X-36.3140 Y-34.3700
+X-36.2452 Y-34.4425
+X-36.1762 Y-34.5149
+X-36.1072 Y-34.5872
+X-36.0379 Y-34.6593
+X-35.9685 Y-34.7313
+X-35.8990 Y-34.8032
+X-35.8293 Y-34.8749
+X-35.7595 Y-34.9465
+X-35.6896 Y-35.0179
+X-35.6195 Y-35.0892
+X-35.5492 Y-35.1604
+X-35.4788 Y-35.2314
+X-35.4083 Y-35.3023
+X-35.3377 Y-35.3730
+X-35.2669 Y-35.4436
+X-35.1959 Y-35.5141
+X-35.1248 Y-35.5844
+X-35.0536 Y-35.6545
+X-34.9822 Y-35.7246
+X-34.9107 Y-35.7945
+X-34.8391 Y-35.8642
+X-34.7673 Y-35.9338
+X-34.6953 Y-36.0032
+X-34.6233 Y-36.0726
+X-34.5511 Y-36.1417
+X-34.4787 Y-36.2107
+X-34.4062 Y-36.2796
+X-34.3336 Y-36.3483
+X-34.2609 Y-36.4169
+X-34.1880 Y-36.4854
+X-34.1149 Y-36.5537
+X-34.0418 Y-36.6218
+X-33.9685 Y-36.6898
+X-33.8950 Y-36.7577
+X-33.8215 Y-36.8254
+X-33.7478 Y-36.8929
+X-33.6739 Y-36.9604
+X-33.5999 Y-37.0276
+X-33.5258 Y-37.0947
+X-33.4516 Y-37.1617
+X-33.3772 Y-37.2285
+X-33.3027 Y-37.2952
+X-33.2280 Y-37.3617
+X-33.1533 Y-37.4281
+X-33.0783 Y-37.4943
+X-33.0033 Y-37.5604
+X-32.9281 Y-37.6263
+X-32.8528 Y-37.6921
+X-32.7774 Y-37.7577
+X-32.7018 Y-37.8232
+X-32.6261 Y-37.8885
+X-32.5503 Y-37.9537
+X-32.4743 Y-38.0187
+X-32.3982 Y-38.0835
+X-32.3220 Y-38.1483
+X-32.2456 Y-38.2128
+X-32.1692 Y-38.2772
+X-32.0925 Y-38.3415
+X-32.0158 Y-38.4056
+X-31.9389 Y-38.4695
+X-31.8620 Y-38.5333
+X-31.7848 Y-38.5969
+X-31.7076 Y-38.6604
+X-31.6302 Y-38.7238
+X-31.5527 Y-38.7869
+X-31.4751 Y-38.8500
+X-31.3973 Y-38.9128
+X-31.3195 Y-38.9755
+X-31.2414 Y-39.0381
+X-31.1633 Y-39.1005
+X-31.0851 Y-39.1627
+X-31.0067 Y-39.2248
+X-30.9282 Y-39.2867
+X-30.8496 Y-39.3485
+X-30.7708 Y-39.4101
+X-30.6919 Y-39.4716
+X-30.6130 Y-39.5329
+X-30.5338 Y-39.5940
+X-30.4546 Y-39.6550
+X-30.3752 Y-39.7158
+X-30.2958 Y-39.7765
+X-30.2161 Y-39.8370
+X-30.1364 Y-39.8973
+X-30.0566 Y-39.9575
+X-29.9766 Y-40.0175
+X-29.8965 Y-40.0774
+X-29.8163 Y-40.1371
+X-29.7360 Y-40.1966
+X-29.6556 Y-40.2560
+X-29.5750 Y-40.3152
+X-29.4943 Y-40.3743
+X-29.4135 Y-40.4332
+X-29.3326 Y-40.4919
+X-29.2516 Y-40.5505
+X-29.1704 Y-40.6089
+X-29.0892 Y-40.6672
+X-29.0078 Y-40.7253
+X-28.9263 Y-40.7832
+X-28.8447 Y-40.8410
+X-28.7629 Y-40.8986
+X-28.6811 Y-40.9560
+X-28.5991 Y-41.0133
+X-28.5171 Y-41.0704
+X-28.4349 Y-41.1273
+X-28.3526 Y-41.1841
+X-28.2702 Y-41.2407
+X-28.1876 Y-41.2972
+X-28.1050 Y-41.3535
+X-28.0222 Y-41.4096
+X-27.9394 Y-41.4655
+X-27.8564 Y-41.5213
+X-27.7733 Y-41.5770
+X-27.6901 Y-41.6324
+X-27.6068 Y-41.6877
+X-27.5234 Y-41.7428
+X-27.4399 Y-41.7978
+X-27.3562 Y-41.8526
+X-27.2725 Y-41.9072
+X-27.1886 Y-41.9616
+X-27.1046 Y-42.0159
+X-27.0206 Y-42.0700
+X-26.9364 Y-42.1240
+X-26.8521 Y-42.1778
+X-26.7677 Y-42.2314
+X-26.6832 Y-42.2848
+X-26.5986 Y-42.3381
+X-26.5139 Y-42.3912
+X-26.4290 Y-42.4442
+X-26.3441 Y-42.4969
+X-26.2591 Y-42.5495
+X-26.1739 Y-42.6019
+X-26.0887 Y-42.6542
+X-26.0033 Y-42.7063
+X-25.9179 Y-42.7582
+X-25.8323 Y-42.8099
+X-25.7467 Y-42.8615
+X-25.6609 Y-42.9129
+X-25.5750 Y-42.9641
+X-25.4891 Y-43.0152
+X-25.4030 Y-43.0661
+X-25.3168 Y-43.1168
+X-25.2306 Y-43.1673
+X-25.1442 Y-43.2177
+X-25.0577 Y-43.2679
+X-24.9711 Y-43.3179
+X-24.8845 Y-43.3678
+X-24.7977 Y-43.4174
+X-24.7108 Y-43.4670
+X-24.6238 Y-43.5163
+X-24.5368 Y-43.5654
+X-24.4496 Y-43.6144
+X-24.3623 Y-43.6632
+X-24.2750 Y-43.7119
+X-24.1875 Y-43.7603
+X-24.0999 Y-43.8086
+X-24.0123 Y-43.8567
+X-23.9245 Y-43.9046
+X-23.8367 Y-43.9524
+X-23.7488 Y-44.0000
+X-23.6607 Y-44.0474
+X-23.5726 Y-44.0946
+X-23.4844 Y-44.1416
+X-23.3960 Y-44.1885
+X-23.3076 Y-44.2352
+X-23.2191 Y-44.2817
+X-23.1305 Y-44.3281
+X-23.0418 Y-44.3742
+X-22.9531 Y-44.4202
+X-22.8642 Y-44.4660
+X-22.7752 Y-44.5117
+X-22.6862 Y-44.5571
+X-22.5970 Y-44.6024
+X-22.5078 Y-44.6475
+X-22.4184 Y-44.6924
+X-22.3290 Y-44.7372
+X-22.2395 Y-44.7817
+X-22.1499 Y-44.8261
+X-22.0602 Y-44.8703
+X-21.9705 Y-44.9143
+X-21.8806 Y-44.9582
+X-21.7907 Y-45.0019
+X-21.7006 Y-45.0453
+X-21.6105 Y-45.0886
+X-21.5203 Y-45.1318
+X-21.4300 Y-45.1747
+X-21.3396 Y-45.2175
+X-21.2491 Y-45.2601
+X-21.1586 Y-45.3025
+X-21.0680 Y-45.3447
+X-20.9772 Y-45.3867
+X-20.8864 Y-45.4286
+X-20.7956 Y-45.4703
+X-20.7046 Y-45.5118
+X-20.6135 Y-45.5531
+X-20.5224 Y-45.5942
+X-20.4312 Y-45.6352
+X-20.3399 Y-45.6759
+X-20.2485 Y-45.7165
+X-20.1570 Y-45.7569
+X-20.0655 Y-45.7971
+X-19.9739 Y-45.8372
+X-19.8822 Y-45.8770
+X-19.7904 Y-45.9167
+X-19.6985 Y-45.9562
+X-19.6066 Y-45.9955
+X-19.5146 Y-46.0346
+X-19.4225 Y-46.0735
+X-19.3303 Y-46.1123
+X-19.2380 Y-46.1508
+X-19.1457 Y-46.1892
+X-19.0533 Y-46.2274
+X-18.9608 Y-46.2654
+X-18.8683 Y-46.3032
+X-18.7756 Y-46.3409
+X-18.6829 Y-46.3783
+X-18.5902 Y-46.4156
+X-18.4973 Y-46.4527
+X-18.4044 Y-46.4896
+X-18.3114 Y-46.5263
+X-18.2183 Y-46.5628
+X-18.1251 Y-46.5991
+X-18.0319 Y-46.6353
+X-17.9386 Y-46.6713
+X-17.8453 Y-46.7070
+X-17.7518 Y-46.7426
+X-17.6583 Y-46.7780
+X-17.5647 Y-46.8132
+X-17.4711 Y-46.8483
+X-17.3774 Y-46.8831
+X-17.2836 Y-46.9178
+X-17.1897 Y-46.9522
+X-17.0958 Y-46.9865
+X-17.0018 Y-47.0206
+X-16.9077 Y-47.0545
+X-16.8136 Y-47.0882
+X-16.7194 Y-47.1218
+X-16.6251 Y-47.1551
+X-16.5308 Y-47.1883
+X-16.4364 Y-47.2212
+X-16.3419 Y-47.2540
+X-16.2474 Y-47.2866
+X-16.1528 Y-47.3190
+X-16.0582 Y-47.3512
+X-15.9634 Y-47.3832
+X-15.8687 Y-47.4150
+X-15.7738 Y-47.4467
+X-15.6789 Y-47.4781
+X-15.5839 Y-47.5094
+X-15.4889 Y-47.5405
+X-15.3938 Y-47.5713
+X-15.2986 Y-47.6020
+X-15.2034 Y-47.6325
+X-15.1081 Y-47.6628
+X-15.0128 Y-47.6929
+X-14.9174 Y-47.7229
+X-14.8219 Y-47.7526
+X-14.7264 Y-47.7821
+X-14.6308 Y-47.8115
+X-14.5352 Y-47.8407
+X-14.4395 Y-47.8696
+X-14.3437 Y-47.8984
+X-14.2479 Y-47.9270
+X-14.1520 Y-47.9554
+X-14.0561 Y-47.9836
+X-13.9601 Y-48.0116
+X-13.8641 Y-48.0394
+X-13.7680 Y-48.0671
+X-13.6718 Y-48.0945
+X-13.5756 Y-48.1217
+X-13.4794 Y-48.1488
+X-13.3831 Y-48.1757
+X-13.2867 Y-48.2023
+X-13.1903 Y-48.2288
+X-13.0938 Y-48.2551
+X-12.9973 Y-48.2812
+X-12.9007 Y-48.3071
+X-12.8041 Y-48.3328
+X-12.7074 Y-48.3583
+X-12.6107 Y-48.3836
+X-12.5139 Y-48.4087
+X-12.4171 Y-48.4336
+X-12.3202 Y-48.4584
+X-12.2233 Y-48.4829
+X-12.1263 Y-48.5073
+X-12.0292 Y-48.5314
+X-11.9322 Y-48.5554
+X-11.8351 Y-48.5791
+X-11.7379 Y-48.6027
+X-11.6407 Y-48.6261
+X-11.5434 Y-48.6493
+X-11.4461 Y-48.6722
+X-11.3487 Y-48.6950
+X-11.2513 Y-48.7176
+X-11.1539 Y-48.7400
+X-11.0564 Y-48.7622
+X-10.9589 Y-48.7843
+X-10.8613 Y-48.8061
+X-10.7637 Y-48.8277
+X-10.6660 Y-48.8491
+X-10.5683 Y-48.8703
+X-10.4706 Y-48.8914
+X-10.3728 Y-48.9122
+X-10.2749 Y-48.9329
+X-10.1771 Y-48.9533
+X-10.0791 Y-48.9736
+X-9.9812 Y-48.9936
+X-9.8832 Y-49.0135
+X-9.7852 Y-49.0332
+X-9.6871 Y-49.0526
+X-9.5890 Y-49.0719
+X-9.4908 Y-49.0910
+X-9.3926 Y-49.1099
+X-9.2944 Y-49.1285
+X-9.1961 Y-49.1470
+X-9.0978 Y-49.1653
+X-8.9995 Y-49.1834
+X-8.9011 Y-49.2013
+X-8.8027 Y-49.2190
+X-8.7043 Y-49.2365
+X-8.6058 Y-49.2538
+X-8.5073 Y-49.2709
+X-8.4088 Y-49.2879
+X-8.3102 Y-49.3046
+X-8.2116 Y-49.3211
+X-8.1129 Y-49.3374
+X-8.0142 Y-49.3535
+X-7.9155 Y-49.3695
+X-7.8168 Y-49.3852
+X-7.7180 Y-49.4007
+X-7.6192 Y-49.4161
+X-7.5204 Y-49.4312
+X-7.4215 Y-49.4461
+X-7.3226 Y-49.4609
+X-7.2237 Y-49.4754
+X-7.1247 Y-49.4898
+X-7.0258 Y-49.5039
+X-6.9267 Y-49.5179
+X-6.8277 Y-49.5316
+X-6.7286 Y-49.5452
+X-6.6296 Y-49.5585
+X-6.5304 Y-49.5717
+X-6.4313 Y-49.5847
+X-6.3321 Y-49.5974
+X-6.2329 Y-49.6100
+X-6.1337 Y-49.6223
+X-6.0345 Y-49.6345
+X-5.9352 Y-49.6465
+X-5.8359 Y-49.6583
+X-5.7366 Y-49.6698
+X-5.6373 Y-49.6812
+X-5.5379 Y-49.6924
+X-5.4385 Y-49.7033
+X-5.3391 Y-49.7141
+X-5.2397 Y-49.7247
+X-5.1402 Y-49.7351
+X-5.0408 Y-49.7453
+X-4.9413 Y-49.7552
+X-4.8418 Y-49.7650
+X-4.7422 Y-49.7746
+X-4.6427 Y-49.7840
+X-4.5431 Y-49.7932
+X-4.4436 Y-49.8022
+X-4.3440 Y-49.8109
+X-4.2443 Y-49.8195
+X-4.1447 Y-49.8279
+X-4.0450 Y-49.8361
+X-3.9454 Y-49.8441
+X-3.8457 Y-49.8519
+X-3.7460 Y-49.8595
+X-3.6463 Y-49.8669
+X-3.5466 Y-49.8741
+X-3.4468 Y-49.8811
+X-3.3471 Y-49.8878
+X-3.2473 Y-49.8944
+X-3.1475 Y-49.9008
+X-3.0477 Y-49.9070
+X-2.9479 Y-49.9130
+X-2.8481 Y-49.9188
+X-2.7483 Y-49.9244
+X-2.6484 Y-49.9298
+X-2.5486 Y-49.9350
+X-2.4487 Y-49.9400
+X-2.3488 Y-49.9448
+X-2.2489 Y-49.9494
+X-2.1491 Y-49.9538
+X-2.0492 Y-49.9580
+X-1.9493 Y-49.9620
+X-1.8493 Y-49.9658
+X-1.7494 Y-49.9694
+X-1.6495 Y-49.9728
+X-1.5496 Y-49.9760
+X-1.4496 Y-49.9790
+X-1.3497 Y-49.9818
+X-1.2497 Y-49.9844
+X-1.1497 Y-49.9868
+X-1.0498 Y-49.9890
+X-0.9498 Y-49.9910
+X-0.8498 Y-49.9928
+X-0.7499 Y-49.9944
+X-0.6499 Y-49.9958
+X-0.5499 Y-49.9970
+X-0.4499 Y-49.9980
+X-0.3500 Y-49.9988
+X-0.2500 Y-49.9994
+X-0.1500 Y-49.9998
+X-0.0500 Y-50.0000
+X0.0500 Y-50.0000
+X0.1500 Y-49.9998
+X0.2500 Y-49.9994
+X0.3500 Y-49.9988
+X0.4499 Y-49.9980
+X0.5499 Y-49.9970
+X0.6499 Y-49.9958
+X0.7499 Y-49.9944
+X0.8498 Y-49.9928
+X0.9498 Y-49.9910
+X1.0498 Y-49.9890
+X1.1497 Y-49.9868
+X1.2497 Y-49.9844
+X1.3497 Y-49.9818
+X1.4496 Y-49.9790
+X1.5496 Y-49.9760
+X1.6495 Y-49.9728
+X1.7494 Y-49.9694
+X1.8493 Y-49.9658
+X1.9493 Y-49.9620
+X2.0492 Y-49.9580
+X2.1491 Y-49.9538
+X2.2489 Y-49.9494
+X2.3488 Y-49.9448
+X2.4487 Y-49.9400
+X2.5486 Y-49.9350
+X2.6484 Y-49.9298
+X2.7483 Y-49.9244
+X2.8481 Y-49.9188
+X2.9479 Y-49.9130
+X3.0477 Y-49.9070
+X3.1475 Y-49.9008
+X3.2473 Y-49.8944
+X3.3471 Y-49.8878
+X3.4468 Y-49.8811
+X3.5466 Y-49.8741
+X3.6463 Y-49.8669
+X3.7460 Y-49.8595
+X3.8457 Y-49.8519
+X3.9454 Y-49.8441
+X4.0450 Y-49.8361
+X4.1447 Y-49.8279
+X4.2443 Y-49.8195
+X4.3440 Y-49.8109
+X4.4436 Y-49.8022
+X4.5431 Y-49.7932
+X4.6427 Y-49.7840
+X4.7422 Y-49.7746
+X4.8418 Y-49.7650
+X4.9413 Y-49.7552
+X5.0408 Y-49.7453
+X5.1402 Y-49.7351
+X5.2397 Y-49.7247
+X5.3391 Y-49.7141
+X5.4385 Y-49.7033
+X5.5379 Y-49.6924
+X5.6373 Y-49.6812
+X5.7366 Y-49.6698
+X5.8359 Y-49.6583
+X5.9352 Y-49.6465
+X6.0345 Y-49.6345
+X6.1337 Y-49.6223
+X6.2329 Y-49.6100
+X6.3321 Y-49.5974
+X6.4313 Y-49.5847
+X6.5304 Y-49.5717
+X6.6296 Y-49.5585
+X6.7286 Y-49.5452
+X6.8277 Y-49.5316
+X6.9267 Y-49.5179
+X7.0258 Y-49.5039
+X7.1247 Y-49.4898
+X7.2237 Y-49.4754
+X7.3226 Y-49.4609
+X7.4215 Y-49.4461
+X7.5204 Y-49.4312
+X7.6192 Y-49.4161
+X7.7180 Y-49.4007
+X7.8168 Y-49.3852
+X7.9155 Y-49.3695
+X8.0142 Y-49.3535
+X8.1129 Y-49.3374
+X8.2116 Y-49.3211
+X8.3102 Y-49.3046
+X8.4088 Y-49.2879
+X8.5073 Y-49.2709
+X8.6058 Y-49.2538
+X8.7043 Y-49.2365
+X8.8027 Y-49.2190
+X8.9011 Y-49.2013
+X8.9995 Y-49.1834
+X9.0978 Y-49.1653
+X9.1961 Y-49.1470
+X9.2944 Y-49.1285
+X9.3926 Y-49.1099
+X9.4908 Y-49.0910
+X9.5890 Y-49.0719
+X9.6871 Y-49.0526
+X9.7852 Y-49.0332
+X9.8832 Y-49.0135
+X9.9812 Y-48.9936
+X10.0791 Y-48.9736
+X10.1771 Y-48.9533
+X10.2749 Y-48.9329
+X10.3728 Y-48.9122
+X10.4706 Y-48.8914
+X10.5683 Y-48.8703
+X10.6660 Y-48.8491
+X10.7637 Y-48.8277
+X10.8613 Y-48.8061
+X10.9589 Y-48.7843
+X11.0564 Y-48.7622
+X11.1539 Y-48.7400
+X11.2513 Y-48.7176
+X11.3487 Y-48.6950
+X11.4461 Y-48.6722
+X11.5434 Y-48.6493
+X11.6407 Y-48.6261
+X11.7379 Y-48.6027
+X11.8351 Y-48.5791
+X11.9322 Y-48.5554
+X12.0292 Y-48.5314
+X12.1263 Y-48.5073
+X12.2233 Y-48.4829
+X12.3202 Y-48.4584
+X12.4171 Y-48.4336
+X12.5139 Y-48.4087
+X12.6107 Y-48.3836
+X12.7074 Y-48.3583
+X12.8041 Y-48.3328
+X12.9007 Y-48.3071
+X12.9973 Y-48.2812
+X13.0938 Y-48.2551
+X13.1903 Y-48.2288
+X13.2867 Y-48.2023
+X13.3831 Y-48.1757
+X13.4794 Y-48.1488
+X13.5756 Y-48.1217
+X13.6718 Y-48.0945
+X13.7680 Y-48.0671
+X13.8641 Y-48.0394
+X13.9601 Y-48.0116
+X14.0561 Y-47.9836
+X14.1520 Y-47.9554
+X14.2479 Y-47.9270
+X14.3437 Y-47.8984
+X14.4395 Y-47.8696
+X14.5352 Y-47.8407
+X14.6308 Y-47.8115
+X14.7264 Y-47.7821
+X14.8219 Y-47.7526
+X14.9174 Y-47.7229
+X15.0128 Y-47.6929
+X15.1081 Y-47.6628
+X15.2034 Y-47.6325
+X15.2986 Y-47.6020
+X15.3938 Y-47.5713
+X15.4889 Y-47.5405
+X15.5839 Y-47.5094
+X15.6789 Y-47.4781
+X15.7738 Y-47.4467
+X15.8687 Y-47.4150
+X15.9634 Y-47.3832
+X16.0582 Y-47.3512
+X16.1528 Y-47.3190
+X16.2474 Y-47.2866
+X16.3419 Y-47.2540
+X16.4364 Y-47.2212
+X16.5308 Y-47.1883
+X16.6251 Y-47.1551
+X16.7194 Y-47.1218
+X16.8136 Y-47.0882
+X16.9077 Y-47.0545
+X17.0018 Y-47.0206
+X17.0958 Y-46.9865
+X17.1897 Y-46.9522
+X17.2836 Y-46.9178
+X17.3774 Y-46.8831
+X17.4711 Y-46.8483
+X17.5647 Y-46.8132
+X17.6583 Y-46.7780
+X17.7518 Y-46.7426
+X17.8453 Y-46.7070
+X17.9386 Y-46.6713
+X18.0319 Y-46.6353
+X18.1251 Y-46.5991
+X18.2183 Y-46.5628
+X18.3114 Y-46.5263
+X18.4044 Y-46.4896
+X18.4973 Y-46.4527
+X18.5902 Y-46.4156
+X18.6829 Y-46.3783
+X18.7756 Y-46.3409
+X18.8683 Y-46.3032
+X18.9608 Y-46.2654
+X19.0533 Y-46.2274
+X19.1457 Y-46.1892
+X19.2380 Y-46.1508
+X19.3303 Y-46.1123
+X19.4225 Y-46.0735
+X19.5146 Y-46.0346
+X19.6066 Y-45.9955
+X19.6985 Y-45.9562
+X19.7904 Y-45.9167
+X19.8822 Y-45.8770
+X19.9739 Y-45.8372
+X20.0655 Y-45.7971
+X20.1570 Y-45.7569
+X20.2485 Y-45.7165
+X20.3399 Y-45.6759
+X20.4312 Y-45.6352
+X20.5224 Y-45.5942
+X20.6135 Y-45.5531
+X20.7046 Y-45.5118
+X20.7956 Y-45.4703
+X20.8864 Y-45.4286
+X20.9772 Y-45.3867
+X21.0680 Y-45.3447
+X21.1586 Y-45.3025
+X21.2491 Y-45.2601
+X21.3396 Y-45.2175
+X21.4300 Y-45.1747
+X21.5203 Y-45.1318
+X21.6105 Y-45.0886
+X21.7006 Y-45.0453
+X21.7907 Y-45.0019
+X21.8806 Y-44.9582
+X21.9705 Y-44.9143
+X22.0602 Y-44.8703
+X22.1499 Y-44.8261
+X22.2395 Y-44.7817
+X22.3290 Y-44.7372
+X22.4184 Y-44.6924
+X22.5078 Y-44.6475
+X22.5970 Y-44.6024
+X22.6862 Y-44.5571
+X22.7752 Y-44.5117
+X22.8642 Y-44.4660
+X22.9531 Y-44.4202
+X23.0418 Y-44.3742
+X23.1305 Y-44.3281
+X23.2191 Y-44.2817
+X23.3076 Y-44.2352
+X23.3960 Y-44.1885
+X23.4844 Y-44.1416
+X23.5726 Y-44.0946
+X23.6607 Y-44.0474
+X23.7488 Y-44.0000
+X23.8367 Y-43.9524
+X23.9245 Y-43.9046
+X24.0123 Y-43.8567
+X24.0999 Y-43.8086
+X24.1875 Y-43.7603
+X24.2750 Y-43.7119
+X24.3623 Y-43.6632
+X24.4496 Y-43.6144
+X24.5368 Y-43.5654
+X24.6238 Y-43.5163
+X24.7108 Y-43.4670
+X24.7977 Y-43.4174
+X24.8845 Y-43.3678
+X24.9711 Y-43.3179
+X25.0577 Y-43.2679
+X25.1442 Y-43.2177
+X25.2306 Y-43.1673
+X25.3168 Y-43.1168
+X25.4030 Y-43.0661
+X25.4891 Y-43.0152
+X25.5750 Y-42.9641
+X25.6609 Y-42.9129
+X25.7467 Y-42.8615
+X25.8323 Y-42.8099
+X25.9179 Y-42.7582
+X26.0033 Y-42.7063
+X26.0887 Y-42.6542
+X26.1739 Y-42.6019
+X26.2591 Y-42.5495
+X26.3441 Y-42.4969
+X26.4290 Y-42.4442
+X26.5139 Y-42.3912
+X26.5986 Y-42.3381
+X26.6832 Y-42.2848
+X26.7677 Y-42.2314
+X26.8521 Y-42.1778
+X26.9364 Y-42.1240
+X27.0206 Y-42.0700
+X27.1046 Y-42.0159
+X27.1886 Y-41.9616
+X27.2725 Y-41.9072
+X27.3562 Y-41.8526
+X27.4399 Y-41.7978
+X27.5234 Y-41.7428
+X27.6068 Y-41.6877
+X27.6901 Y-41.6324
+X27.7733 Y-41.5770
+X27.8564 Y-41.5213
+X27.9394 Y-41.4655
+X28.0222 Y-41.4096
+X28.1050 Y-41.3535
+X28.1876 Y-41.2972
+X28.2702 Y-41.2407
+X28.3526 Y-41.1841
+X28.4349 Y-41.1273
+X28.5171 Y-41.0704
+X28.5991 Y-41.0133
+X28.6811 Y-40.9560
+X28.7629 Y-40.8986
+X28.8447 Y-40.8410
+X28.9263 Y-40.7832
+X29.0078 Y-40.7253
+X29.0892 Y-40.6672
+X29.1704 Y-40.6089
+X29.2516 Y-40.5505
+X29.3326 Y-40.4919
+X29.4135 Y-40.4332
+X29.4943 Y-40.3743
+X29.5750 Y-40.3152
+X29.6556 Y-40.2560
+X29.7360 Y-40.1966
+X29.8163 Y-40.1371
+X29.8965 Y-40.0774
+X29.9766 Y-40.0175
+X30.0566 Y-39.9575
+X30.1364 Y-39.8973
+X30.2161 Y-39.8370
+X30.2958 Y-39.7765
+X30.3752 Y-39.7158
+X30.4546 Y-39.6550
+X30.5338 Y-39.5940
+X30.6130 Y-39.5329
+X30.6919 Y-39.4716
+X30.7708 Y-39.4101
+X30.8496 Y-39.3485
+X30.9282 Y-39.2867
+X31.0067 Y-39.2248
+X31.0851 Y-39.1627
+X31.1633 Y-39.1005
+X31.2414 Y-39.0381
+X31.3195 Y-38.9755
+X31.3973 Y-38.9128
+X31.4751 Y-38.8500
+X31.5527 Y-38.7869
+X31.6302 Y-38.7238
+X31.7076 Y-38.6604
+X31.7848 Y-38.5969
+X31.8620 Y-38.5333
+X31.9389 Y-38.4695
+X32.0158 Y-38.4056
+X32.0925 Y-38.3415
+X32.1692 Y-38.2772
+X32.2456 Y-38.2128
+X32.3220 Y-38.1483
+X32.3982 Y-38.0835
+X32.4743 Y-38.0187
+X32.5503 Y-37.9537
+X32.6261 Y-37.8885
+X32.7018 Y-37.8232
+X32.7774 Y-37.7577
+X32.8528 Y-37.6921
+X32.9281 Y-37.6263
+X33.0033 Y-37.5604
+X33.0783 Y-37.4943
+X33.1533 Y-37.4281
+X33.2280 Y-37.3617
+X33.3027 Y-37.2952
+X33.3772 Y-37.2285
+X33.4516 Y-37.1617
+X33.5258 Y-37.0947
+X33.5999 Y-37.0276
+X33.6739 Y-36.9604
+X33.7478 Y-36.8929
+X33.8215 Y-36.8254
+X33.8950 Y-36.7577
+X33.9685 Y-36.6898
+X34.0418 Y-36.6218
+X34.1149 Y-36.5537
+X34.1880 Y-36.4854
+X34.2609 Y-36.4169
+X34.3336 Y-36.3483
+X34.4062 Y-36.2796
+X34.4787 Y-36.2107
+X34.5511 Y-36.1417
+X34.6233 Y-36.0726
+X34.6953 Y-36.0032
+X34.7673 Y-35.9338
+X34.8391 Y-35.8642
+X34.9107 Y-35.7945
+X34.9822 Y-35.7246
+X35.0536 Y-35.6545
+X35.1248 Y-35.5844
+X35.1959 Y-35.5141
+X35.2669 Y-35.4436
+X35.3377 Y-35.3730
+X35.4083 Y-35.3023
+X35.4788 Y-35.2314
+X35.5492 Y-35.1604
+X35.6195 Y-35.0892
+X35.6896 Y-35.0179
+X35.7595 Y-34.9465
+X35.8293 Y-34.8749
+X35.8990 Y-34.8032
+X35.9685 Y-34.7313
+X36.0379 Y-34.6593
+X36.1072 Y-34.5872
+X36.1762 Y-34.5149
+X36.2452 Y-34.4425
+X36.3140 Y-34.3700
+X36.3827 Y-34.2973
+X36.4512 Y-34.2244
+X36.5195 Y-34.1515
+X36.5878 Y-34.0784
+X36.6558 Y-34.0051
+X36.7238 Y-33.9318
+X36.7915 Y-33.8583
+X36.8592 Y-33.7846
+X36.9267 Y-33.7109
+X36.9940 Y-33.6369
+X37.0612 Y-33.5629
+X37.1282 Y-33.4887
+X37.1951 Y-33.4144
+X37.2619 Y-33.3400
+X37.3285 Y-33.2654
+X37.3949 Y-33.1907
+X37.4612 Y-33.1158
+X37.5274 Y-33.0408
+X37.5934 Y-32.9657
+X37.6592 Y-32.8905
+X37.7249 Y-32.8151
+X37.7905 Y-32.7396
+X37.8558 Y-32.6640
+X37.9211 Y-32.5882
+X37.9862 Y-32.5123
+X38.0511 Y-32.4363
+X38.1159 Y-32.3601
+X38.1805 Y-32.2838
+X38.2450 Y-32.2074
+X38.3094 Y-32.1309
+X38.3735 Y-32.0542
+X38.4376 Y-31.9774
+X38.5014 Y-31.9005
+X38.5651 Y-31.8234
+X38.6287 Y-31.7462
+X38.6921 Y-31.6689
+X38.7554 Y-31.5915
+X38.8185 Y-31.5139
+X38.8814 Y-31.4362
+X38.9442 Y-31.3584
+X39.0068 Y-31.2805
+X39.0693 Y-31.2024
+X39.1316 Y-31.1242
+X39.1938 Y-31.0459
+X39.2558 Y-30.9675
+X39.3176 Y-30.8889
+X39.3793 Y-30.8102
+X39.4409 Y-30.7314
+X39.5022 Y-30.6525
+X39.5635 Y-30.5734
+X39.6245 Y-30.4942
+X39.6854 Y-30.4149
+X39.7462 Y-30.3355
+X39.8067 Y-30.2560
+X39.8672 Y-30.1763
+X39.9274 Y-30.0965
+X39.9875 Y-30.0166
+X40.0475 Y-29.9366
+X40.1073 Y-29.8564
+X40.1669 Y-29.7762
+X40.2264 Y-29.6958
+X40.2857 Y-29.6153
+X40.3448 Y-29.5347
+X40.4038 Y-29.4539
+X40.4626 Y-29.3731
+X40.5213 Y-29.2921
+X40.5798 Y-29.2110
+X40.6381 Y-29.1298
+X40.6963 Y-29.0485
+X40.7543 Y-28.9670
+X40.8121 Y-28.8855
+X40.8698 Y-28.8038
+X40.9273 Y-28.7220
+X40.9847 Y-28.6401
+X41.0419 Y-28.5581
+X41.0989 Y-28.4760
+X41.1557 Y-28.3937
+X41.2124 Y-28.3114
+X41.2690 Y-28.2289
+X41.3253 Y-28.1463
+X41.3815 Y-28.0636
+X41.4376 Y-27.9808
+X41.4935 Y-27.8979
+X41.5492 Y-27.8149
+X41.6047 Y-27.7317
+X41.6601 Y-27.6485
+X41.7153 Y-27.5651
+X41.7703 Y-27.4816
+X41.8252 Y-27.3981
+X41.8799 Y-27.3144
+X41.9344 Y-27.2306
+X41.9888 Y-27.1466
+X42.0430 Y-27.0626
+X42.0970 Y-26.9785
+X42.1509 Y-26.8943
+X42.2046 Y-26.8099
+X42.2581 Y-26.7255
+X42.3115 Y-26.6409
+X42.3647 Y-26.5562
+X42.4177 Y-26.4715
+X42.4706 Y-26.3866
+X42.5232 Y-26.3016
+X42.5757 Y-26.2165
+X42.6281 Y-26.1313
+X42.6803 Y-26.0460
+X42.7323 Y-25.9606
+X42.7841 Y-25.8751
+X42.8357 Y-25.7895
+X42.8872 Y-25.7038
+X42.9385 Y-25.6180
+X42.9897 Y-25.5321
+X43.0407 Y-25.4460
+X43.0915 Y-25.3599
+X43.1421 Y-25.2737
+X43.1925 Y-25.1874
+X43.2428 Y-25.1010
+X43.2929 Y-25.0144
+X43.3429 Y-24.9278
+X43.3926 Y-24.8411
+X43.4422 Y-24.7543
+X43.4916 Y-24.6673
+X43.5409 Y-24.5803
+X43.5899 Y-24.4932
+X43.6388 Y-24.4060
+X43.6876 Y-24.3187
+X43.7361 Y-24.2312
+X43.7845 Y-24.1437
+X43.8327 Y-24.0561
+X43.8807 Y-23.9684
+X43.9285 Y-23.8806
+X43.9762 Y-23.7927
+X44.0237 Y-23.7048
+X44.0710 Y-23.6167
+X44.1181 Y-23.5285
+X44.1651 Y-23.4402
+X44.2119 Y-23.3519
+X44.2585 Y-23.2634
+X44.3049 Y-23.1748
+X44.3512 Y-23.0862
+X44.3973 Y-22.9975
+X44.4432 Y-22.9086
+X44.4889 Y-22.8197
+X44.5344 Y-22.7307
+X44.5798 Y-22.6416
+X44.6250 Y-22.5524
+X44.6700 Y-22.4631
+X44.7148 Y-22.3737
+X44.7595 Y-22.2843
+X44.8039 Y-22.1947
+X44.8482 Y-22.1051
+X44.8924 Y-22.0154
+X44.9363 Y-21.9255
+X44.9800 Y-21.8356
+X45.0236 Y-21.7457
+X45.0670 Y-21.6556
+X45.1102 Y-21.5654
+X45.1533 Y-21.4752
+X45.1961 Y-21.3848
+X45.2388 Y-21.2944
+X45.2813 Y-21.2039
+X45.3236 Y-21.1133
+X45.3657 Y-21.0226
+X45.4077 Y-20.9319
+X45.4494 Y-20.8410
+X45.4910 Y-20.7501
+X45.5324 Y-20.6591
+X45.5737 Y-20.5680
+X45.6147 Y-20.4768
+X45.6556 Y-20.3855
+X45.6962 Y-20.2942
+X45.7367 Y-20.2028
+X45.7770 Y-20.1113
+X45.8172 Y-20.0197
+X45.8571 Y-19.9280
+X45.8969 Y-19.8363
+X45.9364 Y-19.7445
+X45.9758 Y-19.6526
+X46.0150 Y-19.5606
+X46.0541 Y-19.4685
+X46.0929 Y-19.3764
+X46.1316 Y-19.2842
+X46.1700 Y-19.1919
+X46.2083 Y-19.0995
+X46.2464 Y-19.0071
+X46.2843 Y-18.9146
+X46.3221 Y-18.8220
+X46.3596 Y-18.7293
+X46.3970 Y-18.6366
+X46.4341 Y-18.5437
+X46.4711 Y-18.4508
+X46.5079 Y-18.3579
+X46.5446 Y-18.2648
+X46.5810 Y-18.1717
+X46.6172 Y-18.0785
+X46.6533 Y-17.9853
+X46.6892 Y-17.8919
+X46.7249 Y-17.7985
+X46.7604 Y-17.7051
+X46.7957 Y-17.6115
+X46.8308 Y-17.5179
+X46.8657 Y-17.4242
+X46.9005 Y-17.3305
+X46.9350 Y-17.2367
+X46.9694 Y-17.1428
+X47.0036 Y-17.0488
+X47.0376 Y-16.9548
+X47.0714 Y-16.8607
+X47.1050 Y-16.7665
+X47.1385 Y-16.6723
+X47.1717 Y-16.5780
+X47.2048 Y-16.4836
+X47.2376 Y-16.3892
+X47.2703 Y-16.2947
+X47.3028 Y-16.2001
+X47.3351 Y-16.1055
+X47.3672 Y-16.0108
+X47.3991 Y-15.9161
+X47.4309 Y-15.8212
+X47.4624 Y-15.7264
+X47.4938 Y-15.6314
+X47.5249 Y-15.5364
+X47.5559 Y-15.4413
+X47.5867 Y-15.3462
+X47.6173 Y-15.2510
+X47.6477 Y-15.1558
+X47.6779 Y-15.0605
+X47.7079 Y-14.9651
+X47.7378 Y-14.8696
+X47.7674 Y-14.7742
+X47.7968 Y-14.6786
+X47.8261 Y-14.5830
+X47.8552 Y-14.4873
+X47.8840 Y-14.3916
+X47.9127 Y-14.2958
+X47.9412 Y-14.2000
+X47.9695 Y-14.1041
+X47.9976 Y-14.0081
+X48.0255 Y-13.9121
+X48.0533 Y-13.8160
+X48.0808 Y-13.7199
+X48.1081 Y-13.6237
+X48.1353 Y-13.5275
+X48.1622 Y-13.4312
+X48.1890 Y-13.3349
+X48.2156 Y-13.2385
+X48.2420 Y-13.1420
+X48.2681 Y-13.0456
+X48.2941 Y-12.9490
+X48.3199 Y-12.8524
+X48.3455 Y-12.7557
+X48.3709 Y-12.6590
+X48.3962 Y-12.5623
+X48.4212 Y-12.4655
+X48.4460 Y-12.3686
+X48.4707 Y-12.2717
+X48.4951 Y-12.1748
+X48.5194 Y-12.0778
+X48.5434 Y-11.9807
+X48.5673 Y-11.8836
+X48.5909 Y-11.7865
+X48.6144 Y-11.6893
+X48.6377 Y-11.5920
+X48.6608 Y-11.4948
+X48.6837 Y-11.3974
+X48.7064 Y-11.3000
+X48.7289 Y-11.2026
+X48.7512 Y-11.1052
+X48.7733 Y-11.0076
+X48.7952 Y-10.9101
+X48.8169 Y-10.8125
+X48.8384 Y-10.7148
+X48.8598 Y-10.6172
+X48.8809 Y-10.5194
+X48.9018 Y-10.4217
+X48.9226 Y-10.3239
+X48.9431 Y-10.2260
+X48.9635 Y-10.1281
+X48.9836 Y-10.0302
+X49.0036 Y-9.9322
+X49.0234 Y-9.8342
+X49.0429 Y-9.7361
+X49.0623 Y-9.6380
+X49.0815 Y-9.5399
+X49.1004 Y-9.4417
+X49.1192 Y-9.3435
+X49.1378 Y-9.2453
+X49.1562 Y-9.1470
+X49.1744 Y-9.0487
+X49.1924 Y-8.9503
+X49.2102 Y-8.8519
+X49.2278 Y-8.7535
+X49.2452 Y-8.6551
+X49.2624 Y-8.5566
+X49.2794 Y-8.4580
+X49.2962 Y-8.3595
+X49.3129 Y-8.2609
+X49.3293 Y-8.1622
+X49.3455 Y-8.0636
+X49.3615 Y-7.9649
+X49.3774 Y-7.8662
+X49.3930 Y-7.7674
+X49.4084 Y-7.6686
+X49.4237 Y-7.5698
+X49.4387 Y-7.4709
+X49.4535 Y-7.3721
+X49.4682 Y-7.2732
+X49.4826 Y-7.1742
+X49.4969 Y-7.0753
+X49.5109 Y-6.9763
+X49.5248 Y-6.8772
+X49.5384 Y-6.7782
+X49.5519 Y-6.6791
+X49.5651 Y-6.5800
+X49.5782 Y-6.4809
+X49.5911 Y-6.3817
+X49.6037 Y-6.2825
+X49.6162 Y-6.1833
+X49.6285 Y-6.0841
+X49.6405 Y-5.9848
+X49.6524 Y-5.8856
+X49.6641 Y-5.7863
+X49.6755 Y-5.6869
+X49.6868 Y-5.5876
+X49.6979 Y-5.4882
+X49.7088 Y-5.3888
+X49.7194 Y-5.2894
+X49.7299 Y-5.1900
+X49.7402 Y-5.0905
+X49.7503 Y-4.9910
+X49.7602 Y-4.8915
+X49.7698 Y-4.7920
+X49.7793 Y-4.6925
+X49.7886 Y-4.5929
+X49.7977 Y-4.4933
+X49.8066 Y-4.3938
+X49.8153 Y-4.2941
+X49.8237 Y-4.1945
+X49.8320 Y-4.0949
+X49.8401 Y-3.9952
+X49.8480 Y-3.8955
+X49.8557 Y-3.7959
+X49.8632 Y-3.6961
+X49.8705 Y-3.5964
+X49.8776 Y-3.4967
+X49.8845 Y-3.3969
+X49.8912 Y-3.2972
+X49.8977 Y-3.1974
+X49.9040 Y-3.0976
+X49.9101 Y-2.9978
+X49.9159 Y-2.8980
+X49.9216 Y-2.7982
+X49.9271 Y-2.6983
+X49.9324 Y-2.5985
+X49.9375 Y-2.4986
+X49.9424 Y-2.3988
+X49.9471 Y-2.2989
+X49.9516 Y-2.1990
+X49.9559 Y-2.0991
+X49.9600 Y-1.9992
+X49.9639 Y-1.8993
+X49.9676 Y-1.7994
+X49.9711 Y-1.6995
+X49.9744 Y-1.5995
+X49.9775 Y-1.4996
+X49.9804 Y-1.3996
+X49.9831 Y-1.2997
+X49.9856 Y-1.1997
+X49.9879 Y-1.0998
+X49.9900 Y-0.9998
+X49.9919 Y-0.8998
+X49.9936 Y-0.7999
+X49.9951 Y-0.6999
+X49.9964 Y-0.5999
+X49.9975 Y-0.4999
+X49.9984 Y-0.3999
+X49.9991 Y-0.3000
+X49.9996 Y-0.2000
+X49.9999 Y-0.1000
+X50.0000 Y-0.0000
@@ -0,0 +1,99 @@
+; A star of 93 straight lines about 58 mm long, within 30 mm of the origin, at
+; 3000 mm/min. Each line is one move, which machines with kinematics split
+; into many short segments in motor space.
+G21 G90 G94
+G0 X30.0000 Y0
+G1 F3000
+X-26.2304 Y14.5591
+X15.8689 Y-25.4593
+X-1.5195 Y29.9615
+X-13.2118 Y-26.9341
+X24.6229 Y17.1380
+X-29.8461 Y-3.0350
+X27.5687 Y-11.8307
+X-18.3632 Y23.7233
+X4.5428 Y-29.6540
+X10.4192 Y28.1326
+X-22.7627 Y-19.5412
+X29.3859 Y6.0390
+X-28.6242 Y8.9809
+X20.6690 Y-21.7438
+X-7.5196 Y29.0423
+X-7.5196 Y-29.0423
+X20.6690 Y21.7438
+X-28.6242 Y-8.9809
+X29.3859 Y-6.0390
+X-22.7627 Y19.5412
+X10.4192 Y-28.1326
+X4.5428 Y29.6540
+X-18.3632 Y-23.7233
+X27.5687 Y11.8307
+X-29.8461 Y3.0350
+X24.6229 Y-17.1380
+X-13.2118 Y26.9341
+X-1.5195 Y-29.9615
+X15.8689 Y25.4593
+X-26.2304 Y-14.5591
+X30.0000 Y0.0000
+X-26.2304 Y14.5591
+X15.8689 Y-25.4593
+X-1.5195 Y29.9615
+X-13.2118 Y-26.9341
+X24.6229 Y17.1380
+X-29.8461 Y-3.0350
+X27.5687 Y-11.8307
+X-18.3632 Y23.7233
+X4.5428 Y-29.6540
+X10.4192 Y28.1326
+X-22.7627 Y-19.5412
+X29.3859 Y6.0390
+X-28.6242 Y8.9809
+X20.6690 Y-21.7438
+X-7.5196 Y29.0423
+X-7.5196 Y-29.0423
+X20.6690 Y21.7438
+X-28.6242 Y-8.9809
+X29.3859 Y-6.0390
+X-22.7627 Y19.5412
+X10.4192 Y-28.1326
+X4.5428 Y29.6540
+X-18.3632 Y-23.7233
+X27.5687 Y11.8307
+X-29.8461 Y3.0350
+X24.6229 Y-17.1380
+X-13.2118 Y26.9341
+X-1.5195 Y-29.9615
+X15.8689 Y25.4593
+X-26.2304 Y-14.5591
+X30.0000 Y0.0000
+X-26.2304 Y14.5591
+X15.8689 Y-25.4593
+X-1.5195 Y29.9615
+X-13.2118 Y-26.9341
+X24.6229 Y17.1380
+X-29.8461 Y-3.0350
+X27.5687 Y-11.8307
+X-18.3632 Y23.7233
+X4.5428 Y-29.6540
+X10.4192 Y28.1326
+X-22.7627 Y-19.5412
+X29.3859 Y6.0390
+X-28.6242 Y8.9809
+X20.6690 Y-21.7438
+X-7.5196 Y29.0423
+X-7.5196 Y-29.0423
+X20.6690 Y21.7438
+X-28.6242 Y-8.9809
+X29.3859 Y-6.0390
+X-22.7627 Y19.5412
+X10.4192 Y-28.1326
+X4.5428 Y29.6540
+X-18.3632 Y-23.7233
+X27.5687 Y11.8307
+X-29.8461 Y3.0350
+X24.6229 Y-17.1380
+X-13.2118 Y26.9341
+X-1.5195 Y-29.9615
+X15.8689 Y25.4593
+X-26.2304 Y-14.5591
+X30.0000 Y0.0000
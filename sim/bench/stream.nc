@@ -0,0 +1,4 @@
+; Streamed status reports: Grbl sends a report to this client 20 times a
+; second of machine time, with the fields of $10, without being polled. The
+; stream holds for the files that follow.
+$RS=20
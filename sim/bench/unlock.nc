@@ -0,0 +1,4 @@
+$X
+; Clears the alarm that a machine which homes starts in, so that the next
+; file can run without homing. Comments come after it, as in alarm they are
+; refused like any other line.
@@ -0,0 +1,4047 @@
+; A zigzag of 1.5 mm lines turning 90 degrees at every vertex, 40 rows of 100
+; lines at 6000 mm/min, like CAM output of a finishing pass. In the default
+; exact path mode (G61) the junctions limit the feed here.
+G21 G90 G94
+G0 X0 Y0
+G1 F6000
+X1.0607 Y1.0607
+X2.1213 Y0.0000
+X3.1820 Y1.0607
+X4.2426 Y0.0000
+X5.3033 Y1.0607
+X6.3640 Y0.0000
+X7.4246 Y1.0607
+X8.4853 Y0.0000
+X9.5459 Y1.0607
+X10.6066 Y0.0000
+X11.6673 Y1.0607
+X12.7279 Y0.0000
+X13.7886 Y1.0607
+X14.8492 Y0.0000
+X15.9099 Y1.0607
+X16.9706 Y0.0000
+X18.0312 Y1.0607
+X19.0919 Y0.0000
+X20.1525 Y1.0607
+X21.2132 Y0.0000
+X22.2739 Y1.0607
+X23.3345 Y0.0000
+X24.3952 Y1.0607
+X25.4558 Y0.0000
+X26.5165 Y1.0607
+X27.5772 Y0.0000
+X28.6378 Y1.0607
+X29.6985 Y0.0000
+X30.7591 Y1.0607
+X31.8198 Y0.0000
+X32.8805 Y1.0607
+X33.9411 Y0.0000
+X35.0018 Y1.0607
+X36.0624 Y0.0000
+X37.1231 Y1.0607
+X38.1838 Y0.0000
+X39.2444 Y1.0607
+X40.3051 Y0.0000
+X41.3657 Y1.0607
+X42.4264 Y0.0000
+X43.4871 Y1.0607
+X44.5477 Y0.0000
+X45.6084 Y1.0607
+X46.6690 Y0.0000
+X47.7297 Y1.0607
+X48.7904 Y0.0000
+X49.8510 Y1.0607
+X50.9117 Y0.0000
+X51.9723 Y1.0607
+X53.0330 Y0.0000
+X54.0937 Y1.0607
+X55.1543 Y0.0000
+X56.2150 Y1.0607
+X57.2756 Y0.0000
+X58.3363 Y1.0607
+X59.3970 Y0.0000
+X60.4576 Y1.0607
+X61.5183 Y0.0000
+X62.5790 Y1.0607
+X63.6396 Y0.0000
+X64.7003 Y1.0607
+X65.7609 Y0.0000
+X66.8216 Y1.0607
+X67.8823 Y0.0000
+X68.9429 Y1.0607
+X70.0036 Y0.0000
+X71.0642 Y1.0607
+X72.1249 Y0.0000
+X73.1856 Y1.0607
+X74.2462 Y0.0000
+X75.3069 Y1.0607
+X76.3675 Y0.0000
+X77.4282 Y1.0607
+X78.4889 Y0.0000
+X79.5495 Y1.0607
+X80.6102 Y0.0000
+X81.6708 Y1.0607
+X82.7315 Y0.0000
+X83.7922 Y1.0607
+X84.8528 Y0.0000
+X85.9135 Y1.0607
+X86.9741 Y0.0000
+X88.0348 Y1.0607
+X89.0955 Y0.0000
+X90.1561 Y1.0607
+X91.2168 Y0.0000
+X92.2774 Y1.0607
+X93.3381 Y0.0000
+X94.3988 Y1.0607
+X95.4594 Y0.0000
+X96.5201 Y1.0607
+X97.5807 Y0.0000
+X98.6414 Y1.0607
+X99.7021 Y0.0000
+X100.7627 Y1.0607
+X101.8234 Y0.0000
+X102.8840 Y1.0607
+X103.9447 Y0.0000
+X105.0054 Y1.0607
+X106.0660 Y0.0000
+Y2.0000
+X105.0054 Y3.0607
+X103.9447 Y2.0000
+X102.8840 Y3.0607
+X101.8234 Y2.0000
+X100.7627 Y3.0607
+X99.7021 Y2.0000
+X98.6414 Y3.0607
+X97.5807 Y2.0000
+X96.5201 Y3.0607
+X95.4594 Y2.0000
+X94.3988 Y3.0607
+X93.3381 Y2.0000
+X92.2774 Y3.0607
+X91.2168 Y2.0000
+X90.1561 Y3.0607
+X89.0955 Y2.0000
+X88.0348 Y3.0607
+X86.9741 Y2.0000
+X85.9135 Y3.0607
+X84.8528 Y2.0000
+X83.7922 Y3.0607
+X82.7315 Y2.0000
+X81.6708 Y3.0607
+X80.6102 Y2.0000
+X79.5495 Y3.0607
+X78.4889 Y2.0000
+X77.4282 Y3.0607
+X76.3675 Y2.0000
+X75.3069 Y3.0607
+X74.2462 Y2.0000
+X73.1856 Y3.0607
+X72.1249 Y2.0000
+X71.0642 Y3.0607
+X70.0036 Y2.0000
+X68.9429 Y3.0607
+X67.8823 Y2.0000
+X66.8216 Y3.0607
+X65.7609 Y2.0000
+X64.7003 Y3.0607
+X63.6396 Y2.0000
+X62.5790 Y3.0607
+X61.5183 Y2.0000
+X60.4576 Y3.0607
+X59.3970 Y2.0000
+X58.3363 Y3.0607
+X57.2756 Y2.0000
+X56.2150 Y3.0607
+X55.1543 Y2.0000
+X54.0937 Y3.0607
+X53.0330 Y2.0000
+X51.9723 Y3.0607
+X50.9117 Y2.0000
+X49.8510 Y3.0607
+X48.7904 Y2.0000
+X47.7297 Y3.0607
+X46.6690 Y2.0000
+X45.6084 Y3.0607
+X44.5477 Y2.0000
+X43.4871 Y3.0607
+X42.4264 Y2.0000
+X41.3657 Y3.0607
+X40.3051 Y2.0000
+X39.2444 Y3.0607
+X38.1838 Y2.0000
+X37.1231 Y3.0607
+X36.0624 Y2.0000
+X35.0018 Y3.0607
+X33.9411 Y2.0000
+X32.8805 Y3.0607
+X31.8198 Y2.0000
+X30.7591 Y3.0607
+X29.6985 Y2.0000
+X28.6378 Y3.0607
+X27.5772 Y2.0000
+X26.5165 Y3.0607
+X25.4558 Y2.0000
+X24.3952 Y3.0607
+X23.3345 Y2.0000
+X22.2739 Y3.0607
+X21.2132 Y2.0000
+X20.1525 Y3.0607
+X19.0919 Y2.0000
+X18.0312 Y3.0607
+X16.9706 Y2.0000
+X15.9099 Y3.0607
+X14.8492 Y2.0000
+X13.7886 Y3.0607
+X12.7279 Y2.0000
+X11.6673 Y3.0607
+X10.6066 Y2.0000
+X9.5459 Y3.0607
+X8.4853 Y2.0000
+X7.4246 Y3.0607
+X6.3640 Y2.0000
+X5.3033 Y3.0607
+X4.2426 Y2.0000
+X3.1820 Y3.0607
+X2.1213 Y2.0000
+X1.0607 Y3.0607
+X0.0000 Y2.0000
+Y4.0000
+X1.0607 Y5.0607
+X2.1213 Y4.0000
+X3.1820 Y5.0607
+X4.2426 Y4.0000
+X5.3033 Y5.0607
+X6.3640 Y4.0000
+X7.4246 Y5.0607
+X8.4853 Y4.0000
+X9.5459 Y5.0607
+X10.6066 Y4.0000
+X11.6673 Y5.0607
+X12.7279 Y4.0000
+X13.7886 Y5.0607
+X14.8492 Y4.0000
+X15.9099 Y5.0607
+X16.9706 Y4.0000
+X18.0312 Y5.0607
+X19.0919 Y4.0000
+X20.1525 Y5.0607
+X21.2132 Y4.0000
+X22.2739 Y5.0607
+X23.3345 Y4.0000
+X24.3952 Y5.0607
+X25.4558 Y4.0000
+X26.5165 Y5.0607
+X27.5772 Y4.0000
+X28.6378 Y5.0607
+X29.6985 Y4.0000
+X30.7591 Y5.0607
+X31.8198 Y4.0000
+X32.8805 Y5.0607
+X33.9411 Y4.0000
+X35.0018 Y5.0607
+X36.0624 Y4.0000
+X37.1231 Y5.0607
+X38.1838 Y4.0000
+X39.2444 Y5.0607
+X40.3051 Y4.0000
+X41.3657 Y5.0607
+X42.4264 Y4.0000
+X43.4871 Y5.0607
+X44.5477 Y4.0000
+X45.6084 Y5.0607
+X46.6690 Y4.0000
+X47.7297 Y5.0607
+X48.7904 Y4.0000
+X49.8510 Y5.0607
+X50.9117 Y4.0000
+X51.9723 Y5.0607
+X53.0330 Y4.0000
+X54.0937 Y5.0607
+X55.1543 Y4.0000
+X56.2150 Y5.0607
+X57.2756 Y4.0000
+X58.3363 Y5.0607
+X59.3970 Y4.0000
+X60.4576 Y5.0607
+X61.5183 Y4.0000
+X62.5790 Y5.0607
+X63.6396 Y4.0000
+X64.7003 Y5.0607
+X65.7609 Y4.0000
+X66.8216 Y5.0607
+X67.8823 Y4.0000
+X68.9429 Y5.0607
+X70.0036 Y4.0000
+X71.0642 Y5.0607
+X72.1249 Y4.0000
+X73.1856 Y5.0607
+X74.2462 Y4.0000
+X75.3069 Y5.0607
+X76.3675 Y4.0000
+X77.4282 Y5.0607
+X78.4889 Y4.0000
+X79.5495 Y5.0607
+X80.6102 Y4.0000
+X81.6708 Y5.0607
+X82.7315 Y4.0000
+X83.7922 Y5.0607
+X84.8528 Y4.0000
+X85.9135 Y5.0607
+X86.9741 Y4.0000
+X88.0348 Y5.0607
+X89.0955 Y4.0000
+X90.1561 Y5.0607
+X91.2168 Y4.0000
+X92.2774 Y5.0607
+X93.3381 Y4.0000
+X94.3988 Y5.0607
+X95.4594 Y4.0000
+X96.5201 Y5.0607
+X97.5807 Y4.0000
+X98.6414 Y5.0607
+X99.7021 Y4.0000
+X100.7627 Y5.0607
+X101.8234 Y4.0000
+X102.8840 Y5.0607
+X103.9447 Y4.0000
+X105.0054 Y5.0607
+X106.0660 Y4.0000
+Y6.0000
+X105.0054 Y7.0607
+X103.9447 Y6.0000
+X102.8840 Y7.0607
+X101.8234 Y6.0000
+X100.7627 Y7.0607
+X99.7021 Y6.0000
+X98.6414 Y7.0607
+X97.5807 Y6.0000
+X96.5201 Y7.0607
+X95.4594 Y6.0000
+X94.3988 Y7.0607
+X93.3381 Y6.0000
+X92.2774 Y7.0607
+X91.2168 Y6.0000
+X90.1561 Y7.0607
+X89.0955 Y6.0000
+X88.0348 Y7.0607
+X86.9741 Y6.0000
+X85.9135 Y7.0607
+X84.8528 Y6.0000
+X83.7922 Y7.0607
+X82.7315 Y6.0000
+X81.6708 Y7.0607
+X80.6102 Y6.0000
+X79.5495 Y7.0607
+X78.4889 Y6.0000
+X77.4282 Y7.0607
+X76.3675 Y6.0000
+X75.3069 Y7.0607
+X74.2462 Y6.0000
+X73.1856 Y7.0607
+X72.1249 Y6.0000
+X71.0642 Y7.0607
+X70.0036 Y6.0000
+X68.9429 Y7.0607
+X67.8823 Y6.0000
+X66.8216 Y7.0607
+X65.7609 Y6.0000
+X64.7003 Y7.0607
+X63.6396 Y6.0000
+X62.5790 Y7.0607
+X61.5183 Y6.0000
+X60.4576 Y7.0607
+X59.3970 Y6.0000
+X58.3363 Y7.0607
+X57.2756 Y6.0000
+X56.2150 Y7.0607
+X55.1543 Y6.0000
+X54.0937 Y7.0607
+X53.0330 Y6.0000
+X51.9723 Y7.0607
+X50.9117 Y6.0000
+X49.8510 Y7.0607
+X48.7904 Y6.0000
+X47.7297 Y7.0607
+X46.6690 Y6.0000
+X45.6084 Y7.0607
+X44.5477 Y6.0000
+X43.4871 Y7.0607
+X42.4264 Y6.0000
+X41.3657 Y7.0607
+X40.3051 Y6.0000
+X39.2444 Y7.0607
+X38.1838 Y6.0000
+X37.1231 Y7.0607
+X36.0624 Y6.0000
+X35.0018 Y7.0607
+X33.9411 Y6.0000
+X32.8805 Y7.0607
+X31.8198 Y6.0000
+X30.7591 Y7.0607
+X29.6985 Y6.0000
+X28.6378 Y7.0607
+X27.5772 Y6.0000
+X26.5165 Y7.0607
+X25.4558 Y6.0000
+X24.3952 Y7.0607
+X23.3345 Y6.0000
+X22.2739 Y7.0607
+X21.2132 Y6.0000
+X20.1525 Y7.0607
+X19.0919 Y6.0000
+X18.0312 Y7.0607
+X16.9706 Y6.0000
+X15.9099 Y7.0607
+X14.8492 Y6.0000
+X13.7886 Y7.0607
+X12.7279 Y6.0000
+X11.6673 Y7.0607
+X10.6066 Y6.0000
+X9.5459 Y7.0607
+X8.4853 Y6.0000
+X7.4246 Y7.0607
+X6.3640 Y6.0000
+X5.3033 Y7.0607
+X4.2426 Y6.0000
+X3.1820 Y7.0607
+X2.1213 Y6.0000
+X1.0607 Y7.0607
+X0.0000 Y6.0000
+Y8.0000
+X1.0607 Y9.0607
+X2.1213 Y8.0000
+X3.1820 Y9.0607
+X4.2426 Y8.0000
+X5.3033 Y9.0607
+X6.3640 Y8.0000
+X7.4246 Y9.0607
+X8.4853 Y8.0000
+X9.5459 Y9.0607
+X10.6066 Y8.0000
+X11.6673 Y9.0607
+X12.7279 Y8.0000
+X13.7886 Y9.0607
+X14.8492 Y8.0000
+X15.9099 Y9.0607
+X16.9706 Y8.0000
+X18.0312 Y9.0607
+X19.0919 Y8.0000
+X20.1525 Y9.0607
+X21.2132 Y8.0000
+X22.2739 Y9.0607
+X23.3345 Y8.0000
+X24.3952 Y9.0607
+X25.4558 Y8.0000
+X26.5165 Y9.0607
+X27.5772 Y8.0000
+X28.6378 Y9.0607
+X29.6985 Y8.0000
+X30.7591 Y9.0607
+X31.8198 Y8.0000
+X32.8805 Y9.0607
+X33.9411 Y8.0000
+X35.0018 Y9.0607
+X36.0624 Y8.0000
+X37.1231 Y9.0607
+X38.1838 Y8.0000
+X39.2444 Y9.0607
+X40.3051 Y8.0000
+X41.3657 Y9.0607
+X42.4264 Y8.0000
+X43.4871 Y9.0607
+X44.5477 Y8.0000
+X45.6084 Y9.0607
+X46.6690 Y8.0000
+X47.7297 Y9.0607
+X48.7904 Y8.0000
+X49.8510 Y9.0607
+X50.9117 Y8.0000
+X51.9723 Y9.0607
+X53.0330 Y8.0000
+X54.0937 Y9.0607
+X55.1543 Y8.0000
+X56.2150 Y9.0607
+X57.2756 Y8.0000
+X58.3363 Y9.0607
+X59.3970 Y8.0000
+X60.4576 Y9.0607
+X61.5183 Y8.0000
+X62.5790 Y9.0607
+X63.6396 Y8.0000
+X64.7003 Y9.0607
+X65.7609 Y8.0000
+X66.8216 Y9.0607
+X67.8823 Y8.0000
+X68.9429 Y9.0607
+X70.0036 Y8.0000
+X71.0642 Y9.0607
+X72.1249 Y8.0000
+X73.1856 Y9.0607
+X74.2462 Y8.0000
+X75.3069 Y9.0607
+X76.3675 Y8.0000
+X77.4282 Y9.0607
+X78.4889 Y8.0000
+X79.5495 Y9.0607
+X80.6102 Y8.0000
+X81.6708 Y9.0607
+X82.7315 Y8.0000
+X83.7922 Y9.0607
+X84.8528 Y8.0000
+X85.9135 Y9.0607
+X86.9741 Y8.0000
+X88.0348 Y9.0607
+X89.0955 Y8.0000
+X90.1561 Y9.0607
+X91.2168 Y8.0000
+X92.2774 Y9.0607
+X93.3381 Y8.0000
+X94.3988 Y9.0607
+X95.4594 Y8.0000
+X96.5201 Y9.0607
+X97.5807 Y8.0000
+X98.6414 Y9.0607
+X99.7021 Y8.0000
+X100.7627 Y9.0607
+X101.8234 Y8.0000
+X102.8840 Y9.0607
+X103.9447 Y8.0000
+X105.0054 Y9.0607
+X106.0660 Y8.0000
+Y10.0000
+X105.0054 Y11.0607
+X103.9447 Y10.0000
+X102.8840 Y11.0607
+X101.8234 Y10.0000
+X100.7627 Y11.0607
+X99.7021 Y10.0000
+X98.6414 Y11.0607
+X97.5807 Y10.0000
+X96.5201 Y11.0607
+X95.4594 Y10.0000
+X94.3988 Y11.0607
+X93.3381 Y10.0000
+X92.2774 Y11.0607
+X91.2168 Y10.0000
+X90.1561 Y11.0607
+X89.0955 Y10.0000
+X88.0348 Y11.0607
+X86.9741 Y10.0000
+X85.9135 Y11.0607
+X84.8528 Y10.0000
+X83.7922 Y11.0607
+X82.7315 Y10.0000
+X81.6708 Y11.0607
+X80.6102 Y10.0000
+X79.5495 Y11.0607
+X78.4889 Y10.0000
+X77.4282 Y11.0607
+X76.3675 Y10.0000
+X75.3069 Y11.0607
+X74.2462 Y10.0000
+X73.1856 Y11.0607
+X72.1249 Y10.0000
+X71.0642 Y11.0607
+X70.0036 Y10.0000
+X68.9429 Y11.0607
+X67.8823 Y10.0000
+X66.8216 Y11.0607
+X65.7609 Y10.0000
+X64.7003 Y11.0607
+X63.6396 Y10.0000
+X62.5790 Y11.0607
+X61.5183 Y10.0000
+X60.4576 Y11.0607
+X59.3970 Y10.0000
+X58.3363 Y11.0607
+X57.2756 Y10.0000
+X56.2150 Y11.0607
+X55.1543 Y10.0000
+X54.0937 Y11.0607
+X53.0330 Y10.0000
+X51.9723 Y11.0607
+X50.9117 Y10.0000
+X49.8510 Y11.0607
+X48.7904 Y10.0000
+X47.7297 Y11.0607
+X46.6690 Y10.0000
+X45.6084 Y11.0607
+X44.5477 Y10.0000
+X43.4871 Y11.0607
+X42.4264 Y10.0000
+X41.3657 Y11.0607
+X40.3051 Y10.0000
+X39.2444 Y11.0607
+X38.1838 Y10.0000
+X37.1231 Y11.0607
+X36.0624 Y10.0000
+X35.0018 Y11.0607
+X33.9411 Y10.0000
+X32.8805 Y11.0607
+X31.8198 Y10.0000
+X30.7591 Y11.0607
+X29.6985 Y10.0000
+X28.6378 Y11.0607
+X27.5772 Y10.0000
+X26.5165 Y11.0607
+X25.4558 Y10.0000
+X24.3952 Y11.0607
+X23.3345 Y10.0000
+X22.2739 Y11.0607
+X21.2132 Y10.0000
+X20.1525 Y11.0607
+X19.0919 Y10.0000
+X18.0312 Y11.0607
+X16.9706 Y10.0000
+X15.9099 Y11.0607
+X14.8492 Y10.0000
+X13.7886 Y11.0607
+X12.7279 Y10.0000
+X11.6673 Y11.0607
+X10.6066 Y10.0000
+X9.5459 Y11.0607
+X8.4853 Y10.0000
+X7.4246 Y11.0607
+X6.3640 Y10.0000
+X5.3033 Y11.0607
+X4.2426 Y10.0000
+X3.1820 Y11.0607
+X2.1213 Y10.0000
+X1.0607 Y11.0607
+X0.0000 Y10.0000
+Y12.0000
+X1.0607 Y13.0607
+X2.1213 Y12.0000
+X3.1820 Y13.0607
+X4.2426 Y12.0000
+X5.3033 Y13.0607
+X6.3640 Y12.0000
+X7.4246 Y13.0607
+X8.4853 Y12.0000
+X9.5459 Y13.0607
+X10.6066 Y12.0000
+X11.6673 Y13.0607
+X12.7279 Y12.0000
+X13.7886 Y13.0607
+X14.8492 Y12.0000
+X15.9099 Y13.0607
+X16.9706 Y12.0000
+X18.0312 Y13.0607
+X19.0919 Y12.0000
+X20.1525 Y13.0607
+X21.2132 Y12.0000
+X22.2739 Y13.0607
+X23.3345 Y12.0000
+X24.3952 Y13.0607
+X25.4558 Y12.0000
+X26.5165 Y13.0607
+X27.5772 Y12.0000
+X28.6378 Y13.0607
+X29.6985 Y12.0000
+X30.7591 Y13.0607
+X31.8198 Y12.0000
+X32.8805 Y13.0607
+X33.9411 Y12.0000
+X35.0018 Y13.0607
+X36.0624 Y12.0000
+X37.1231 Y13.0607
+X38.1838 Y12.0000
+X39.2444 Y13.0607
+X40.3051 Y12.0000
+X41.3657 Y13.0607
+X42.4264 Y12.0000
+X43.4871 Y13.0607
+X44.5477 Y12.0000
+X45.6084 Y13.0607
+X46.6690 Y12.0000
+X47.7297 Y13.0607
+X48.7904 Y12.0000
+X49.8510 Y13.0607
+X50.9117 Y12.0000
+X51.9723 Y13.0607
+X53.0330 Y12.0000
+X54.0937 Y13.0607
+X55.1543 Y12.0000
+X56.2150 Y13.0607
+X57.2756 Y12.0000
+X58.3363 Y13.0607
+X59.3970 Y12.0000
+X60.4576 Y13.0607
+X61.5183 Y12.0000
+X62.5790 Y13.0607
+X63.6396 Y12.0000
+X64.7003 Y13.0607
+X65.7609 Y12.0000
+X66.8216 Y13.0607
+X67.8823 Y12.0000
+X68.9429 Y13.0607
+X70.0036 Y12.0000
+X71.0642 Y13.0607
+X72.1249 Y12.0000
+X73.1856 Y13.0607
+X74.2462 Y12.0000
+X75.3069 Y13.0607
+X76.3675 Y12.0000
+X77.4282 Y13.0607
+X78.4889 Y12.0000
+X79.5495 Y13.0607
+X80.6102 Y12.0000
+X81.6708 Y13.0607
+X82.7315 Y12.0000
+X83.7922 Y13.0607
+X84.8528 Y12.0000
+X85.9135 Y13.0607
+X86.9741 Y12.0000
+X88.0348 Y13.0607
+X89.0955 Y12.0000
+X90.1561 Y13.0607
+X91.2168 Y12.0000
+X92.2774 Y13.0607
+X93.3381 Y12.0000
+X94.3988 Y13.0607
+X95.4594 Y12.0000
+X96.5201 Y13.0607
+X97.5807 Y12.0000
+X98.6414 Y13.0607
+X99.7021 Y12.0000
+X100.7627 Y13.0607
+X101.8234 Y12.0000
+X102.8840 Y13.0607
+X103.9447 Y12.0000
+X105.0054 Y13.0607
+X106.0660 Y12.0000
+Y14.0000
+X105.0054 Y15.0607
+X103.9447 Y14.0000
+X102.8840 Y15.0607
+X101.8234 Y14.0000
+X100.7627 Y15.0607
+X99.7021 Y14.0000
+X98.6414 Y15.0607
+X97.5807 Y14.0000
+X96.5201 Y15.0607
+X95.4594 Y14.0000
+X94.3988 Y15.0607
+X93.3381 Y14.0000
+X92.2774 Y15.0607
+X91.2168 Y14.0000
+X90.1561 Y15.0607
+X89.0955 Y14.0000
+X88.0348 Y15.0607
+X86.9741 Y14.0000
+X85.9135 Y15.0607
+X84.8528 Y14.0000
+X83.7922 Y15.0607
+X82.7315 Y14.0000
+X81.6708 Y15.0607
+X80.6102 Y14.0000
+X79.5495 Y15.0607
+X78.4889 Y14.0000
+X77.4282 Y15.0607
+X76.3675 Y14.0000
+X75.3069 Y15.0607
+X74.2462 Y14.0000
+X73.1856 Y15.0607
+X72.1249 Y14.0000
+X71.0642 Y15.0607
+X70.0036 Y14.0000
+X68.9429 Y15.0607
+X67.8823 Y14.0000
+X66.8216 Y15.0607
+X65.7609 Y14.0000
+X64.7003 Y15.0607
+X63.6396 Y14.0000
+X62.5790 Y15.0607
+X61.5183 Y14.0000
+X60.4576 Y15.0607
+X59.3970 Y14.0000
+X58.3363 Y15.0607
+X57.2756 Y14.0000
+X56.2150 Y15.0607
+X55.1543 Y14.0000
+X54.0937 Y15.0607
+X53.0330 Y14.0000
+X51.9723 Y15.0607
+X50.9117 Y14.0000
+X49.8510 Y15.0607
+X48.7904 Y14.0000
+X47.7297 Y15.0607
+X46.6690 Y14.0000
+X45.6084 Y15.0607
+X44.5477 Y14.0000
+X43.4871 Y15.0607
+X42.4264 Y14.0000
+X41.3657 Y15.0607
+X40.3051 Y14.0000
+X39.2444 Y15.0607
+X38.1838 Y14.0000
+X37.1231 Y15.0607
+X36.0624 Y14.0000
+X35.0018 Y15.0607
+X33.9411 Y14.0000
+X32.8805 Y15.0607
+X31.8198 Y14.0000
+X30.7591 Y15.0607
+X29.6985 Y14.0000
+X28.6378 Y15.0607
+X27.5772 Y14.0000
+X26.5165 Y15.0607
+X25.4558 Y14.0000
+X24.3952 Y15.0607
+X23.3345 Y14.0000
+X22.2739 Y15.0607
+X21.2132 Y14.0000
+X20.1525 Y15.0607
+X19.0919 Y14.0000
+X18.0312 Y15.0607
+X16.9706 Y14.0000
+X15.9099 Y15.0607
+X14.8492 Y14.0000
+X13.7886 Y15.0607
+X12.7279 Y14.0000
+X11.6673 Y15.0607
+X10.6066 Y14.0000
+X9.5459 Y15.0607
+X8.4853 Y14.0000
+X7.4246 Y15.0607
+X6.3640 Y14.0000
+X5.3033 Y15.0607
+X4.2426 Y14.0000
+X3.1820 Y15.0607
+X2.1213 Y14.0000
+X1.0607 Y15.0607
+X0.0000 Y14.0000
+Y16.0000
+X1.0607 Y17.0607
+X2.1213 Y16.0000
+X3.1820 Y17.0607
+X4.2426 Y16.0000
+X5.3033 Y17.0607
+X6.3640 Y16.0000
+X7.4246 Y17.0607
+X8.4853 Y16.0000
+X9.5459 Y17.0607
+X10.6066 Y16.0000
+X11.6673 Y17.0607
+X12.7279 Y16.0000
+X13.7886 Y17.0607
+X14.8492 Y16.0000
+X15.9099 Y17.0607
+X16.9706 Y16.0000
+X18.0312 Y17.0607
+X19.0919 Y16.0000
+X20.1525 Y17.0607
+X21.2132 Y16.0000
+X22.2739 Y17.0607
+X23.3345 Y16.0000
+X24.3952 Y17.0607
+X25.4558 Y16.0000
+X26.5165 Y17.0607
+X27.5772 Y16.0000
+X28.6378 Y17.0607
+X29.6985 Y16.0000
+X30.7591 Y17.0607
+X31.8198 Y16.0000
+X32.8805 Y17.0607
+X33.9411 Y16.0000
+X35.0018 Y17.0607
+X36.0624 Y16.0000
+X37.1231 Y17.0607
+X38.1838 Y16.0000
+X39.2444 Y17.0607
+X40.3051 Y16.0000
+X41.3657 Y17.0607
+X42.4264 Y16.0000
+X43.4871 Y17.0607
+X44.5477 Y16.0000
+X45.6084 Y17.0607
+X46.6690 Y16.0000
+X47.7297 Y17.0607
+X48.7904 Y16.0000
+X49.8510 Y17.0607
+X50.9117 Y16.0000
+X51.9723 Y17.0607
+X53.0330 Y16.0000
+X54.0937 Y17.0607
+X55.1543 Y16.0000
+X56.2150 Y17.0607
+X57.2756 Y16.0000
+X58.3363 Y17.0607
+X59.3970 Y16.0000
+X60.4576 Y17.0607
+X61.5183 Y16.0000
+X62.5790 Y17.0607
+X63.6396 Y16.0000
+X64.7003 Y17.0607
+X65.7609 Y16.0000
+X66.8216 Y17.0607
+X67.8823 Y16.0000
+X68.9429 Y17.0607
+X70.0036 Y16.0000
+X71.0642 Y17.0607
+X72.1249 Y16.0000
+X73.1856 Y17.0607
+X74.2462 Y16.0000
+X75.3069 Y17.0607
+X76.3675 Y16.0000
+X77.4282 Y17.0607
+X78.4889 Y16.0000
+X79.5495 Y17.0607
+X80.6102 Y16.0000
+X81.6708 Y17.0607
+X82.7315 Y16.0000
+X83.7922 Y17.0607
+X84.8528 Y16.0000
+X85.9135 Y17.0607
+X86.9741 Y16.0000
+X88.0348 Y17.0607
+X89.0955 Y16.0000
+X90.1561 Y17.0607
+X91.2168 Y16.0000
+X92.2774 Y17.0607
+X93.3381 Y16.0000
+X94.3988 Y17.0607
+X95.4594 Y16.0000
+X96.5201 Y17.0607
+X97.5807 Y16.0000
+X98.6414 Y17.0607
+X99.7021 Y16.0000
+X100.7627 Y17.0607
+X101.8234 Y16.0000
+X102.8840 Y17.0607
+X103.9447 Y16.0000
+X105.0054 Y17.0607
+X106.0660 Y16.0000
+Y18.0000
+X105.0054 Y19.0607
+X103.9447 Y18.0000
+X102.8840 Y19.0607
+X101.8234 Y18.0000
+X100.7627 Y19.0607
+X99.7021 Y18.0000
+X98.6414 Y19.0607
+X97.5807 Y18.0000
+X96.5201 Y19.0607
+X95.4594 Y18.0000
+X94.3988 Y19.0607
+X93.3381 Y18.0000
+X92.2774 Y19.0607
+X91.2168 Y18.0000
+X90.1561 Y19.0607
+X89.0955 Y18.0000
+X88.0348 Y19.0607
+X86.9741 Y18.0000
+X85.9135 Y19.0607
+X84.8528 Y18.0000
+X83.7922 Y19.0607
+X82.7315 Y18.0000
+X81.6708 Y19.0607
+X80.6102 Y18.0000
+X79.5495 Y19.0607
+X78.4889 Y18.0000
+X77.4282 Y19.0607
+X76.3675 Y18.0000
+X75.3069 Y19.0607
+X74.2462 Y18.0000
+X73.1856 Y19.0607
+X72.1249 Y18.0000
+X71.0642 Y19.0607
+X70.0036 Y18.0000
+X68.9429 Y19.0607
+X67.8823 Y18.0000
+X66.8216 Y19.0607
+X65.7609 Y18.0000
+X64.7003 Y19.0607
+X63.6396 Y18.0000
+X62.5790 Y19.0607
+X61.5183 Y18.0000
+X60.4576 Y19.0607
+X59.3970 Y18.0000
+X58.3363 Y19.0607
+X57.2756 Y18.0000
+X56.2150 Y19.0607
+X55.1543 Y18.0000
+X54.0937 Y19.0607
+X53.0330 Y18.0000
+X51.9723 Y19.0607
+X50.9117 Y18.0000
+X49.8510 Y19.0607
+X48.7904 Y18.0000
+X47.7297 Y19.0607
+X46.6690 Y18.0000
+X45.6084 Y19.0607
+X44.5477 Y18.0000
+X43.4871 Y19.0607
+X42.4264 Y18.0000
+X41.3657 Y19.0607
+X40.3051 Y18.0000
+X39.2444 Y19.0607
+X38.1838 Y18.0000
+X37.1231 Y19.0607
+X36.0624 Y18.0000
+X35.0018 Y19.0607
+X33.9411 Y18.0000
+X32.8805 Y19.0607
+X31.8198 Y18.0000
+X30.7591 Y19.0607
+X29.6985 Y18.0000
+X28.6378 Y19.0607
+X27.5772 Y18.0000
+X26.5165 Y19.0607
+X25.4558 Y18.0000
+X24.3952 Y19.0607
+X23.3345 Y18.0000
+X22.2739 Y19.0607
+X21.2132 Y18.0000
+X20.1525 Y19.0607
+X19.0919 Y18.0000
+X18.0312 Y19.0607
+X16.9706 Y18.0000
+X15.9099 Y19.0607
+X14.8492 Y18.0000
+X13.7886 Y19.0607
+X12.7279 Y18.0000
+X11.6673 Y19.0607
+X10.6066 Y18.0000
+X9.5459 Y19.0607
+X8.4853 Y18.0000
+X7.4246 Y19.0607
+X6.3640 Y18.0000
+X5.3033 Y19.0607
+X4.2426 Y18.0000
+X3.1820 Y19.0607
+X2.1213 Y18.0000
+X1.0607 Y19.0607
+X0.0000 Y18.0000
+Y20.0000
+X1.0607 Y21.0607
+X2.1213 Y20.0000
+X3.1820 Y21.0607
+X4.2426 Y20.0000
+X5.3033 Y21.0607
+X6.3640 Y20.0000
+X7.4246 Y21.0607
+X8.4853 Y20.0000
+X9.5459 Y21.0607
+X10.6066 Y20.0000
+X11.6673 Y21.0607
+X12.7279 Y20.0000
+X13.7886 Y21.0607
+X14.8492 Y20.0000
+X15.9099 Y21.0607
+X16.9706 Y20.0000
+X18.0312 Y21.0607
+X19.0919 Y20.0000
+X20.1525 Y21.0607
+X21.2132 Y20.0000
+X22.2739 Y21.0607
+X23.3345 Y20.0000
+X24.3952 Y21.0607
+X25.4558 Y20.0000
+X26.5165 Y21.0607
+X27.5772 Y20.0000
+X28.6378 Y21.0607
+X29.6985 Y20.0000
+X30.7591 Y21.0607
+X31.8198 Y20.0000
+X32.8805 Y21.0607
+X33.9411 Y20.0000
+X35.0018 Y21.0607
+X36.0624 Y20.0000
+X37.1231 Y21.0607
+X38.1838 Y20.0000
+X39.2444 Y21.0607
+X40.3051 Y20.0000
+X41.3657 Y21.0607
+X42.4264 Y20.0000
+X43.4871 Y21.0607
+X44.5477 Y20.0000
+X45.6084 Y21.0607
+X46.6690 Y20.0000
+X47.7297 Y21.0607
+X48.7904 Y20.0000
+X49.8510 Y21.0607
+X50.9117 Y20.0000
+X51.9723 Y21.0607
+X53.0330 Y20.0000
+X54.0937 Y21.0607
+X55.1543 Y20.0000
+X56.2150 Y21.0607
+X57.2756 Y20.0000
+X58.3363 Y21.0607
+X59.3970 Y20.0000
+X60.4576 Y21.0607
+X61.5183 Y20.0000
+X62.5790 Y21.0607
+X63.6396 Y20.0000
+X64.7003 Y21.0607
+X65.7609 Y20.0000
+X66.8216 Y21.0607
+X67.8823 Y20.0000
+X68.9429 Y21.0607
+X70.0036 Y20.0000
+X71.0642 Y21.0607
+X72.1249 Y20.0000
+X73.1856 Y21.0607
+X74.2462 Y20.0000
+X75.3069 Y21.0607
+X76.3675 Y20.0000
+X77.4282 Y21.0607
+X78.4889 Y20.0000
+X79.5495 Y21.0607
+X80.6102 Y20.0000
+X81.6708 Y21.0607
+X82.7315 Y20.0000
+X83.7922 Y21.0607
+X84.8528 Y20.0000
+X85.9135 Y21.0607
+X86.9741 Y20.0000
+X88.0348 Y21.0607
+X89.0955 Y20.0000
+X90.1561 Y21.0607
+X91.2168 Y20.0000
+X92.2774 Y21.0607
+X93.3381 Y20.0000
+X94.3988 Y21.0607
+X95.4594 Y20.0000
+X96.5201 Y21.0607
+X97.5807 Y20.0000
+X98.6414 Y21.0607
+X99.7021 Y20.0000
+X100.7627 Y21.0607
+X101.8234 Y20.0000
+X102.8840 Y21.0607
+X103.9447 Y20.0000
+X105.0054 Y21.0607
+X106.0660 Y20.0000
+Y22.0000
+X105.0054 Y23.0607
+X103.9447 Y22.0000
+X102.8840 Y23.0607
+X101.8234 Y22.0000
+X100.7627 Y23.0607
+X99.7021 Y22.0000
+X98.6414 Y23.0607
+X97.5807 Y22.0000
+X96.5201 Y23.0607
+X95.4594 Y22.0000
+X94.3988 Y23.0607
+X93.3381 Y22.0000
+X92.2774 Y23.0607
+X91.2168 Y22.0000
+X90.1561 Y23.0607
+X89.0955 Y22.0000
+X88.0348 Y23.0607
+X86.9741 Y22.0000
+X85.9135 Y23.0607
+X84.8528 Y22.0000
+X83.7922 Y23.0607
+X82.7315 Y22.0000
+X81.6708 Y23.0607
+X80.6102 Y22.0000
+X79.5495 Y23.0607
+X78.4889 Y22.0000
+X77.4282 Y23.0607
+X76.3675 Y22.0000
+X75.3069 Y23.0607
+X74.2462 Y22.0000
+X73.1856 Y23.0607
+X72.1249 Y22.0000
+X71.0642 Y23.0607
+X70.0036 Y22.0000
+X68.9429 Y23.0607
+X67.8823 Y22.0000
+X66.8216 Y23.0607
+X65.7609 Y22.0000
+X64.7003 Y23.0607
+X63.6396 Y22.0000
+X62.5790 Y23.0607
+X61.5183 Y22.0000
+X60.4576 Y23.0607
+X59.3970 Y22.0000
+X58.3363 Y23.0607
+X57.2756 Y22.0000
+X56.2150 Y23.0607
+X55.1543 Y22.0000
+X54.0937 Y23.0607
+X53.0330 Y22.0000
+X51.9723 Y23.0607
+X50.9117 Y22.0000
+X49.8510 Y23.0607
+X48.7904 Y22.0000
+X47.7297 Y23.0607
+X46.6690 Y22.0000
+X45.6084 Y23.0607
+X44.5477 Y22.0000
+X43.4871 Y23.0607
+X42.4264 Y22.0000
+X41.3657 Y23.0607
+X40.3051 Y22.0000
+X39.2444 Y23.0607
+X38.1838 Y22.0000
+X37.1231 Y23.0607
+X36.0624 Y22.0000
+X35.0018 Y23.0607
+X33.9411 Y22.0000
+X32.8805 Y23.0607
+X31.8198 Y22.0000
+X30.7591 Y23.0607
+X29.6985 Y22.0000
+X28.6378 Y23.0607
+X27.5772 Y22.0000
+X26.5165 Y23.0607
+X25.4558 Y22.0000
+X24.3952 Y23.0607
+X23.3345 Y22.0000
+X22.2739 Y23.0607
+X21.2132 Y22.0000
+X20.1525 Y23.0607
+X19.0919 Y22.0000
+X18.0312 Y23.0607
+X16.9706 Y22.0000
+X15.9099 Y23.0607
+X14.8492 Y22.0000
+X13.7886 Y23.0607
+X12.7279 Y22.0000
+X11.6673 Y23.0607
+X10.6066 Y22.0000
+X9.5459 Y23.0607
+X8.4853 Y22.0000
+X7.4246 Y23.0607
+X6.3640 Y22.0000
+X5.3033 Y23.0607
+X4.2426 Y22.0000
+X3.1820 Y23.0607
+X2.1213 Y22.0000
+X1.0607 Y23.0607
+X0.0000 Y22.0000
+Y24.0000
+X1.0607 Y25.0607
+X2.1213 Y24.0000
+X3.1820 Y25.0607
+X4.2426 Y24.0000
+X5.3033 Y25.0607
+X6.3640 Y24.0000
+X7.4246 Y25.0607
+X8.4853 Y24.0000
+X9.5459 Y25.0607
+X10.6066 Y24.0000
+X11.6673 Y25.0607
+X12.7279 Y24.0000
+X13.7886 Y25.0607
+X14.8492 Y24.0000
+X15.9099 Y25.0607
+X16.9706 Y24.0000
+X18.0312 Y25.0607
+X19.0919 Y24.0000
+X20.1525 Y25.0607
+X21.2132 Y24.0000
+X22.2739 Y25.0607
+X23.3345 Y24.0000
+X24.3952 Y25.0607
+X25.4558 Y24.0000
+X26.5165 Y25.0607
+X27.5772 Y24.0000
+X28.6378 Y25.0607
+X29.6985 Y24.0000
+X30.7591 Y25.0607
+X31.8198 Y24.0000
+X32.8805 Y25.0607
+X33.9411 Y24.0000
+X35.0018 Y25.0607
+X36.0624 Y24.0000
+X37.1231 Y25.0607
+X38.1838 Y24.0000
+X39.2444 Y25.0607
+X40.3051 Y24.0000
+X41.3657 Y25.0607
+X42.4264 Y24.0000
+X43.4871 Y25.0607
+X44.5477 Y24.0000
+X45.6084 Y25.0607
+X46.6690 Y24.0000
+X47.7297 Y25.0607
+X48.7904 Y24.0000
+X49.8510 Y25.0607
+X50.9117 Y24.0000
+X51.9723 Y25.0607
+X53.0330 Y24.0000
+X54.0937 Y25.0607
+X55.1543 Y24.0000
+X56.2150 Y25.0607
+X57.2756 Y24.0000
+X58.3363 Y25.0607
+X59.3970 Y24.0000
+X60.4576 Y25.0607
+X61.5183 Y24.0000
+X62.5790 Y25.0607
+X63.6396 Y24.0000
+X64.7003 Y25.0607
+X65.7609 Y24.0000
+X66.8216 Y25.0607
+X67.8823 Y24.0000
+X68.9429 Y25.0607
+X70.0036 Y24.0000
+X71.0642 Y25.0607
+X72.1249 Y24.0000
+X73.1856 Y25.0607
+X74.2462 Y24.0000
+X75.3069 Y25.0607
+X76.3675 Y24.0000
+X77.4282 Y25.0607
+X78.4889 Y24.0000
+X79.5495 Y25.0607
+X80.6102 Y24.0000
+X81.6708 Y25.0607
+X82.7315 Y24.0000
+X83.7922 Y25.0607
+X84.8528 Y24.0000
+X85.9135 Y25.0607
+X86.9741 Y24.0000
+X88.0348 Y25.0607
+X89.0955 Y24.0000
+X90.1561 Y25.0607
+X91.2168 Y24.0000
+X92.2774 Y25.0607
+X93.3381 Y24.0000
+X94.3988 Y25.0607
+X95.4594 Y24.0000
+X96.5201 Y25.0607
+X97.5807 Y24.0000
+X98.6414 Y25.0607
+X99.7021 Y24.0000
+X100.7627 Y25.0607
+X101.8234 Y24.0000
+X102.8840 Y25.0607
+X103.9447 Y24.0000
+X105.0054 Y25.0607
+X106.0660 Y24.0000
+Y26.0000
+X105.0054 Y27.0607
+X103.9447 Y26.0000
+X102.8840 Y27.0607
+X101.8234 Y26.0000
+X100.7627 Y27.0607
+X99.7021 Y26.0000
+X98.6414 Y27.0607
+X97.5807 Y26.0000
+X96.5201 Y27.0607
+X95.4594 Y26.0000
+X94.3988 Y27.0607
+X93.3381 Y26.0000
+X92.2774 Y27.0607
+X91.2168 Y26.0000
+X90.1561 Y27.0607
+X89.0955 Y26.0000
+X88.0348 Y27.0607
+X86.9741 Y26.0000
+X85.9135 Y27.0607
+X84.8528 Y26.0000
+X83.7922 Y27.0607
+X82.7315 Y26.0000
+X81.6708 Y27.0607
+X80.6102 Y26.0000
+X79.5495 Y27.0607
+X78.4889 Y26.0000
+X77.4282 Y27.0607
+X76.3675 Y26.0000
+X75.3069 Y27.0607
+X74.2462 Y26.0000
+X73.1856 Y27.0607
+X72.1249 Y26.0000
+X71.0642 Y27.0607
+X70.0036 Y26.0000
+X68.9429 Y27.0607
+X67.8823 Y26.0000
+X66.8216 Y27.0607
+X65.7609 Y26.0000
+X64.7003 Y27.0607
+X63.6396 Y26.0000
+X62.5790 Y27.0607
+X61.5183 Y26.0000
+X60.4576 Y27.0607
+X59.3970 Y26.0000
+X58.3363 Y27.0607
+X57.2756 Y26.0000
+X56.2150 Y27.0607
+X55.1543 Y26.0000
+X54.0937 Y27.0607
+X53.0330 Y26.0000
+X51.9723 Y27.0607
+X50.9117 Y26.0000
+X49.8510 Y27.0607
+X48.7904 Y26.0000
+X47.7297 Y27.0607
+X46.6690 Y26.0000
+X45.6084 Y27.0607
+X44.5477 Y26.0000
+X43.4871 Y27.0607
+X42.4264 Y26.0000
+X41.3657 Y27.0607
+X40.3051 Y26.0000
+X39.2444 Y27.0607
+X38.1838 Y26.0000
+X37.1231 Y27.0607
+X36.0624 Y26.0000
+X35.0018 Y27.0607
+X33.9411 Y26.0000
+X32.8805 Y27.0607
+X31.8198 Y26.0000
+X30.7591 Y27.0607
+X29.6985 Y26.0000
+X28.6378 Y27.0607
+X27.5772 Y26.0000
+X26.5165 Y27.0607
+X25.4558 Y26.0000
+X24.3952 Y27.0607
+X23.3345 Y26.0000
+X22.2739 Y27.0607
+X21.2132 Y26.0000
+X20.1525 Y27.0607
+X19.0919 Y26.0000
+X18.0312 Y27.0607
+X16.9706 Y26.0000
+X15.9099 Y27.0607
+X14.8492 Y26.0000
+X13.7886 Y27.0607
+X12.7279 Y26.0000
+X11.6673 Y27.0607
+X10.6066 Y26.0000
+X9.5459 Y27.0607
+X8.4853 Y26.0000
+X7.4246 Y27.0607
+X6.3640 Y26.0000
+X5.3033 Y27.0607
+X4.2426 Y26.0000
+X3.1820 Y27.0607
+X2.1213 Y26.0000
+X1.0607 Y27.0607
+X0.0000 Y26.0000
+Y28.0000
+X1.0607 Y29.0607
+X2.1213 Y28.0000
+X3.1820 Y29.0607
+X4.2426 Y28.0000
+X5.3033 Y29.0607
+X6.3640 Y28.0000
+X7.4246 Y29.0607
+X8.4853 Y28.0000
+X9.5459 Y29.0607
+X10.6066 Y28.0000
+X11.6673 Y29.0607
+X12.7279 Y28.0000
+X13.7886 Y29.0607
+X14.8492 Y28.0000
+X15.9099 Y29.0607
+X16.9706 Y28.0000
+X18.0312 Y29.0607
+X19.0919 Y28.0000
+X20.1525 Y29.0607
+X21.2132 Y28.0000
+X22.2739 Y29.0607
+X23.3345 Y28.0000
+X24.3952 Y29.0607
+X25.4558 Y28.0000
+X26.5165 Y29.0607
+X27.5772 Y28.0000
+X28.6378 Y29.0607
+X29.6985 Y28.0000
+X30.7591 Y29.0607
+X31.8198 Y28.0000
+X32.8805 Y29.0607
+X33.9411 Y28.0000
+X35.0018 Y29.0607
+X36.0624 Y28.0000
+X37.1231 Y29.0607
+X38.1838 Y28.0000
+X39.2444 Y29.0607
+X40.3051 Y28.0000
+X41.3657 Y29.0607
+X42.4264 Y28.0000
+X43.4871 Y29.0607
+X44.5477 Y28.0000
+X45.6084 Y29.0607
+X46.6690 Y28.0000
+X47.7297 Y29.0607
+X48.7904 Y28.0000
+X49.8510 Y29.0607
+X50.9117 Y28.0000
+X51.9723 Y29.0607
+X53.0330 Y28.0000
+X54.0937 Y29.0607
+X55.1543 Y28.0000
+X56.2150 Y29.0607
+X57.2756 Y28.0000
+X58.3363 Y29.0607
+X59.3970 Y28.0000
+X60.4576 Y29.0607
+X61.5183 Y28.0000
+X62.5790 Y29.0607
+X63.6396 Y28.0000
+X64.7003 Y29.0607
+X65.7609 Y28.0000
+X66.8216 Y29.0607
+X67.8823 Y28.0000
+X68.9429 Y29.0607
+X70.0036 Y28.0000
+X71.0642 Y29.0607
+X72.1249 Y28.0000
+X73.1856 Y29.0607
+X74.2462 Y28.0000
+X75.3069 Y29.0607
+X76.3675 Y28.0000
+X77.4282 Y29.0607
+X78.4889 Y28.0000
+X79.5495 Y29.0607
+X80.6102 Y28.0000
+X81.6708 Y29.0607
+X82.7315 Y28.0000
+X83.7922 Y29.0607
+X84.8528 Y28.0000
+X85.9135 Y29.0607
+X86.9741 Y28.0000
+X88.0348 Y29.0607
+X89.0955 Y28.0000
+X90.1561 Y29.0607
+X91.2168 Y28.0000
+X92.2774 Y29.0607
+X93.3381 Y28.0000
+X94.3988 Y29.0607
+X95.4594 Y28.0000
+X96.5201 Y29.0607
+X97.5807 Y28.0000
+X98.6414 Y29.0607
+X99.7021 Y28.0000
+X100.7627 Y29.0607
+X101.8234 Y28.0000
+X102.8840 Y29.0607
+X103.9447 Y28.0000
+X105.0054 Y29.0607
+X106.0660 Y28.0000
+Y30.0000
+X105.0054 Y31.0607
+X103.9447 Y30.0000
+X102.8840 Y31.0607
+X101.8234 Y30.0000
+X100.7627 Y31.0607
+X99.7021 Y30.0000
+X98.6414 Y31.0607
+X97.5807 Y30.0000
+X96.5201 Y31.0607
+X95.4594 Y30.0000
+X94.3988 Y31.0607
+X93.3381 Y30.0000
+X92.2774 Y31.0607
+X91.2168 Y30.0000
+X90.1561 Y31.0607
+X89.0955 Y30.0000
+X88.0348 Y31.0607
+X86.9741 Y30.0000
+X85.9135 Y31.0607
+X84.8528 Y30.0000
+X83.7922 Y31.0607
+X82.7315 Y30.0000
+X81.6708 Y31.0607
+X80.6102 Y30.0000
+X79.5495 Y31.0607
+X78.4889 Y30.0000
+X77.4282 Y31.0607
+X76.3675 Y30.0000
+X75.3069 Y31.0607
+X74.2462 Y30.0000
+X73.1856 Y31.0607
+X72.1249 Y30.0000
+X71.0642 Y31.0607
+X70.0036 Y30.0000
+X68.9429 Y31.0607
+X67.8823 Y30.0000
+X66.8216 Y31.0607
+X65.7609 Y30.0000
+X64.7003 Y31.0607
+X63.6396 Y30.0000
+X62.5790 Y31.0607
+X61.5183 Y30.0000
+X60.4576 Y31.0607
+X59.3970 Y30.0000
+X58.3363 Y31.0607
+X57.2756 Y30.0000
+X56.2150 Y31.0607
+X55.1543 Y30.0000
+X54.0937 Y31.0607
+X53.0330 Y30.0000
+X51.9723 Y31.0607
+X50.9117 Y30.0000
+X49.8510 Y31.0607
+X48.7904 Y30.0000
+X47.7297 Y31.0607
+X46.6690 Y30.0000
+X45.6084 Y31.0607
+X44.5477 Y30.0000
+X43.4871 Y31.0607
+X42.4264 Y30.0000
+X41.3657 Y31.0607
+X40.3051 Y30.0000
+X39.2444 Y31.0607
+X38.1838 Y30.0000
+X37.1231 Y31.0607
+X36.0624 Y30.0000
+X35.0018 Y31.0607
+X33.9411 Y30.0000
+X32.8805 Y31.0607
+X31.8198 Y30.0000
+X30.7591 Y31.0607
+X29.6985 Y30.0000
+X28.6378 Y31.0607
+X27.5772 Y30.0000
+X26.5165 Y31.0607
+X25.4558 Y30.0000
+X24.3952 Y31.0607
+X23.3345 Y30.0000
+X22.2739 Y31.0607
+X21.2132 Y30.0000
+X20.1525 Y31.0607
+X19.0919 Y30.0000
+X18.0312 Y31.0607
+X16.9706 Y30.0000
+X15.9099 Y31.0607
+X14.8492 Y30.0000
+X13.7886 Y31.0607
+X12.7279 Y30.0000
+X11.6673 Y31.0607
+X10.6066 Y30.0000
+X9.5459 Y31.0607
+X8.4853 Y30.0000
+X7.4246 Y31.0607
+X6.3640 Y30.0000
+X5.3033 Y31.0607
+X4.2426 Y30.0000
+X3.1820 Y31.0607
+X2.1213 Y30.0000
+X1.0607 Y31.0607
+X0.0000 Y30.0000
+Y32.0000
+X1.0607 Y33.0607
+X2.1213 Y32.0000
+X3.1820 Y33.0607
+X4.2426 Y32.0000
+X5.3033 Y33.0607
+X6.3640 Y32.0000
+X7.4246 Y33.0607
+X8.4853 Y32.0000
+X9.5459 Y33.0607
+X10.6066 Y32.0000
+X11.6673 Y33.0607
+X12.7279 Y32.0000
+X13.7886 Y33.0607
+X14.8492 Y32.0000
+X15.9099 Y33.0607
+X16.9706 Y32.0000
+X18.0312 Y33.0607
+X19.0919 Y32.0000
+X20.1525 Y33.0607
+X21.2132 Y32.0000
+X22.2739 Y33.0607
+X23.3345 Y32.0000
+X24.3952 Y33.0607
+X25.4558 Y32.0000
+X26.5165 Y33.0607
+X27.5772 Y32.0000
+X28.6378 Y33.0607
+X29.6985 Y32.0000
+X30.7591 Y33.0607
+X31.8198 Y32.0000
+X32.8805 Y33.0607
+X33.9411 Y32.0000
+X35.0018 Y33.0607
+X36.0624 Y32.0000
+X37.1231 Y33.0607
+X38.1838 Y32.0000
+X39.2444 Y33.0607
+X40.3051 Y32.0000
+X41.3657 Y33.0607
+X42.4264 Y32.0000
+X43.4871 Y33.0607
+X44.5477 Y32.0000
+X45.6084 Y33.0607
+X46.6690 Y32.0000
+X47.7297 Y33.0607
+X48.7904 Y32.0000
+X49.8510 Y33.0607
+X50.9117 Y32.0000
+X51.9723 Y33.0607
+X53.0330 Y32.0000
+X54.0937 Y33.0607
+X55.1543 Y32.0000
+X56.2150 Y33.0607
+X57.2756 Y32.0000
+X58.3363 Y33.0607
+X59.3970 Y32.0000
+X60.4576 Y33.0607
+X61.5183 Y32.0000
+X62.5790 Y33.0607
+X63.6396 Y32.0000
+X64.7003 Y33.0607
+X65.7609 Y32.0000
+X66.8216 Y33.0607
+X67.8823 Y32.0000
+X68.9429 Y33.0607
+X70.0036 Y32.0000
+X71.0642 Y33.0607
+X72.1249 Y32.0000
+X73.1856 Y33.0607
+X74.2462 Y32.0000
+X75.3069 Y33.0607
+X76.3675 Y32.0000
+X77.4282 Y33.0607
+X78.4889 Y32.0000
+X79.5495 Y33.0607
+X80.6102 Y32.0000
+X81.6708 Y33.0607
+X82.7315 Y32.0000
+X83.7922 Y33.0607
+X84.8528 Y32.0000
+X85.9135 Y33.0607
+X86.9741 Y32.0000
+X88.0348 Y33.0607
+X89.0955 Y32.0000
+X90.1561 Y33.0607
+X91.2168 Y32.0000
+X92.2774 Y33.0607
+X93.3381 Y32.0000
+X94.3988 Y33.0607
+X95.4594 Y32.0000
+X96.5201 Y33.0607
+X97.5807 Y32.0000
+X98.6414 Y33.0607
+X99.7021 Y32.0000
+X100.7627 Y33.0607
+X101.8234 Y32.0000
+X102.8840 Y33.0607
+X103.9447 Y32.0000
+X105.0054 Y33.0607
+X106.0660 Y32.0000
+Y34.0000
+X105.0054 Y35.0607
+X103.9447 Y34.0000
+X102.8840 Y35.0607
+X101.8234 Y34.0000
+X100.7627 Y35.0607
+X99.7021 Y34.0000
+X98.6414 Y35.0607
+X97.5807 Y34.0000
+X96.5201 Y35.0607
+X95.4594 Y34.0000
+X94.3988 Y35.0607
+X93.3381 Y34.0000
+X92.2774 Y35.0607
+X91.2168 Y34.0000
+X90.1561 Y35.0607
+X89.0955 Y34.0000
+X88.0348 Y35.0607
+X86.9741 Y34.0000
+X85.9135 Y35.0607
+X84.8528 Y34.0000
+X83.7922 Y35.0607
+X82.7315 Y34.0000
+X81.6708 Y35.0607
+X80.6102 Y34.0000
+X79.5495 Y35.0607
+X78.4889 Y34.0000
+X77.4282 Y35.0607
+X76.3675 Y34.0000
+X75.3069 Y35.0607
+X74.2462 Y34.0000
+X73.1856 Y35.0607
+X72.1249 Y34.0000
+X71.0642 Y35.0607
+X70.0036 Y34.0000
+X68.9429 Y35.0607
+X67.8823 Y34.0000
+X66.8216 Y35.0607
+X65.7609 Y34.0000
+X64.7003 Y35.0607
+X63.6396 Y34.0000
+X62.5790 Y35.0607
+X61.5183 Y34.0000
+X60.4576 Y35.0607
+X59.3970 Y34.0000
+X58.3363 Y35.0607
+X57.2756 Y34.0000
+X56.2150 Y35.0607
+X55.1543 Y34.0000
+X54.0937 Y35.0607
+X53.0330 Y34.0000
+X51.9723 Y35.0607
+X50.9117 Y34.0000
+X49.8510 Y35.0607
+X48.7904 Y34.0000
+X47.7297 Y35.0607
+X46.6690 Y34.0000
+X45.6084 Y35.0607
+X44.5477 Y34.0000
+X43.4871 Y35.0607
+X42.4264 Y34.0000
+X41.3657 Y35.0607
+X40.3051 Y34.0000
+X39.2444 Y35.0607
+X38.1838 Y34.0000
+X37.1231 Y35.0607
+X36.0624 Y34.0000
+X35.0018 Y35.0607
+X33.9411 Y34.0000
+X32.8805 Y35.0607
+X31.8198 Y34.0000
+X30.7591 Y35.0607
+X29.6985 Y34.0000
+X28.6378 Y35.0607
+X27.5772 Y34.0000
+X26.5165 Y35.0607
+X25.4558 Y34.0000
+X24.3952 Y35.0607
+X23.3345 Y34.0000
+X22.2739 Y35.0607
+X21.2132 Y34.0000
+X20.1525 Y35.0607
+X19.0919 Y34.0000
+X18.0312 Y35.0607
+X16.9706 Y34.0000
+X15.9099 Y35.0607
+X14.8492 Y34.0000
+X13.7886 Y35.0607
+X12.7279 Y34.0000
+X11.6673 Y35.0607
+X10.6066 Y34.0000
+X9.5459 Y35.0607
+X8.4853 Y34.0000
+X7.4246 Y35.0607
+X6.3640 Y34.0000
+X5.3033 Y35.0607
+X4.2426 Y34.0000
+X3.1820 Y35.0607
+X2.1213 Y34.0000
+X1.0607 Y35.0607
+X0.0000 Y34.0000
+Y36.0000
+X1.0607 Y37.0607
+X2.1213 Y36.0000
+X3.1820 Y37.0607
+X4.2426 Y36.0000
+X5.3033 Y37.0607
+X6.3640 Y36.0000
+X7.4246 Y37.0607
+X8.4853 Y36.0000
+X9.5459 Y37.0607
+X10.6066 Y36.0000
+X11.6673 Y37.0607
+X12.7279 Y36.0000
+X13.7886 Y37.0607
+X14.8492 Y36.0000
+X15.9099 Y37.0607
+X16.9706 Y36.0000
+X18.0312 Y37.0607
+X19.0919 Y36.0000
+X20.1525 Y37.0607
+X21.2132 Y36.0000
+X22.2739 Y37.0607
+X23.3345 Y36.0000
+X24.3952 Y37.0607
+X25.4558 Y36.0000
+X26.5165 Y37.0607
+X27.5772 Y36.0000
+X28.6378 Y37.0607
+X29.6985 Y36.0000
+X30.7591 Y37.0607
+X31.8198 Y36.0000
+X32.8805 Y37.0607
+X33.9411 Y36.0000
+X35.0018 Y37.0607
+X36.0624 Y36.0000
+X37.1231 Y37.0607
+X38.1838 Y36.0000
+X39.2444 Y37.0607
+X40.3051 Y36.0000
+X41.3657 Y37.0607
+X42.4264 Y36.0000
+X43.4871 Y37.0607
+X44.5477 Y36.0000
+X45.6084 Y37.0607
+X46.6690 Y36.0000
+X47.7297 Y37.0607
+X48.7904 Y36.0000
+X49.8510 Y37.0607
+X50.9117 Y36.0000
+X51.9723 Y37.0607
+X53.0330 Y36.0000
+X54.0937 Y37.0607
+X55.1543 Y36.0000
+X56.2150 Y37.0607
+X57.2756 Y36.0000
+X58.3363 Y37.0607
+X59.3970 Y36.0000
+X60.4576 Y37.0607
+X61.5183 Y36.0000
+X62.5790 Y37.0607
+X63.6396 Y36.0000
+X64.7003 Y37.0607
+X65.7609 Y36.0000
+X66.8216 Y37.0607
+X67.8823 Y36.0000
+X68.9429 Y37.0607
+X70.0036 Y36.0000
+X71.0642 Y37.0607
+X72.1249 Y36.0000
+X73.1856 Y37.0607
+X74.2462 Y36.0000
+X75.3069 Y37.0607
+X76.3675 Y36.0000
+X77.4282 Y37.0607
+X78.4889 Y36.0000
+X79.5495 Y37.0607
+X80.6102 Y36.0000
+X81.6708 Y37.0607
+X82.7315 Y36.0000
+X83.7922 Y37.0607
+X84.8528 Y36.0000
+X85.9135 Y37.0607
+X86.9741 Y36.0000
+X88.0348 Y37.0607
+X89.0955 Y36.0000
+X90.1561 Y37.0607
+X91.2168 Y36.0000
+X92.2774 Y37.0607
+X93.3381 Y36.0000
+X94.3988 Y37.0607
+X95.4594 Y36.0000
+X96.5201 Y37.0607
+X97.5807 Y36.0000
+X98.6414 Y37.0607
+X99.7021 Y36.0000
+X100.7627 Y37.0607
+X101.8234 Y36.0000
+X102.8840 Y37.0607
+X103.9447 Y36.0000
+X105.0054 Y37.0607
+X106.0660 Y36.0000
+Y38.0000
+X105.0054 Y39.0607
+X103.9447 Y38.0000
+X102.8840 Y39.0607
+X101.8234 Y38.0000
+X100.7627 Y39.0607
+X99.7021 Y38.0000
+X98.6414 Y39.0607
+X97.5807 Y38.0000
+X96.5201 Y39.0607
+X95.4594 Y38.0000
+X94.3988 Y39.0607
+X93.3381 Y38.0000
+X92.2774 Y39.0607
+X91.2168 Y38.0000
+X90.1561 Y39.0607
+X89.0955 Y38.0000
+X88.0348 Y39.0607
+X86.9741 Y38.0000
+X85.9135 Y39.0607
+X84.8528 Y38.0000
+X83.7922 Y39.0607
+X82.7315 Y38.0000
+X81.6708 Y39.0607
+X80.6102 Y38.0000
+X79.5495 Y39.0607
+X78.4889 Y38.0000
+X77.4282 Y39.0607
+X76.3675 Y38.0000
+X75.3069 Y39.0607
+X74.2462 Y38.0000
+X73.1856 Y39.0607
+X72.1249 Y38.0000
+X71.0642 Y39.0607
+X70.0036 Y38.0000
+X68.9429 Y39.0607
+X67.8823 Y38.0000
+X66.8216 Y39.0607
+X65.7609 Y38.0000
+X64.7003 Y39.0607
+X63.6396 Y38.0000
+X62.5790 Y39.0607
+X61.5183 Y38.0000
+X60.4576 Y39.0607
+X59.3970 Y38.0000
+X58.3363 Y39.0607
+X57.2756 Y38.0000
+X56.2150 Y39.0607
+X55.1543 Y38.0000
+X54.0937 Y39.0607
+X53.0330 Y38.0000
+X51.9723 Y39.0607
+X50.9117 Y38.0000
+X49.8510 Y39.0607
+X48.7904 Y38.0000
+X47.7297 Y39.0607
+X46.6690 Y38.0000
+X45.6084 Y39.0607
+X44.5477 Y38.0000
+X43.4871 Y39.0607
+X42.4264 Y38.0000
+X41.3657 Y39.0607
+X40.3051 Y38.0000
+X39.2444 Y39.0607
+X38.1838 Y38.0000
+X37.1231 Y39.0607
+X36.0624 Y38.0000
+X35.0018 Y39.0607
+X33.9411 Y38.0000
+X32.8805 Y39.0607
+X31.8198 Y38.0000
+X30.7591 Y39.0607
+X29.6985 Y38.0000
+X28.6378 Y39.0607
+X27.5772 Y38.0000
+X26.5165 Y39.0607
+X25.4558 Y38.0000
+X24.3952 Y39.0607
+X23.3345 Y38.0000
+X22.2739 Y39.0607
+X21.2132 Y38.0000
+X20.1525 Y39.0607
+X19.0919 Y38.0000
+X18.0312 Y39.0607
+X16.9706 Y38.0000
+X15.9099 Y39.0607
+X14.8492 Y38.0000
+X13.7886 Y39.0607
+X12.7279 Y38.0000
+X11.6673 Y39.0607
+X10.6066 Y38.0000
+X9.5459 Y39.0607
+X8.4853 Y38.0000
+X7.4246 Y39.0607
+X6.3640 Y38.0000
+X5.3033 Y39.0607
+X4.2426 Y38.0000
+X3.1820 Y39.0607
+X2.1213 Y38.0000
+X1.0607 Y39.0607
+X0.0000 Y38.0000
+Y40.0000
+X1.0607 Y41.0607
+X2.1213 Y40.0000
+X3.1820 Y41.0607
+X4.2426 Y40.0000
+X5.3033 Y41.0607
+X6.3640 Y40.0000
+X7.4246 Y41.0607
+X8.4853 Y40.0000
+X9.5459 Y41.0607
+X10.6066 Y40.0000
+X11.6673 Y41.0607
+X12.7279 Y40.0000
+X13.7886 Y41.0607
+X14.8492 Y40.0000
+X15.9099 Y41.0607
+X16.9706 Y40.0000
+X18.0312 Y41.0607
+X19.0919 Y40.0000
+X20.1525 Y41.0607
+X21.2132 Y40.0000
+X22.2739 Y41.0607
+X23.3345 Y40.0000
+X24.3952 Y41.0607
+X25.4558 Y40.0000
+X26.5165 Y41.0607
+X27.5772 Y40.0000
+X28.6378 Y41.0607
+X29.6985 Y40.0000
+X30.7591 Y41.0607
+X31.8198 Y40.0000
+X32.8805 Y41.0607
+X33.9411 Y40.0000
+X35.0018 Y41.0607
+X36.0624 Y40.0000
+X37.1231 Y41.0607
+X38.1838 Y40.0000
+X39.2444 Y41.0607
+X40.3051 Y40.0000
+X41.3657 Y41.0607
+X42.4264 Y40.0000
+X43.4871 Y41.0607
+X44.5477 Y40.0000
+X45.6084 Y41.0607
+X46.6690 Y40.0000
+X47.7297 Y41.0607
+X48.7904 Y40.0000
+X49.8510 Y41.0607
+X50.9117 Y40.0000
+X51.9723 Y41.0607
+X53.0330 Y40.0000
+X54.0937 Y41.0607
+X55.1543 Y40.0000
+X56.2150 Y41.0607
+X57.2756 Y40.0000
+X58.3363 Y41.0607
+X59.3970 Y40.0000
+X60.4576 Y41.0607
+X61.5183 Y40.0000
+X62.5790 Y41.0607
+X63.6396 Y40.0000
+X64.7003 Y41.0607
+X65.7609 Y40.0000
+X66.8216 Y41.0607
+X67.8823 Y40.0000
+X68.9429 Y41.0607
+X70.0036 Y40.0000
+X71.0642 Y41.0607
+X72.1249 Y40.0000
+X73.1856 Y41.0607
+X74.2462 Y40.0000
+X75.3069 Y41.0607
+X76.3675 Y40.0000
+X77.4282 Y41.0607
+X78.4889 Y40.0000
+X79.5495 Y41.0607
+X80.6102 Y40.0000
+X81.6708 Y41.0607
+X82.7315 Y40.0000
+X83.7922 Y41.0607
+X84.8528 Y40.0000
+X85.9135 Y41.0607
+X86.9741 Y40.0000
+X88.0348 Y41.0607
+X89.0955 Y40.0000
+X90.1561 Y41.0607
+X91.2168 Y40.0000
+X92.2774 Y41.0607
+X93.3381 Y40.0000
+X94.3988 Y41.0607
+X95.4594 Y40.0000
+X96.5201 Y41.0607
+X97.5807 Y40.0000
+X98.6414 Y41.0607
+X99.7021 Y40.0000
+X100.7627 Y41.0607
+X101.8234 Y40.0000
+X102.8840 Y41.0607
+X103.9447 Y40.0000
+X105.0054 Y41.0607
+X106.0660 Y40.0000
+Y42.0000
+X105.0054 Y43.0607
+X103.9447 Y42.0000
+X102.8840 Y43.0607
+X101.8234 Y42.0000
+X100.7627 Y43.0607
+X99.7021 Y42.0000
+X98.6414 Y43.0607
+X97.5807 Y42.0000
+X96.5201 Y43.0607
+X95.4594 Y42.0000
+X94.3988 Y43.0607
+X93.3381 Y42.0000
+X92.2774 Y43.0607
+X91.2168 Y42.0000
+X90.1561 Y43.0607
+X89.0955 Y42.0000
+X88.0348 Y43.0607
+X86.9741 Y42.0000
+X85.9135 Y43.0607
+X84.8528 Y42.0000
+X83.7922 Y43.0607
+X82.7315 Y42.0000
+X81.6708 Y43.0607
+X80.6102 Y42.0000
+X79.5495 Y43.0607
+X78.4889 Y42.0000
+X77.4282 Y43.0607
+X76.3675 Y42.0000
+X75.3069 Y43.0607
+X74.2462 Y42.0000
+X73.1856 Y43.0607
+X72.1249 Y42.0000
+X71.0642 Y43.0607
+X70.0036 Y42.0000
+X68.9429 Y43.0607
+X67.8823 Y42.0000
+X66.8216 Y43.0607
+X65.7609 Y42.0000
+X64.7003 Y43.0607
+X63.6396 Y42.0000
+X62.5790 Y43.0607
+X61.5183 Y42.0000
+X60.4576 Y43.0607
+X59.3970 Y42.0000
+X58.3363 Y43.0607
+X57.2756 Y42.0000
+X56.2150 Y43.0607
+X55.1543 Y42.0000
+X54.0937 Y43.0607
+X53.0330 Y42.0000
+X51.9723 Y43.0607
+X50.9117 Y42.0000
+X49.8510 Y43.0607
+X48.7904 Y42.0000
+X47.7297 Y43.0607
+X46.6690 Y42.0000
+X45.6084 Y43.0607
+X44.5477 Y42.0000
+X43.4871 Y43.0607
+X42.4264 Y42.0000
+X41.3657 Y43.0607
+X40.3051 Y42.0000
+X39.2444 Y43.0607
+X38.1838 Y42.0000
+X37.1231 Y43.0607
+X36.0624 Y42.0000
+X35.0018 Y43.0607
+X33.9411 Y42.0000
+X32.8805 Y43.0607
+X31.8198 Y42.0000
+X30.7591 Y43.0607
+X29.6985 Y42.0000
+X28.6378 Y43.0607
+X27.5772 Y42.0000
+X26.5165 Y43.0607
+X25.4558 Y42.0000
+X24.3952 Y43.0607
+X23.3345 Y42.0000
+X22.2739 Y43.0607
+X21.2132 Y42.0000
+X20.1525 Y43.0607
+X19.0919 Y42.0000
+X18.0312 Y43.0607
+X16.9706 Y42.0000
+X15.9099 Y43.0607
+X14.8492 Y42.0000
+X13.7886 Y43.0607
+X12.7279 Y42.0000
+X11.6673 Y43.0607
+X10.6066 Y42.0000
+X9.5459 Y43.0607
+X8.4853 Y42.0000
+X7.4246 Y43.0607
+X6.3640 Y42.0000
+X5.3033 Y43.0607
+X4.2426 Y42.0000
+X3.1820 Y43.0607
+X2.1213 Y42.0000
+X1.0607 Y43.0607
+X0.0000 Y42.0000
+Y44.0000
+X1.0607 Y45.0607
+X2.1213 Y44.0000
+X3.1820 Y45.0607
+X4.2426 Y44.0000
+X5.3033 Y45.0607
+X6.3640 Y44.0000
+X7.4246 Y45.0607
+X8.4853 Y44.0000
+X9.5459 Y45.0607
+X10.6066 Y44.0000
+X11.6673 Y45.0607
+X12.7279 Y44.0000
+X13.7886 Y45.0607
+X14.8492 Y44.0000
+X15.9099 Y45.0607
+X16.9706 Y44.0000
+X18.0312 Y45.0607
+X19.0919 Y44.0000
+X20.1525 Y45.0607
+X21.2132 Y44.0000
+X22.2739 Y45.0607
+X23.3345 Y44.0000
+X24.3952 Y45.0607
+X25.4558 Y44.0000
+X26.5165 Y45.0607
+X27.5772 Y44.0000
+X28.6378 Y45.0607
+X29.6985 Y44.0000
+X30.7591 Y45.0607
+X31.8198 Y44.0000
+X32.8805 Y45.0607
+X33.9411 Y44.0000
+X35.0018 Y45.0607
+X36.0624 Y44.0000
+X37.1231 Y45.0607
+X38.1838 Y44.0000
+X39.2444 Y45.0607
+X40.3051 Y44.0000
+X41.3657 Y45.0607
+X42.4264 Y44.0000
+X43.4871 Y45.0607
+X44.5477 Y44.0000
+X45.6084 Y45.0607
+X46.6690 Y44.0000
+X47.7297 Y45.0607
+X48.7904 Y44.0000
+X49.8510 Y45.0607
+X50.9117 Y44.0000
+X51.9723 Y45.0607
+X53.0330 Y44.0000
+X54.0937 Y45.0607
+X55.1543 Y44.0000
+X56.2150 Y45.0607
+X57.2756 Y44.0000
+X58.3363 Y45.0607
+X59.3970 Y44.0000
+X60.4576 Y45.0607
+X61.5183 Y44.0000
+X62.5790 Y45.0607
+X63.6396 Y44.0000
+X64.7003 Y45.0607
+X65.7609 Y44.0000
+X66.8216 Y45.0607
+X67.8823 Y44.0000
+X68.9429 Y45.0607
+X70.0036 Y44.0000
+X71.0642 Y45.0607
+X72.1249 Y44.0000
+X73.1856 Y45.0607
+X74.2462 Y44.0000
+X75.3069 Y45.0607
+X76.3675 Y44.0000
+X77.4282 Y45.0607
+X78.4889 Y44.0000
+X79.5495 Y45.0607
+X80.6102 Y44.0000
+X81.6708 Y45.0607
+X82.7315 Y44.0000
+X83.7922 Y45.0607
+X84.8528 Y44.0000
+X85.9135 Y45.0607
+X86.9741 Y44.0000
+X88.0348 Y45.0607
+X89.0955 Y44.0000
+X90.1561 Y45.0607
+X91.2168 Y44.0000
+X92.2774 Y45.0607
+X93.3381 Y44.0000
+X94.3988 Y45.0607
+X95.4594 Y44.0000
+X96.5201 Y45.0607
+X97.5807 Y44.0000
+X98.6414 Y45.0607
+X99.7021 Y44.0000
+X100.7627 Y45.0607
+X101.8234 Y44.0000
+X102.8840 Y45.0607
+X103.9447 Y44.0000
+X105.0054 Y45.0607
+X106.0660 Y44.0000
+Y46.0000
+X105.0054 Y47.0607
+X103.9447 Y46.0000
+X102.8840 Y47.0607
+X101.8234 Y46.0000
+X100.7627 Y47.0607
+X99.7021 Y46.0000
+X98.6414 Y47.0607
+X97.5807 Y46.0000
+X96.5201 Y47.0607
+X95.4594 Y46.0000
+X94.3988 Y47.0607
+X93.3381 Y46.0000
+X92.2774 Y47.0607
+X91.2168 Y46.0000
+X90.1561 Y47.0607
+X89.0955 Y46.0000
+X88.0348 Y47.0607
+X86.9741 Y46.0000
+X85.9135 Y47.0607
+X84.8528 Y46.0000
+X83.7922 Y47.0607
+X82.7315 Y46.0000
+X81.6708 Y47.0607
+X80.6102 Y46.0000
+X79.5495 Y47.0607
+X78.4889 Y46.0000
+X77.4282 Y47.0607
+X76.3675 Y46.0000
+X75.3069 Y47.0607
+X74.2462 Y46.0000
+X73.1856 Y47.0607
+X72.1249 Y46.0000
+X71.0642 Y47.0607
+X70.0036 Y46.0000
+X68.9429 Y47.0607
+X67.8823 Y46.0000
+X66.8216 Y47.0607
+X65.7609 Y46.0000
+X64.7003 Y47.0607
+X63.6396 Y46.0000
+X62.5790 Y47.0607
+X61.5183 Y46.0000
+X60.4576 Y47.0607
+X59.3970 Y46.0000
+X58.3363 Y47.0607
+X57.2756 Y46.0000
+X56.2150 Y47.0607
+X55.1543 Y46.0000
+X54.0937 Y47.0607
+X53.0330 Y46.0000
+X51.9723 Y47.0607
+X50.9117 Y46.0000
+X49.8510 Y47.0607
+X48.7904 Y46.0000
+X47.7297 Y47.0607
+X46.6690 Y46.0000
+X45.6084 Y47.0607
+X44.5477 Y46.0000
+X43.4871 Y47.0607
+X42.4264 Y46.0000
+X41.3657 Y47.0607
+X40.3051 Y46.0000
+X39.2444 Y47.0607
+X38.1838 Y46.0000
+X37.1231 Y47.0607
+X36.0624 Y46.0000
+X35.0018 Y47.0607
+X33.9411 Y46.0000
+X32.8805 Y47.0607
+X31.8198 Y46.0000
+X30.7591 Y47.0607
+X29.6985 Y46.0000
+X28.6378 Y47.0607
+X27.5772 Y46.0000
+X26.5165 Y47.0607
+X25.4558 Y46.0000
+X24.3952 Y47.0607
+X23.3345 Y46.0000
+X22.2739 Y47.0607
+X21.2132 Y46.0000
+X20.1525 Y47.0607
+X19.0919 Y46.0000
+X18.0312 Y47.0607
+X16.9706 Y46.0000
+X15.9099 Y47.0607
+X14.8492 Y46.0000
+X13.7886 Y47.0607
+X12.7279 Y46.0000
+X11.6673 Y47.0607
+X10.6066 Y46.0000
+X9.5459 Y47.0607
+X8.4853 Y46.0000
+X7.4246 Y47.0607
+X6.3640 Y46.0000
+X5.3033 Y47.0607
+X4.2426 Y46.0000
+X3.1820 Y47.0607
+X2.1213 Y46.0000
+X1.0607 Y47.0607
+X0.0000 Y46.0000
+Y48.0000
+X1.0607 Y49.0607
+X2.1213 Y48.0000
+X3.1820 Y49.0607
+X4.2426 Y48.0000
+X5.3033 Y49.0607
+X6.3640 Y48.0000
+X7.4246 Y49.0607
+X8.4853 Y48.0000
+X9.5459 Y49.0607
+X10.6066 Y48.0000
+X11.6673 Y49.0607
+X12.7279 Y48.0000
+X13.7886 Y49.0607
+X14.8492 Y48.0000
+X15.9099 Y49.0607
+X16.9706 Y48.0000
+X18.0312 Y49.0607
+X19.0919 Y48.0000
+X20.1525 Y49.0607
+X21.2132 Y48.0000
+X22.2739 Y49.0607
+X23.3345 Y48.0000
+X24.3952 Y49.0607
+X25.4558 Y48.0000
+X26.5165 Y49.0607
+X27.5772 Y48.0000
+X28.6378 Y49.0607
+X29.6985 Y48.0000
+X30.7591 Y49.0607
+X31.8198 Y48.0000
+X32.8805 Y49.0607
+X33.9411 Y48.0000
+X35.0018 Y49.0607
+X36.0624 Y48.0000
+X37.1231 Y49.0607
+X38.1838 Y48.0000
+X39.2444 Y49.0607
+X40.3051 Y48.0000
+X41.3657 Y49.0607
+X42.4264 Y48.0000
+X43.4871 Y49.0607
+X44.5477 Y48.0000
+X45.6084 Y49.0607
+X46.6690 Y48.0000
+X47.7297 Y49.0607
+X48.7904 Y48.0000
+X49.8510 Y49.0607
+X50.9117 Y48.0000
+X51.9723 Y49.0607
+X53.0330 Y48.0000
+X54.0937 Y49.0607
+X55.1543 Y48.0000
+X56.2150 Y49.0607
+X57.2756 Y48.0000
+X58.3363 Y49.0607
+X59.3970 Y48.0000
+X60.4576 Y49.0607
+X61.5183 Y48.0000
+X62.5790 Y49.0607
+X63.6396 Y48.0000
+X64.7003 Y49.0607
+X65.7609 Y48.0000
+X66.8216 Y49.0607
+X67.8823 Y48.0000
+X68.9429 Y49.0607
+X70.0036 Y48.0000
+X71.0642 Y49.0607
+X72.1249 Y48.0000
+X73.1856 Y49.0607
+X74.2462 Y48.0000
+X75.3069 Y49.0607
+X76.3675 Y48.0000
+X77.4282 Y49.0607
+X78.4889 Y48.0000
+X79.5495 Y49.0607
+X80.6102 Y48.0000
+X81.6708 Y49.0607
+X82.7315 Y48.0000
+X83.7922 Y49.0607
+X84.8528 Y48.0000
+X85.9135 Y49.0607
+X86.9741 Y48.0000
+X88.0348 Y49.0607
+X89.0955 Y48.0000
+X90.1561 Y49.0607
+X91.2168 Y48.0000
+X92.2774 Y49.0607
+X93.3381 Y48.0000
+X94.3988 Y49.0607
+X95.4594 Y48.0000
+X96.5201 Y49.0607
+X97.5807 Y48.0000
+X98.6414 Y49.0607
+X99.7021 Y48.0000
+X100.7627 Y49.0607
+X101.8234 Y48.0000
+X102.8840 Y49.0607
+X103.9447 Y48.0000
+X105.0054 Y49.0607
+X106.0660 Y48.0000
+Y50.0000
+X105.0054 Y51.0607
+X103.9447 Y50.0000
+X102.8840 Y51.0607
+X101.8234 Y50.0000
+X100.7627 Y51.0607
+X99.7021 Y50.0000
+X98.6414 Y51.0607
+X97.5807 Y50.0000
+X96.5201 Y51.0607
+X95.4594 Y50.0000
+X94.3988 Y51.0607
+X93.3381 Y50.0000
+X92.2774 Y51.0607
+X91.2168 Y50.0000
+X90.1561 Y51.0607
+X89.0955 Y50.0000
+X88.0348 Y51.0607
+X86.9741 Y50.0000
+X85.9135 Y51.0607
+X84.8528 Y50.0000
+X83.7922 Y51.0607
+X82.7315 Y50.0000
+X81.6708 Y51.0607
+X80.6102 Y50.0000
+X79.5495 Y51.0607
+X78.4889 Y50.0000
+X77.4282 Y51.0607
+X76.3675 Y50.0000
+X75.3069 Y51.0607
+X74.2462 Y50.0000
+X73.1856 Y51.0607
+X72.1249 Y50.0000
+X71.0642 Y51.0607
+X70.0036 Y50.0000
+X68.9429 Y51.0607
+X67.8823 Y50.0000
+X66.8216 Y51.0607
+X65.7609 Y50.0000
+X64.7003 Y51.0607
+X63.6396 Y50.0000
+X62.5790 Y51.0607
+X61.5183 Y50.0000
+X60.4576 Y51.0607
+X59.3970 Y50.0000
+X58.3363 Y51.0607
+X57.2756 Y50.0000
+X56.2150 Y51.0607
+X55.1543 Y50.0000
+X54.0937 Y51.0607
+X53.0330 Y50.0000
+X51.9723 Y51.0607
+X50.9117 Y50.0000
+X49.8510 Y51.0607
+X48.7904 Y50.0000
+X47.7297 Y51.0607
+X46.6690 Y50.0000
+X45.6084 Y51.0607
+X44.5477 Y50.0000
+X43.4871 Y51.0607
+X42.4264 Y50.0000
+X41.3657 Y51.0607
+X40.3051 Y50.0000
+X39.2444 Y51.0607
+X38.1838 Y50.0000
+X37.1231 Y51.0607
+X36.0624 Y50.0000
+X35.0018 Y51.0607
+X33.9411 Y50.0000
+X32.8805 Y51.0607
+X31.8198 Y50.0000
+X30.7591 Y51.0607
+X29.6985 Y50.0000
+X28.6378 Y51.0607
+X27.5772 Y50.0000
+X26.5165 Y51.0607
+X25.4558 Y50.0000
+X24.3952 Y51.0607
+X23.3345 Y50.0000
+X22.2739 Y51.0607
+X21.2132 Y50.0000
+X20.1525 Y51.0607
+X19.0919 Y50.0000
+X18.0312 Y51.0607
+X16.9706 Y50.0000
+X15.9099 Y51.0607
+X14.8492 Y50.0000
+X13.7886 Y51.0607
+X12.7279 Y50.0000
+X11.6673 Y51.0607
+X10.6066 Y50.0000
+X9.5459 Y51.0607
+X8.4853 Y50.0000
+X7.4246 Y51.0607
+X6.3640 Y50.0000
+X5.3033 Y51.0607
+X4.2426 Y50.0000
+X3.1820 Y51.0607
+X2.1213 Y50.0000
+X1.0607 Y51.0607
+X0.0000 Y50.0000
+Y52.0000
+X1.0607 Y53.0607
+X2.1213 Y52.0000
+X3.1820 Y53.0607
+X4.2426 Y52.0000
+X5.3033 Y53.0607
+X6.3640 Y52.0000
+X7.4246 Y53.0607
+X8.4853 Y52.0000
+X9.5459 Y53.0607
+X10.6066 Y52.0000
+X11.6673 Y53.0607
+X12.7279 Y52.0000
+X13.7886 Y53.0607
+X14.8492 Y52.0000
+X15.9099 Y53.0607
+X16.9706 Y52.0000
+X18.0312 Y53.0607
+X19.0919 Y52.0000
+X20.1525 Y53.0607
+X21.2132 Y52.0000
+X22.2739 Y53.0607
+X23.3345 Y52.0000
+X24.3952 Y53.0607
+X25.4558 Y52.0000
+X26.5165 Y53.0607
+X27.5772 Y52.0000
+X28.6378 Y53.0607
+X29.6985 Y52.0000
+X30.7591 Y53.0607
+X31.8198 Y52.0000
+X32.8805 Y53.0607
+X33.9411 Y52.0000
+X35.0018 Y53.0607
+X36.0624 Y52.0000
+X37.1231 Y53.0607
+X38.1838 Y52.0000
+X39.2444 Y53.0607
+X40.3051 Y52.0000
+X41.3657 Y53.0607
+X42.4264 Y52.0000
+X43.4871 Y53.0607
+X44.5477 Y52.0000
+X45.6084 Y53.0607
+X46.6690 Y52.0000
+X47.7297 Y53.0607
+X48.7904 Y52.0000
+X49.8510 Y53.0607
+X50.9117 Y52.0000
+X51.9723 Y53.0607
+X53.0330 Y52.0000
+X54.0937 Y53.0607
+X55.1543 Y52.0000
+X56.2150 Y53.0607
+X57.2756 Y52.0000
+X58.3363 Y53.0607
+X59.3970 Y52.0000
+X60.4576 Y53.0607
+X61.5183 Y52.0000
+X62.5790 Y53.0607
+X63.6396 Y52.0000
+X64.7003 Y53.0607
+X65.7609 Y52.0000
+X66.8216 Y53.0607
+X67.8823 Y52.0000
+X68.9429 Y53.0607
+X70.0036 Y52.0000
+X71.0642 Y53.0607
+X72.1249 Y52.0000
+X73.1856 Y53.0607
+X74.2462 Y52.0000
+X75.3069 Y53.0607
+X76.3675 Y52.0000
+X77.4282 Y53.0607
+X78.4889 Y52.0000
+X79.5495 Y53.0607
+X80.6102 Y52.0000
+X81.6708 Y53.0607
+X82.7315 Y52.0000
+X83.7922 Y53.0607
+X84.8528 Y52.0000
+X85.9135 Y53.0607
+X86.9741 Y52.0000
+X88.0348 Y53.0607
+X89.0955 Y52.0000
+X90.1561 Y53.0607
+X91.2168 Y52.0000
+X92.2774 Y53.0607
+X93.3381 Y52.0000
+X94.3988 Y53.0607
+X95.4594 Y52.0000
+X96.5201 Y53.0607
+X97.5807 Y52.0000
+X98.6414 Y53.0607
+X99.7021 Y52.0000
+X100.7627 Y53.0607
+X101.8234 Y52.0000
+X102.8840 Y53.0607
+X103.9447 Y52.0000
+X105.0054 Y53.0607
+X106.0660 Y52.0000
+Y54.0000
+X105.0054 Y55.0607
+X103.9447 Y54.0000
+X102.8840 Y55.0607
+X101.8234 Y54.0000
+X100.7627 Y55.0607
+X99.7021 Y54.0000
+X98.6414 Y55.0607
+X97.5807 Y54.0000
+X96.5201 Y55.0607
+X95.4594 Y54.0000
+X94.3988 Y55.0607
+X93.3381 Y54.0000
+X92.2774 Y55.0607
+X91.2168 Y54.0000
+X90.1561 Y55.0607
+X89.0955 Y54.0000
+X88.0348 Y55.0607
+X86.9741 Y54.0000
+X85.9135 Y55.0607
+X84.8528 Y54.0000
+X83.7922 Y55.0607
+X82.7315 Y54.0000
+X81.6708 Y55.0607
+X80.6102 Y54.0000
+X79.5495 Y55.0607
+X78.4889 Y54.0000
+X77.4282 Y55.0607
+X76.3675 Y54.0000
+X75.3069 Y55.0607
+X74.2462 Y54.0000
+X73.1856 Y55.0607
+X72.1249 Y54.0000
+X71.0642 Y55.0607
+X70.0036 Y54.0000
+X68.9429 Y55.0607
+X67.8823 Y54.0000
+X66.8216 Y55.0607
+X65.7609 Y54.0000
+X64.7003 Y55.0607
+X63.6396 Y54.0000
+X62.5790 Y55.0607
+X61.5183 Y54.0000
+X60.4576 Y55.0607
+X59.3970 Y54.0000
+X58.3363 Y55.0607
+X57.2756 Y54.0000
+X56.2150 Y55.0607
+X55.1543 Y54.0000
+X54.0937 Y55.0607
+X53.0330 Y54.0000
+X51.9723 Y55.0607
+X50.9117 Y54.0000
+X49.8510 Y55.0607
+X48.7904 Y54.0000
+X47.7297 Y55.0607
+X46.6690 Y54.0000
+X45.6084 Y55.0607
+X44.5477 Y54.0000
+X43.4871 Y55.0607
+X42.4264 Y54.0000
+X41.3657 Y55.0607
+X40.3051 Y54.0000
+X39.2444 Y55.0607
+X38.1838 Y54.0000
+X37.1231 Y55.0607
+X36.0624 Y54.0000
+X35.0018 Y55.0607
+X33.9411 Y54.0000
+X32.8805 Y55.0607
+X31.8198 Y54.0000
+X30.7591 Y55.0607
+X29.6985 Y54.0000
+X28.6378 Y55.0607
+X27.5772 Y54.0000
+X26.5165 Y55.0607
+X25.4558 Y54.0000
+X24.3952 Y55.0607
+X23.3345 Y54.0000
+X22.2739 Y55.0607
+X21.2132 Y54.0000
+X20.1525 Y55.0607
+X19.0919 Y54.0000
+X18.0312 Y55.0607
+X16.9706 Y54.0000
+X15.9099 Y55.0607
+X14.8492 Y54.0000
+X13.7886 Y55.0607
+X12.7279 Y54.0000
+X11.6673 Y55.0607
+X10.6066 Y54.0000
+X9.5459 Y55.0607
+X8.4853 Y54.0000
+X7.4246 Y55.0607
+X6.3640 Y54.0000
+X5.3033 Y55.0607
+X4.2426 Y54.0000
+X3.1820 Y55.0607
+X2.1213 Y54.0000
+X1.0607 Y55.0607
+X0.0000 Y54.0000
+Y56.0000
+X1.0607 Y57.0607
+X2.1213 Y56.0000
+X3.1820 Y57.0607
+X4.2426 Y56.0000
+X5.3033 Y57.0607
+X6.3640 Y56.0000
+X7.4246 Y57.0607
+X8.4853 Y56.0000
+X9.5459 Y57.0607
+X10.6066 Y56.0000
+X11.6673 Y57.0607
+X12.7279 Y56.0000
+X13.7886 Y57.0607
+X14.8492 Y56.0000
+X15.9099 Y57.0607
+X16.9706 Y56.0000
+X18.0312 Y57.0607
+X19.0919 Y56.0000
+X20.1525 Y57.0607
+X21.2132 Y56.0000
+X22.2739 Y57.0607
+X23.3345 Y56.0000
+X24.3952 Y57.0607
+X25.4558 Y56.0000
+X26.5165 Y57.0607
+X27.5772 Y56.0000
+X28.6378 Y57.0607
+X29.6985 Y56.0000
+X30.7591 Y57.0607
+X31.8198 Y56.0000
+X32.8805 Y57.0607
+X33.9411 Y56.0000
+X35.0018 Y57.0607
+X36.0624 Y56.0000
+X37.1231 Y57.0607
+X38.1838 Y56.0000
+X39.2444 Y57.0607
+X40.3051 Y56.0000
+X41.3657 Y57.0607
+X42.4264 Y56.0000
+X43.4871 Y57.0607
+X44.5477 Y56.0000
+X45.6084 Y57.0607
+X46.6690 Y56.0000
+X47.7297 Y57.0607
+X48.7904 Y56.0000
+X49.8510 Y57.0607
+X50.9117 Y56.0000
+X51.9723 Y57.0607
+X53.0330 Y56.0000
+X54.0937 Y57.0607
+X55.1543 Y56.0000
+X56.2150 Y57.0607
+X57.2756 Y56.0000
+X58.3363 Y57.0607
+X59.3970 Y56.0000
+X60.4576 Y57.0607
+X61.5183 Y56.0000
+X62.5790 Y57.0607
+X63.6396 Y56.0000
+X64.7003 Y57.0607
+X65.7609 Y56.0000
+X66.8216 Y57.0607
+X67.8823 Y56.0000
+X68.9429 Y57.0607
+X70.0036 Y56.0000
+X71.0642 Y57.0607
+X72.1249 Y56.0000
+X73.1856 Y57.0607
+X74.2462 Y56.0000
+X75.3069 Y57.0607
+X76.3675 Y56.0000
+X77.4282 Y57.0607
+X78.4889 Y56.0000
+X79.5495 Y57.0607
+X80.6102 Y56.0000
+X81.6708 Y57.0607
+X82.7315 Y56.0000
+X83.7922 Y57.0607
+X84.8528 Y56.0000
+X85.9135 Y57.0607
+X86.9741 Y56.0000
+X88.0348 Y57.0607
+X89.0955 Y56.0000
+X90.1561 Y57.0607
+X91.2168 Y56.0000
+X92.2774 Y57.0607
+X93.3381 Y56.0000
+X94.3988 Y57.0607
+X95.4594 Y56.0000
+X96.5201 Y57.0607
+X97.5807 Y56.0000
+X98.6414 Y57.0607
+X99.7021 Y56.0000
+X100.7627 Y57.0607
+X101.8234 Y56.0000
+X102.8840 Y57.0607
+X103.9447 Y56.0000
+X105.0054 Y57.0607
+X106.0660 Y56.0000
+Y58.0000
+X105.0054 Y59.0607
+X103.9447 Y58.0000
+X102.8840 Y59.0607
+X101.8234 Y58.0000
+X100.7627 Y59.0607
+X99.7021 Y58.0000
+X98.6414 Y59.0607
+X97.5807 Y58.0000
+X96.5201 Y59.0607
+X95.4594 Y58.0000
+X94.3988 Y59.0607
+X93.3381 Y58.0000
+X92.2774 Y59.0607
+X91.2168 Y58.0000
+X90.1561 Y59.0607
+X89.0955 Y58.0000
+X88.0348 Y59.0607
+X86.9741 Y58.0000
+X85.9135 Y59.0607
+X84.8528 Y58.0000
+X83.7922 Y59.0607
+X82.7315 Y58.0000
+X81.6708 Y59.0607
+X80.6102 Y58.0000
+X79.5495 Y59.0607
+X78.4889 Y58.0000
+X77.4282 Y59.0607
+X76.3675 Y58.0000
+X75.3069 Y59.0607
+X74.2462 Y58.0000
+X73.1856 Y59.0607
+X72.1249 Y58.0000
+X71.0642 Y59.0607
+X70.0036 Y58.0000
+X68.9429 Y59.0607
+X67.8823 Y58.0000
+X66.8216 Y59.0607
+X65.7609 Y58.0000
+X64.7003 Y59.0607
+X63.6396 Y58.0000
+X62.5790 Y59.0607
+X61.5183 Y58.0000
+X60.4576 Y59.0607
+X59.3970 Y58.0000
+X58.3363 Y59.0607
+X57.2756 Y58.0000
+X56.2150 Y59.0607
+X55.1543 Y58.0000
+X54.0937 Y59.0607
+X53.0330 Y58.0000
+X51.9723 Y59.0607
+X50.9117 Y58.0000
+X49.8510 Y59.0607
+X48.7904 Y58.0000
+X47.7297 Y59.0607
+X46.6690 Y58.0000
+X45.6084 Y59.0607
+X44.5477 Y58.0000
+X43.4871 Y59.0607
+X42.4264 Y58.0000
+X41.3657 Y59.0607
+X40.3051 Y58.0000
+X39.2444 Y59.0607
+X38.1838 Y58.0000
+X37.1231 Y59.0607
+X36.0624 Y58.0000
+X35.0018 Y59.0607
+X33.9411 Y58.0000
+X32.8805 Y59.0607
+X31.8198 Y58.0000
+X30.7591 Y59.0607
+X29.6985 Y58.0000
+X28.6378 Y59.0607
+X27.5772 Y58.0000
+X26.5165 Y59.0607
+X25.4558 Y58.0000
+X24.3952 Y59.0607
+X23.3345 Y58.0000
+X22.2739 Y59.0607
+X21.2132 Y58.0000
+X20.1525 Y59.0607
+X19.0919 Y58.0000
+X18.0312 Y59.0607
+X16.9706 Y58.0000
+X15.9099 Y59.0607
+X14.8492 Y58.0000
+X13.7886 Y59.0607
+X12.7279 Y58.0000
+X11.6673 Y59.0607
+X10.6066 Y58.0000
+X9.5459 Y59.0607
+X8.4853 Y58.0000
+X7.4246 Y59.0607
+X6.3640 Y58.0000
+X5.3033 Y59.0607
+X4.2426 Y58.0000
+X3.1820 Y59.0607
+X2.1213 Y58.0000
+X1.0607 Y59.0607
+X0.0000 Y58.0000
+Y60.0000
+X1.0607 Y61.0607
+X2.1213 Y60.0000
+X3.1820 Y61.0607
+X4.2426 Y60.0000
+X5.3033 Y61.0607
+X6.3640 Y60.0000
+X7.4246 Y61.0607
+X8.4853 Y60.0000
+X9.5459 Y61.0607
+X10.6066 Y60.0000
+X11.6673 Y61.0607
+X12.7279 Y60.0000
+X13.7886 Y61.0607
+X14.8492 Y60.0000
+X15.9099 Y61.0607
+X16.9706 Y60.0000
+X18.0312 Y61.0607
+X19.0919 Y60.0000
+X20.1525 Y61.0607
+X21.2132 Y60.0000
+X22.2739 Y61.0607
+X23.3345 Y60.0000
+X24.3952 Y61.0607
+X25.4558 Y60.0000
+X26.5165 Y61.0607
+X27.5772 Y60.0000
+X28.6378 Y61.0607
+X29.6985 Y60.0000
+X30.7591 Y61.0607
+X31.8198 Y60.0000
+X32.8805 Y61.0607
+X33.9411 Y60.0000
+X35.0018 Y61.0607
+X36.0624 Y60.0000
+X37.1231 Y61.0607
+X38.1838 Y60.0000
+X39.2444 Y61.0607
+X40.3051 Y60.0000
+X41.3657 Y61.0607
+X42.4264 Y60.0000
+X43.4871 Y61.0607
+X44.5477 Y60.0000
+X45.6084 Y61.0607
+X46.6690 Y60.0000
+X47.7297 Y61.0607
+X48.7904 Y60.0000
+X49.8510 Y61.0607
+X50.9117 Y60.0000
+X51.9723 Y61.0607
+X53.0330 Y60.0000
+X54.0937 Y61.0607
+X55.1543 Y60.0000
+X56.2150 Y61.0607
+X57.2756 Y60.0000
+X58.3363 Y61.0607
+X59.3970 Y60.0000
+X60.4576 Y61.0607
+X61.5183 Y60.0000
+X62.5790 Y61.0607
+X63.6396 Y60.0000
+X64.7003 Y61.0607
+X65.7609 Y60.0000
+X66.8216 Y61.0607
+X67.8823 Y60.0000
+X68.9429 Y61.0607
+X70.0036 Y60.0000
+X71.0642 Y61.0607
+X72.1249 Y60.0000
+X73.1856 Y61.0607
+X74.2462 Y60.0000
+X75.3069 Y61.0607
+X76.3675 Y60.0000
+X77.4282 Y61.0607
+X78.4889 Y60.0000
+X79.5495 Y61.0607
+X80.6102 Y60.0000
+X81.6708 Y61.0607
+X82.7315 Y60.0000
+X83.7922 Y61.0607
+X84.8528 Y60.0000
+X85.9135 Y61.0607
+X86.9741 Y60.0000
+X88.0348 Y61.0607
+X89.0955 Y60.0000
+X90.1561 Y61.0607
+X91.2168 Y60.0000
+X92.2774 Y61.0607
+X93.3381 Y60.0000
+X94.3988 Y61.0607
+X95.4594 Y60.0000
+X96.5201 Y61.0607
+X97.5807 Y60.0000
+X98.6414 Y61.0607
+X99.7021 Y60.0000
+X100.7627 Y61.0607
+X101.8234 Y60.0000
+X102.8840 Y61.0607
+X103.9447 Y60.0000
+X105.0054 Y61.0607
+X106.0660 Y60.0000
+Y62.0000
+X105.0054 Y63.0607
+X103.9447 Y62.0000
+X102.8840 Y63.0607
+X101.8234 Y62.0000
+X100.7627 Y63.0607
+X99.7021 Y62.0000
+X98.6414 Y63.0607
+X97.5807 Y62.0000
+X96.5201 Y63.0607
+X95.4594 Y62.0000
+X94.3988 Y63.0607
+X93.3381 Y62.0000
+X92.2774 Y63.0607
+X91.2168 Y62.0000
+X90.1561 Y63.0607
+X89.0955 Y62.0000
+X88.0348 Y63.0607
+X86.9741 Y62.0000
+X85.9135 Y63.0607
+X84.8528 Y62.0000
+X83.7922 Y63.0607
+X82.7315 Y62.0000
+X81.6708 Y63.0607
+X80.6102 Y62.0000
+X79.5495 Y63.0607
+X78.4889 Y62.0000
+X77.4282 Y63.0607
+X76.3675 Y62.0000
+X75.3069 Y63.0607
+X74.2462 Y62.0000
+X73.1856 Y63.0607
+X72.1249 Y62.0000
+X71.0642 Y63.0607
+X70.0036 Y62.0000
+X68.9429 Y63.0607
+X67.8823 Y62.0000
+X66.8216 Y63.0607
+X65.7609 Y62.0000
+X64.7003 Y63.0607
+X63.6396 Y62.0000
+X62.5790 Y63.0607
+X61.5183 Y62.0000
+X60.4576 Y63.0607
+X59.3970 Y62.0000
+X58.3363 Y63.0607
+X57.2756 Y62.0000
+X56.2150 Y63.0607
+X55.1543 Y62.0000
+X54.0937 Y63.0607
+X53.0330 Y62.0000
+X51.9723 Y63.0607
+X50.9117 Y62.0000
+X49.8510 Y63.0607
+X48.7904 Y62.0000
+X47.7297 Y63.0607
+X46.6690 Y62.0000
+X45.6084 Y63.0607
+X44.5477 Y62.0000
+X43.4871 Y63.0607
+X42.4264 Y62.0000
+X41.3657 Y63.0607
+X40.3051 Y62.0000
+X39.2444 Y63.0607
+X38.1838 Y62.0000
+X37.1231 Y63.0607
+X36.0624 Y62.0000
+X35.0018 Y63.0607
+X33.9411 Y62.0000
+X32.8805 Y63.0607
+X31.8198 Y62.0000
+X30.7591 Y63.0607
+X29.6985 Y62.0000
+X28.6378 Y63.0607
+X27.5772 Y62.0000
+X26.5165 Y63.0607
+X25.4558 Y62.0000
+X24.3952 Y63.0607
+X23.3345 Y62.0000
+X22.2739 Y63.0607
+X21.2132 Y62.0000
+X20.1525 Y63.0607
+X19.0919 Y62.0000
+X18.0312 Y63.0607
+X16.9706 Y62.0000
+X15.9099 Y63.0607
+X14.8492 Y62.0000
+X13.7886 Y63.0607
+X12.7279 Y62.0000
+X11.6673 Y63.0607
+X10.6066 Y62.0000
+X9.5459 Y63.0607
+X8.4853 Y62.0000
+X7.4246 Y63.0607
+X6.3640 Y62.0000
+X5.3033 Y63.0607
+X4.2426 Y62.0000
+X3.1820 Y63.0607
+X2.1213 Y62.0000
+X1.0607 Y63.0607
+X0.0000 Y62.0000
+Y64.0000
+X1.0607 Y65.0607
+X2.1213 Y64.0000
+X3.1820 Y65.0607
+X4.2426 Y64.0000
+X5.3033 Y65.0607
+X6.3640 Y64.0000
+X7.4246 Y65.0607
+X8.4853 Y64.0000
+X9.5459 Y65.0607
+X10.6066 Y64.0000
+X11.6673 Y65.0607
+X12.7279 Y64.0000
+X13.7886 Y65.0607
+X14.8492 Y64.0000
+X15.9099 Y65.0607
+X16.9706 Y64.0000
+X18.0312 Y65.0607
+X19.0919 Y64.0000
+X20.1525 Y65.0607
+X21.2132 Y64.0000
+X22.2739 Y65.0607
+X23.3345 Y64.0000
+X24.3952 Y65.0607
+X25.4558 Y64.0000
+X26.5165 Y65.0607
+X27.5772 Y64.0000
+X28.6378 Y65.0607
+X29.6985 Y64.0000
+X30.7591 Y65.0607
+X31.8198 Y64.0000
+X32.8805 Y65.0607
+X33.9411 Y64.0000
+X35.0018 Y65.0607
+X36.0624 Y64.0000
+X37.1231 Y65.0607
+X38.1838 Y64.0000
+X39.2444 Y65.0607
+X40.3051 Y64.0000
+X41.3657 Y65.0607
+X42.4264 Y64.0000
+X43.4871 Y65.0607
+X44.5477 Y64.0000
+X45.6084 Y65.0607
+X46.6690 Y64.0000
+X47.7297 Y65.0607
+X48.7904 Y64.0000
+X49.8510 Y65.0607
+X50.9117 Y64.0000
+X51.9723 Y65.0607
+X53.0330 Y64.0000
+X54.0937 Y65.0607
+X55.1543 Y64.0000
+X56.2150 Y65.0607
+X57.2756 Y64.0000
+X58.3363 Y65.0607
+X59.3970 Y64.0000
+X60.4576 Y65.0607
+X61.5183 Y64.0000
+X62.5790 Y65.0607
+X63.6396 Y64.0000
+X64.7003 Y65.0607
+X65.7609 Y64.0000
+X66.8216 Y65.0607
+X67.8823 Y64.0000
+X68.9429 Y65.0607
+X70.0036 Y64.0000
+X71.0642 Y65.0607
+X72.1249 Y64.0000
+X73.1856 Y65.0607
+X74.2462 Y64.0000
+X75.3069 Y65.0607
+X76.3675 Y64.0000
+X77.4282 Y65.0607
+X78.4889 Y64.0000
+X79.5495 Y65.0607
+X80.6102 Y64.0000
+X81.6708 Y65.0607
+X82.7315 Y64.0000
+X83.7922 Y65.0607
+X84.8528 Y64.0000
+X85.9135 Y65.0607
+X86.9741 Y64.0000
+X88.0348 Y65.0607
+X89.0955 Y64.0000
+X90.1561 Y65.0607
+X91.2168 Y64.0000
+X92.2774 Y65.0607
+X93.3381 Y64.0000
+X94.3988 Y65.0607
+X95.4594 Y64.0000
+X96.5201 Y65.0607
+X97.5807 Y64.0000
+X98.6414 Y65.0607
+X99.7021 Y64.0000
+X100.7627 Y65.0607
+X101.8234 Y64.0000
+X102.8840 Y65.0607
+X103.9447 Y64.0000
+X105.0054 Y65.0607
+X106.0660 Y64.0000
+Y66.0000
+X105.0054 Y67.0607
+X103.9447 Y66.0000
+X102.8840 Y67.0607
+X101.8234 Y66.0000
+X100.7627 Y67.0607
+X99.7021 Y66.0000
+X98.6414 Y67.0607
+X97.5807 Y66.0000
+X96.5201 Y67.0607
+X95.4594 Y66.0000
+X94.3988 Y67.0607
+X93.3381 Y66.0000
+X92.2774 Y67.0607
+X91.2168 Y66.0000
+X90.1561 Y67.0607
+X89.0955 Y66.0000
+X88.0348 Y67.0607
+X86.9741 Y66.0000
+X85.9135 Y67.0607
+X84.8528 Y66.0000
+X83.7922 Y67.0607
+X82.7315 Y66.0000
+X81.6708 Y67.0607
+X80.6102 Y66.0000
+X79.5495 Y67.0607
+X78.4889 Y66.0000
+X77.4282 Y67.0607
+X76.3675 Y66.0000
+X75.3069 Y67.0607
+X74.2462 Y66.0000
+X73.1856 Y67.0607
+X72.1249 Y66.0000
+X71.0642 Y67.0607
+X70.0036 Y66.0000
+X68.9429 Y67.0607
+X67.8823 Y66.0000
+X66.8216 Y67.0607
+X65.7609 Y66.0000
+X64.7003 Y67.0607
+X63.6396 Y66.0000
+X62.5790 Y67.0607
+X61.5183 Y66.0000
+X60.4576 Y67.0607
+X59.3970 Y66.0000
+X58.3363 Y67.0607
+X57.2756 Y66.0000
+X56.2150 Y67.0607
+X55.1543 Y66.0000
+X54.0937 Y67.0607
+X53.0330 Y66.0000
+X51.9723 Y67.0607
+X50.9117 Y66.0000
+X49.8510 Y67.0607
+X48.7904 Y66.0000
+X47.7297 Y67.0607
+X46.6690 Y66.0000
+X45.6084 Y67.0607
+X44.5477 Y66.0000
+X43.4871 Y67.0607
+X42.4264 Y66.0000
+X41.3657 Y67.0607
+X40.3051 Y66.0000
+X39.2444 Y67.0607
+X38.1838 Y66.0000
+X37.1231 Y67.0607
+X36.0624 Y66.0000
+X35.0018 Y67.0607
+X33.9411 Y66.0000
+X32.8805 Y67.0607
+X31.8198 Y66.0000
+X30.7591 Y67.0607
+X29.6985 Y66.0000
+X28.6378 Y67.0607
+X27.5772 Y66.0000
+X26.5165 Y67.0607
+X25.4558 Y66.0000
+X24.3952 Y67.0607
+X23.3345 Y66.0000
+X22.2739 Y67.0607
+X21.2132 Y66.0000
+X20.1525 Y67.0607
+X19.0919 Y66.0000
+X18.0312 Y67.0607
+X16.9706 Y66.0000
+X15.9099 Y67.0607
+X14.8492 Y66.0000
+X13.7886 Y67.0607
+X12.7279 Y66.0000
+X11.6673 Y67.0607
+X10.6066 Y66.0000
+X9.5459 Y67.0607
+X8.4853 Y66.0000
+X7.4246 Y67.0607
+X6.3640 Y66.0000
+X5.3033 Y67.0607
+X4.2426 Y66.0000
+X3.1820 Y67.0607
+X2.1213 Y66.0000
+X1.0607 Y67.0607
+X0.0000 Y66.0000
+Y68.0000
+X1.0607 Y69.0607
+X2.1213 Y68.0000
+X3.1820 Y69.0607
+X4.2426 Y68.0000
+X5.3033 Y69.0607
+X6.3640 Y68.0000
+X7.4246 Y69.0607
+X8.4853 Y68.0000
+X9.5459 Y69.0607
+X10.6066 Y68.0000
+X11.6673 Y69.0607
+X12.7279 Y68.0000
+X13.7886 Y69.0607
+X14.8492 Y68.0000
+X15.9099 Y69.0607
+X16.9706 Y68.0000
+X18.0312 Y69.0607
+X19.0919 Y68.0000
+X20.1525 Y69.0607
+X21.2132 Y68.0000
+X22.2739 Y69.0607
+X23.3345 Y68.0000
+X24.3952 Y69.0607
+X25.4558 Y68.0000
+X26.5165 Y69.0607
+X27.5772 Y68.0000
+X28.6378 Y69.0607
+X29.6985 Y68.0000
+X30.7591 Y69.0607
+X31.8198 Y68.0000
+X32.8805 Y69.0607
+X33.9411 Y68.0000
+X35.0018 Y69.0607
+X36.0624 Y68.0000
+X37.1231 Y69.0607
+X38.1838 Y68.0000
+X39.2444 Y69.0607
+X40.3051 Y68.0000
+X41.3657 Y69.0607
+X42.4264 Y68.0000
+X43.4871 Y69.0607
+X44.5477 Y68.0000
+X45.6084 Y69.0607
+X46.6690 Y68.0000
+X47.7297 Y69.0607
+X48.7904 Y68.0000
+X49.8510 Y69.0607
+X50.9117 Y68.0000
+X51.9723 Y69.0607
+X53.0330 Y68.0000
+X54.0937 Y69.0607
+X55.1543 Y68.0000
+X56.2150 Y69.0607
+X57.2756 Y68.0000
+X58.3363 Y69.0607
+X59.3970 Y68.0000
+X60.4576 Y69.0607
+X61.5183 Y68.0000
+X62.5790 Y69.0607
+X63.6396 Y68.0000
+X64.7003 Y69.0607
+X65.7609 Y68.0000
+X66.8216 Y69.0607
+X67.8823 Y68.0000
+X68.9429 Y69.0607
+X70.0036 Y68.0000
+X71.0642 Y69.0607
+X72.1249 Y68.0000
+X73.1856 Y69.0607
+X74.2462 Y68.0000
+X75.3069 Y69.0607
+X76.3675 Y68.0000
+X77.4282 Y69.0607
+X78.4889 Y68.0000
+X79.5495 Y69.0607
+X80.6102 Y68.0000
+X81.6708 Y69.0607
+X82.7315 Y68.0000
+X83.7922 Y69.0607
+X84.8528 Y68.0000
+X85.9135 Y69.0607
+X86.9741 Y68.0000
+X88.0348 Y69.0607
+X89.0955 Y68.0000
+X90.1561 Y69.0607
+X91.2168 Y68.0000
+X92.2774 Y69.0607
+X93.3381 Y68.0000
+X94.3988 Y69.0607
+X95.4594 Y68.0000
+X96.5201 Y69.0607
+X97.5807 Y68.0000
+X98.6414 Y69.0607
+X99.7021 Y68.0000
+X100.7627 Y69.0607
+X101.8234 Y68.0000
+X102.8840 Y69.0607
+X103.9447 Y68.0000
+X105.0054 Y69.0607
+X106.0660 Y68.0000
+Y70.0000
+X105.0054 Y71.0607
+X103.9447 Y70.0000
+X102.8840 Y71.0607
+X101.8234 Y70.0000
+X100.7627 Y71.0607
+X99.7021 Y70.0000
+X98.6414 Y71.0607
+X97.5807 Y70.0000
+X96.5201 Y71.0607
+X95.4594 Y70.0000
+X94.3988 Y71.0607
+X93.3381 Y70.0000
+X92.2774 Y71.0607
+X91.2168 Y70.0000
+X90.1561 Y71.0607
+X89.0955 Y70.0000
+X88.0348 Y71.0607
+X86.9741 Y70.0000
+X85.9135 Y71.0607
+X84.8528 Y70.0000
+X83.7922 Y71.0607
+X82.7315 Y70.0000
+X81.6708 Y71.0607
+X80.6102 Y70.0000
+X79.5495 Y71.0607
+X78.4889 Y70.0000
+X77.4282 Y71.0607
+X76.3675 Y70.0000
+X75.3069 Y71.0607
+X74.2462 Y70.0000
+X73.1856 Y71.0607
+X72.1249 Y70.0000
+X71.0642 Y71.0607
+X70.0036 Y70.0000
+X68.9429 Y71.0607
+X67.8823 Y70.0000
+X66.8216 Y71.0607
+X65.7609 Y70.0000
+X64.7003 Y71.0607
+X63.6396 Y70.0000
+X62.5790 Y71.0607
+X61.5183 Y70.0000
+X60.4576 Y71.0607
+X59.3970 Y70.0000
+X58.3363 Y71.0607
+X57.2756 Y70.0000
+X56.2150 Y71.0607
+X55.1543 Y70.0000
+X54.0937 Y71.0607
+X53.0330 Y70.0000
+X51.9723 Y71.0607
+X50.9117 Y70.0000
+X49.8510 Y71.0607
+X48.7904 Y70.0000
+X47.7297 Y71.0607
+X46.6690 Y70.0000
+X45.6084 Y71.0607
+X44.5477 Y70.0000
+X43.4871 Y71.0607
+X42.4264 Y70.0000
+X41.3657 Y71.0607
+X40.3051 Y70.0000
+X39.2444 Y71.0607
+X38.1838 Y70.0000
+X37.1231 Y71.0607
+X36.0624 Y70.0000
+X35.0018 Y71.0607
+X33.9411 Y70.0000
+X32.8805 Y71.0607
+X31.8198 Y70.0000
+X30.7591 Y71.0607
+X29.6985 Y70.0000
+X28.6378 Y71.0607
+X27.5772 Y70.0000
+X26.5165 Y71.0607
+X25.4558 Y70.0000
+X24.3952 Y71.0607
+X23.3345 Y70.0000
+X22.2739 Y71.0607
+X21.2132 Y70.0000
+X20.1525 Y71.0607
+X19.0919 Y70.0000
+X18.0312 Y71.0607
+X16.9706 Y70.0000
+X15.9099 Y71.0607
+X14.8492 Y70.0000
+X13.7886 Y71.0607
+X12.7279 Y70.0000
+X11.6673 Y71.0607
+X10.6066 Y70.0000
+X9.5459 Y71.0607
+X8.4853 Y70.0000
+X7.4246 Y71.0607
+X6.3640 Y70.0000
+X5.3033 Y71.0607
+X4.2426 Y70.0000
+X3.1820 Y71.0607
+X2.1213 Y70.0000
+X1.0607 Y71.0607
+X0.0000 Y70.0000
+Y72.0000
+X1.0607 Y73.0607
+X2.1213 Y72.0000
+X3.1820 Y73.0607
+X4.2426 Y72.0000
+X5.3033 Y73.0607
+X6.3640 Y72.0000
+X7.4246 Y73.0607
+X8.4853 Y72.0000
+X9.5459 Y73.0607
+X10.6066 Y72.0000
+X11.6673 Y73.0607
+X12.7279 Y72.0000
+X13.7886 Y73.0607
+X14.8492 Y72.0000
+X15.9099 Y73.0607
+X16.9706 Y72.0000
+X18.0312 Y73.0607
+X19.0919 Y72.0000
+X20.1525 Y73.0607
+X21.2132 Y72.0000
+X22.2739 Y73.0607
+X23.3345 Y72.0000
+X24.3952 Y73.0607
+X25.4558 Y72.0000
+X26.5165 Y73.0607
+X27.5772 Y72.0000
+X28.6378 Y73.0607
+X29.6985 Y72.0000
+X30.7591 Y73.0607
+X31.8198 Y72.0000
+X32.8805 Y73.0607
+X33.9411 Y72.0000
+X35.0018 Y73.0607
+X36.0624 Y72.0000
+X37.1231 Y73.0607
+X38.1838 Y72.0000
+X39.2444 Y73.0607
+X40.3051 Y72.0000
+X41.3657 Y73.0607
+X42.4264 Y72.0000
+X43.4871 Y73.0607
+X44.5477 Y72.0000
+X45.6084 Y73.0607
+X46.6690 Y72.0000
+X47.7297 Y73.0607
+X48.7904 Y72.0000
+X49.8510 Y73.0607
+X50.9117 Y72.0000
+X51.9723 Y73.0607
+X53.0330 Y72.0000
+X54.0937 Y73.0607
+X55.1543 Y72.0000
+X56.2150 Y73.0607
+X57.2756 Y72.0000
+X58.3363 Y73.0607
+X59.3970 Y72.0000
+X60.4576 Y73.0607
+X61.5183 Y72.0000
+X62.5790 Y73.0607
+X63.6396 Y72.0000
+X64.7003 Y73.0607
+X65.7609 Y72.0000
+X66.8216 Y73.0607
+X67.8823 Y72.0000
+X68.9429 Y73.0607
+X70.0036 Y72.0000
+X71.0642 Y73.0607
+X72.1249 Y72.0000
+X73.1856 Y73.0607
+X74.2462 Y72.0000
+X75.3069 Y73.0607
+X76.3675 Y72.0000
+X77.4282 Y73.0607
+X78.4889 Y72.0000
+X79.5495 Y73.0607
+X80.6102 Y72.0000
+X81.6708 Y73.0607
+X82.7315 Y72.0000
+X83.7922 Y73.0607
+X84.8528 Y72.0000
+X85.9135 Y73.0607
+X86.9741 Y72.0000
+X88.0348 Y73.0607
+X89.0955 Y72.0000
+X90.1561 Y73.0607
+X91.2168 Y72.0000
+X92.2774 Y73.0607
+X93.3381 Y72.0000
+X94.3988 Y73.0607
+X95.4594 Y72.0000
+X96.5201 Y73.0607
+X97.5807 Y72.0000
+X98.6414 Y73.0607
+X99.7021 Y72.0000
+X100.7627 Y73.0607
+X101.8234 Y72.0000
+X102.8840 Y73.0607
+X103.9447 Y72.0000
+X105.0054 Y73.0607
+X106.0660 Y72.0000
+Y74.0000
+X105.0054 Y75.0607
+X103.9447 Y74.0000
+X102.8840 Y75.0607
+X101.8234 Y74.0000
+X100.7627 Y75.0607
+X99.7021 Y74.0000
+X98.6414 Y75.0607
+X97.5807 Y74.0000
+X96.5201 Y75.0607
+X95.4594 Y74.0000
+X94.3988 Y75.0607
+X93.3381 Y74.0000
+X92.2774 Y75.0607
+X91.2168 Y74.0000
+X90.1561 Y75.0607
+X89.0955 Y74.0000
+X88.0348 Y75.0607
+X86.9741 Y74.0000
+X85.9135 Y75.0607
+X84.8528 Y74.0000
+X83.7922 Y75.0607
+X82.7315 Y74.0000
+X81.6708 Y75.0607
+X80.6102 Y74.0000
+X79.5495 Y75.0607
+X78.4889 Y74.0000
+X77.4282 Y75.0607
+X76.3675 Y74.0000
+X75.3069 Y75.0607
+X74.2462 Y74.0000
+X73.1856 Y75.0607
+X72.1249 Y74.0000
+X71.0642 Y75.0607
+X70.0036 Y74.0000
+X68.9429 Y75.0607
+X67.8823 Y74.0000
+X66.8216 Y75.0607
+X65.7609 Y74.0000
+X64.7003 Y75.0607
+X63.6396 Y74.0000
+X62.5790 Y75.0607
+X61.5183 Y74.0000
+X60.4576 Y75.0607
+X59.3970 Y74.0000
+X58.3363 Y75.0607
+X57.2756 Y74.0000
+X56.2150 Y75.0607
+X55.1543 Y74.0000
+X54.0937 Y75.0607
+X53.0330 Y74.0000
+X51.9723 Y75.0607
+X50.9117 Y74.0000
+X49.8510 Y75.0607
+X48.7904 Y74.0000
+X47.7297 Y75.0607
+X46.6690 Y74.0000
+X45.6084 Y75.0607
+X44.5477 Y74.0000
+X43.4871 Y75.0607
+X42.4264 Y74.0000
+X41.3657 Y75.0607
+X40.3051 Y74.0000
+X39.2444 Y75.0607
+X38.1838 Y74.0000
+X37.1231 Y75.0607
+X36.0624 Y74.0000
+X35.0018 Y75.0607
+X33.9411 Y74.0000
+X32.8805 Y75.0607
+X31.8198 Y74.0000
+X30.7591 Y75.0607
+X29.6985 Y74.0000
+X28.6378 Y75.0607
+X27.5772 Y74.0000
+X26.5165 Y75.0607
+X25.4558 Y74.0000
+X24.3952 Y75.0607
+X23.3345 Y74.0000
+X22.2739 Y75.0607
+X21.2132 Y74.0000
+X20.1525 Y75.0607
+X19.0919 Y74.0000
+X18.0312 Y75.0607
+X16.9706 Y74.0000
+X15.9099 Y75.0607
+X14.8492 Y74.0000
+X13.7886 Y75.0607
+X12.7279 Y74.0000
+X11.6673 Y75.0607
+X10.6066 Y74.0000
+X9.5459 Y75.0607
+X8.4853 Y74.0000
+X7.4246 Y75.0607
+X6.3640 Y74.0000
+X5.3033 Y75.0607
+X4.2426 Y74.0000
+X3.1820 Y75.0607
+X2.1213 Y74.0000
+X1.0607 Y75.0607
+X0.0000 Y74.0000
+Y76.0000
+X1.0607 Y77.0607
+X2.1213 Y76.0000
+X3.1820 Y77.0607
+X4.2426 Y76.0000
+X5.3033 Y77.0607
+X6.3640 Y76.0000
+X7.4246 Y77.0607
+X8.4853 Y76.0000
+X9.5459 Y77.0607
+X10.6066 Y76.0000
+X11.6673 Y77.0607
+X12.7279 Y76.0000
+X13.7886 Y77.0607
+X14.8492 Y76.0000
+X15.9099 Y77.0607
+X16.9706 Y76.0000
+X18.0312 Y77.0607
+X19.0919 Y76.0000
+X20.1525 Y77.0607
+X21.2132 Y76.0000
+X22.2739 Y77.0607
+X23.3345 Y76.0000
+X24.3952 Y77.0607
+X25.4558 Y76.0000
+X26.5165 Y77.0607
+X27.5772 Y76.0000
+X28.6378 Y77.0607
+X29.6985 Y76.0000
+X30.7591 Y77.0607
+X31.8198 Y76.0000
+X32.8805 Y77.0607
+X33.9411 Y76.0000
+X35.0018 Y77.0607
+X36.0624 Y76.0000
+X37.1231 Y77.0607
+X38.1838 Y76.0000
+X39.2444 Y77.0607
+X40.3051 Y76.0000
+X41.3657 Y77.0607
+X42.4264 Y76.0000
+X43.4871 Y77.0607
+X44.5477 Y76.0000
+X45.6084 Y77.0607
+X46.6690 Y76.0000
+X47.7297 Y77.0607
+X48.7904 Y76.0000
+X49.8510 Y77.0607
+X50.9117 Y76.0000
+X51.9723 Y77.0607
+X53.0330 Y76.0000
+X54.0937 Y77.0607
+X55.1543 Y76.0000
+X56.2150 Y77.0607
+X57.2756 Y76.0000
+X58.3363 Y77.0607
+X59.3970 Y76.0000
+X60.4576 Y77.0607
+X61.5183 Y76.0000
+X62.5790 Y77.0607
+X63.6396 Y76.0000
+X64.7003 Y77.0607
+X65.7609 Y76.0000
+X66.8216 Y77.0607
+X67.8823 Y76.0000
+X68.9429 Y77.0607
+X70.0036 Y76.0000
+X71.0642 Y77.0607
+X72.1249 Y76.0000
+X73.1856 Y77.0607
+X74.2462 Y76.0000
+X75.3069 Y77.0607
+X76.3675 Y76.0000
+X77.4282 Y77.0607
+X78.4889 Y76.0000
+X79.5495 Y77.0607
+X80.6102 Y76.0000
+X81.6708 Y77.0607
+X82.7315 Y76.0000
+X83.7922 Y77.0607
+X84.8528 Y76.0000
+X85.9135 Y77.0607
+X86.9741 Y76.0000
+X88.0348 Y77.0607
+X89.0955 Y76.0000
+X90.1561 Y77.0607
+X91.2168 Y76.0000
+X92.2774 Y77.0607
+X93.3381 Y76.0000
+X94.3988 Y77.0607
+X95.4594 Y76.0000
+X96.5201 Y77.0607
+X97.5807 Y76.0000
+X98.6414 Y77.0607
+X99.7021 Y76.0000
+X100.7627 Y77.0607
+X101.8234 Y76.0000
+X102.8840 Y77.0607
+X103.9447 Y76.0000
+X105.0054 Y77.0607
+X106.0660 Y76.0000
+Y78.0000
+X105.0054 Y79.0607
+X103.9447 Y78.0000
+X102.8840 Y79.0607
+X101.8234 Y78.0000
+X100.7627 Y79.0607
+X99.7021 Y78.0000
+X98.6414 Y79.0607
+X97.5807 Y78.0000
+X96.5201 Y79.0607
+X95.4594 Y78.0000
+X94.3988 Y79.0607
+X93.3381 Y78.0000
+X92.2774 Y79.0607
+X91.2168 Y78.0000
+X90.1561 Y79.0607
+X89.0955 Y78.0000
+X88.0348 Y79.0607
+X86.9741 Y78.0000
+X85.9135 Y79.0607
+X84.8528 Y78.0000
+X83.7922 Y79.0607
+X82.7315 Y78.0000
+X81.6708 Y79.0607
+X80.6102 Y78.0000
+X79.5495 Y79.0607
+X78.4889 Y78.0000
+X77.4282 Y79.0607
+X76.3675 Y78.0000
+X75.3069 Y79.0607
+X74.2462 Y78.0000
+X73.1856 Y79.0607
+X72.1249 Y78.0000
+X71.0642 Y79.0607
+X70.0036 Y78.0000
+X68.9429 Y79.0607
+X67.8823 Y78.0000
+X66.8216 Y79.0607
+X65.7609 Y78.0000
+X64.7003 Y79.0607
+X63.6396 Y78.0000
+X62.5790 Y79.0607
+X61.5183 Y78.0000
+X60.4576 Y79.0607
+X59.3970 Y78.0000
+X58.3363 Y79.0607
+X57.2756 Y78.0000
+X56.2150 Y79.0607
+X55.1543 Y78.0000
+X54.0937 Y79.0607
+X53.0330 Y78.0000
+X51.9723 Y79.0607
+X50.9117 Y78.0000
+X49.8510 Y79.0607
+X48.7904 Y78.0000
+X47.7297 Y79.0607
+X46.6690 Y78.0000
+X45.6084 Y79.0607
+X44.5477 Y78.0000
+X43.4871 Y79.0607
+X42.4264 Y78.0000
+X41.3657 Y79.0607
+X40.3051 Y78.0000
+X39.2444 Y79.0607
+X38.1838 Y78.0000
+X37.1231 Y79.0607
+X36.0624 Y78.0000
+X35.0018 Y79.0607
+X33.9411 Y78.0000
+X32.8805 Y79.0607
+X31.8198 Y78.0000
+X30.7591 Y79.0607
+X29.6985 Y78.0000
+X28.6378 Y79.0607
+X27.5772 Y78.0000
+X26.5165 Y79.0607
+X25.4558 Y78.0000
+X24.3952 Y79.0607
+X23.3345 Y78.0000
+X22.2739 Y79.0607
+X21.2132 Y78.0000
+X20.1525 Y79.0607
+X19.0919 Y78.0000
+X18.0312 Y79.0607
+X16.9706 Y78.0000
+X15.9099 Y79.0607
+X14.8492 Y78.0000
+X13.7886 Y79.0607
+X12.7279 Y78.0000
+X11.6673 Y79.0607
+X10.6066 Y78.0000
+X9.5459 Y79.0607
+X8.4853 Y78.0000
+X7.4246 Y79.0607
+X6.3640 Y78.0000
+X5.3033 Y79.0607
+X4.2426 Y78.0000
+X3.1820 Y79.0607
+X2.1213 Y78.0000
+X1.0607 Y79.0607
+X0.0000 Y78.0000
+Y80.0000
+G0 X0 Y0
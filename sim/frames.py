@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+"""Converts a simple g-code program into binary motion frames.
+
+    frames.py [-a axes] [-r pitch] in.nc > out.nc
+
+Handles programs of G0 and G1 moves in absolute millimetres (G21 G90 G94)
+with no work offsets, starting from the origin, as CAM output for lasers and
+polylines usually is. Moves become frames of up to seven moves each (see
+Grbl_Esp32/src/Frames.h); lines that set a mode without moving, such as
+"G1 F6000", are folded into the moves that follow; anything else, including
+comments and $ settings, is passed through as it is.
+
+With -r, runs of G1 moves along one axis, each a whole number of pixels of
+the given pitch long, become raster frames instead: one move for the run,
+with the S word of each move as the power of its pixels.
+"""
+
+import base64
+import binascii
+import re
+import struct
+import sys
+
+FRAME_MAX_SIZE = 189  # Frame bytes in a line of LINE_BUFFER_SIZE (256)
+MOTION = ord("M")
+RASTER = ord("R")
+AXES = "XYZABC"
+
+
+def frame(kind, payload):
+    data = bytes([len(payload), kind]) + payload
+    return ":" + base64.b64encode(data + struct.pack("<H", binascii.crc_hqx(data, 0xFFFF))).decode()
+
+
+def main():
+    args = sys.argv[1:]
+    n_axis = 3
+    pitch = 0.0
+    while len(args) > 2 and args[0] in ("-a", "-r"):
+        if args[0] == "-a":
+            n_axis = int(args[1])
+        else:
+            pitch = float(args[1])
+        args = args[2:]
+    if len(args) != 1:
+        sys.exit(__doc__)
+
+    record = "<Iff%df" % n_axis
+    move_size = struct.calcsize(record)
+    per_frame = (FRAME_MAX_SIZE - 4 - 1) // move_size
+    max_pixels = FRAME_MAX_SIZE - 4 - 1 - move_size
+    position = [0.0] * n_axis
+    motion, feed, speed = 0, 0.0, 0.0
+    moves = []
+    raster = None  # Line, axis, direction, feed, speeds of the pixels and end of the run
+
+    def flush_moves():
+        if moves:
+            print(frame(MOTION, bytes([n_axis]) + b"".join(moves)))
+            moves.clear()
+
+    def flush_raster():
+        nonlocal raster
+        if raster:
+            number, _, _, rate, pixels, end = raster
+            full = max(max(pixels), 1.0)
+            power = bytes(round(s * 255 / full) for s in pixels)
+            print(frame(RASTER, bytes([n_axis]) + struct.pack(record, number, rate, full, *end) + power))
+            raster = None
+
+    def flush():
+        flush_moves()
+        flush_raster()
+
+    # Returns the pixels of a move that can be part of a raster, or None.
+    def raster_pixels(start, end):
+        changed = [idx for idx in range(n_axis) if end[idx] != start[idx]]
+        if not pitch or motion != 1 or len(changed) != 1:
+            return None
+        length = abs(end[changed[0]] - start[changed[0]])
+        count = round(length / pitch)
+        if count == 0 or abs(count * pitch - length) > 0.01 * pitch:
+            return None
+        return changed[0], 1 if end[changed[0]] > start[changed[0]] else -1, count
+
+    with open(args[0]) as f:
+        for number, line in enumerate(f, 1):
+            words = re.findall(r"([A-Z])\s*([-+]?[0-9.]+)", line.split(";")[0].upper())
+            letters = {letter for letter, _ in words}
+            if not words or "$" in line or not letters <= set("GFSN" + AXES[:n_axis]):
+                flush()
+                print(line, end="")
+                speed = next((float(value) for letter, value in words if letter == "S"), speed)
+                continue
+            start = list(position)
+            moved = False
+            for letter, value in words:
+                if letter == "G":
+                    if value in ("0", "00", "1", "01"):
+                        motion = int(value)
+                    elif value not in ("21", "90", "94"):
+                        sys.exit("%s:%d: G%s is not supported" % (args[0], number, value))
+                elif letter == "F":
+                    feed = float(value)
+                elif letter == "S":
+                    speed = float(value)
+                elif letter in AXES:
+                    position[AXES.index(letter)] = float(value)
+                    moved = True
+            if not moved:
+                continue
+            pixels = raster_pixels(start, position)
+            if pixels:
+                axis, direction, count = pixels
+                if raster and (tuple(raster[1:4]) != (axis, direction, feed) or len(raster[4]) + count > max_pixels):
+                    flush_raster()
+                if not raster:
+                    flush_moves()
+                    raster = [number, axis, direction, feed, [], None]
+                raster[4].extend([speed] * count)
+                raster[5] = list(position)
+                continue
+            flush_raster()
+            rate = feed if motion == 1 else 0.0
+            moves.append(struct.pack(record, number, rate, speed, *position))
+            if len(moves) == per_frame:
+                flush_moves()
+    flush()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,253 @@
+#pragma once
+
+/*
+  Arduino.h - host shim of the Arduino-ESP32 core for the Grbl_ESP32 simulator
+
+  Only the pieces that the motion core touches are provided. Anything that
+  talks to real hardware either does nothing or is routed to the simulator's
+  virtual clock (see sim/src/Sim.h).
+
+  Grbl_ESP32 is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <strings.h>
+
+#include "binary.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_timer.h"
+#include "driver/gpio.h"
+
+typedef bool     boolean;
+typedef uint8_t  byte;
+typedef uint16_t word;
+
+#define IRAM_ATTR
+#define NOP() asm volatile("nop")
+
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x01
+#define OUTPUT 0x02
+#define PULLUP 0x04
+#define INPUT_PULLUP 0x05
+#define PULLDOWN 0x08
+#define INPUT_PULLDOWN 0x09
+
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+#define bit(b) (1UL << (b))
+#define radians(deg) ((deg)*DEG_TO_RAD)
+#define degrees(rad) ((rad)*RAD_TO_DEG)
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+inline long map(long x, long in_min, long in_max, long out_min, long out_max) {
+    return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+void     pinMode(uint8_t pin, uint8_t mode);
+void     digitalWrite(uint8_t pin, uint8_t val);
+int      digitalRead(uint8_t pin);
+uint32_t millis();
+uint32_t micros();
+void     delay(uint32_t ms);
+void     delayMicroseconds(uint32_t us);
+
+void attachInterrupt(uint8_t pin, void (*)(void), int mode);
+void detachInterrupt(uint8_t pin);
+
+#define digitalPinToInterrupt(p) (p)
+
+// The host has no PSRAM; esp32-hal-psram.h callers fall back to the heap.
+inline bool psramFound() {
+    return false;
+}
+inline void* ps_calloc(size_t n, size_t size) {
+    return calloc(n, size);
+}
+
+class String {
+    std::string _s;
+
+public:
+    String() {}
+    String(const char* s) : _s(s ? s : "") {}
+    String(const std::string& s) : _s(s) {}
+    String(char c) : _s(1, c) {}
+    String(int v) : _s(std::to_string(v)) {}
+    String(unsigned int v) : _s(std::to_string(v)) {}
+    String(long v) : _s(std::to_string(v)) {}
+    String(unsigned long v) : _s(std::to_string(v)) {}
+    String(float v, unsigned int decimals = 2) {
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%.*f", decimals, v);
+        _s = buf;
+    }
+
+    const char* c_str() const { return _s.c_str(); }
+    unsigned    length() const { return _s.length(); }
+    char        charAt(unsigned i) const { return _s[i]; }
+    char        operator[](unsigned i) const { return _s[i]; }
+    int         indexOf(char c) const {
+        auto pos = _s.find(c);
+        return pos == std::string::npos ? -1 : int(pos);
+    }
+    int indexOf(const char* s) const {
+        auto pos = _s.find(s);
+        return pos == std::string::npos ? -1 : int(pos);
+    }
+    String substring(unsigned from) const { return String(_s.substr(from)); }
+    String substring(unsigned from, unsigned to) const { return String(_s.substr(from, to - from)); }
+    void   toUpperCase() {
+        for (auto& c : _s) {
+            c = toupper(c);
+        }
+    }
+    void toLowerCase() {
+        for (auto& c : _s) {
+            c = tolower(c);
+        }
+    }
+    void replace(char from, char to) {
+        for (auto& c : _s) {
+            if (c == from) {
+                c = to;
+            }
+        }
+    }
+    void toCharArray(char* buf, unsigned len, unsigned index = 0) const {
+        if (len == 0) {
+            return;
+        }
+        strncpy(buf, index < _s.length() ? _s.c_str() + index : "", len - 1);
+        buf[len - 1] = '\0';
+    }
+    void trim() {
+        auto b = _s.find_first_not_of(" \t\r\n");
+        auto e = _s.find_last_not_of(" \t\r\n");
+        _s     = b == std::string::npos ? "" : _s.substr(b, e - b + 1);
+    }
+    int  toInt() const { return atoi(_s.c_str()); }
+    bool startsWith(const char* s) const { return _s.rfind(s, 0) == 0; }
+    bool equals(const char* s) const { return _s == s; }
+
+    void concat(const String& s) { _s += s._s; }
+    void concat(const char* s) { _s += s; }
+    void concat(char c) { _s += c; }
+
+    String& operator=(const char* s) {
+        _s = s ? s : "";
+        return *this;
+    }
+    String& operator+=(const String& s) {
+        _s += s._s;
+        return *this;
+    }
+    String& operator+=(const char* s) {
+        _s += s;
+        return *this;
+    }
+    String& operator+=(char c) {
+        _s += c;
+        return *this;
+    }
+    bool operator==(const String& s) const { return _s == s._s; }
+    bool operator==(const char* s) const { return _s == s; }
+    bool operator!=(const String& s) const { return _s != s._s; }
+    bool operator!=(const char* s) const { return _s != s; }
+
+    friend String operator+(const String& a, const String& b) { return String(a._s + b._s); }
+    friend String operator+(const String& a, const char* b) { return String(a._s + b); }
+    friend String operator+(const char* a, const String& b) { return String(a + b._s); }
+};
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+        size_t n = 0;
+        while (size--) {
+            n += write(*buffer++);
+        }
+        return n;
+    }
+    size_t write(const char* str) { return str ? write((const uint8_t*)str, strlen(str)) : 0; }
+    size_t print(const char* str) { return write(str); }
+    size_t print(const String& s) { return write(s.c_str()); }
+    size_t println(const char* str) { return write(str) + write("\r\n"); }
+    size_t printf(const char* format, ...) {
+        char    buf[256];
+        va_list arg;
+        va_start(arg, format);
+        vsnprintf(buf, sizeof(buf), format, arg);
+        va_end(arg);
+        return write(buf);
+    }
+    virtual void flush() {}
+};
+
+class Stream : public Print {
+public:
+    virtual int    available()                         = 0;
+    virtual int    read()                              = 0;
+    virtual int    peek()                              = 0;
+    virtual size_t readBytes(char* buffer, size_t len) = 0;
+};
+
+class EspClass {
+public:
+    const char* getSdkVersion() { return "host"; }
+    uint32_t    getFreeHeap() { return 0; }
+    void        restart() { exit(0); }
+};
+
+extern EspClass ESP;
+
+class IPAddress {
+    uint32_t _addr = 0;
+
+public:
+    IPAddress() {}
+    IPAddress(uint32_t addr) : _addr(addr) {}
+    operator uint32_t() const { return _addr; }
+    bool fromString(const char* s) {
+        unsigned a, b, c, d;
+        if (sscanf(s, "%u.%u.%u.%u", &a, &b, &c, &d) != 4 || a > 255 || b > 255 || c > 255 || d > 255) {
+            return false;
+        }
+        _addr = a | (b << 8) | (c << 16) | (d << 24);
+        return true;
+    }
+    String toString() const {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%u.%u.%u.%u", _addr & 0xff, (_addr >> 8) & 0xff, (_addr >> 16) & 0xff, _addr >> 24);
+        return String(buf);
+    }
+};
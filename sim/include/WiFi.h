@@ -0,0 +1,19 @@
+#pragma once
+
+// The simulator has no radio. Grbl.cpp switches WiFi off at startup, so
+// only the calls it makes are provided.
+
+#include "Arduino.h"
+
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+
+class WiFiClass {
+public:
+    void persistent(bool) {}
+    bool disconnect(bool = false) { return true; }
+    bool enableSTA(bool) { return true; }
+    bool enableAP(bool) { return true; }
+    bool mode(wifi_mode_t) { return true; }
+};
+
+extern WiFiClass WiFi;
@@ -0,0 +1,5 @@
+#pragma once
+
+#include "esp_err.h"
+
+typedef enum { DAC_CHANNEL_1 = 1, DAC_CHANNEL_2 = 2 } dac_channel_t;
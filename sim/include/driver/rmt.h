@@ -0,0 +1,17 @@
+#pragma once
+
+#include "esp_err.h"
+
+typedef enum { RMT_CHANNEL_0 = 0, RMT_CHANNEL_MAX = 8 } rmt_channel_t;
+
+typedef struct {
+    union {
+        struct {
+            uint32_t duration0 : 15;
+            uint32_t level0 : 1;
+            uint32_t duration1 : 15;
+            uint32_t level1 : 1;
+        };
+        uint32_t val;
+    };
+} rmt_item32_t;
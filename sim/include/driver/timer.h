@@ -0,0 +1,52 @@
+#pragma once
+
+// ESP-IDF general purpose timer shim. The simulator's virtual step timer
+// (sim/src/Sim.cpp) implements these calls, so the stepper ISR in
+// Stepper.cpp runs unmodified against virtual time.
+
+#include <cstdint>
+#include "esp_err.h"
+
+typedef enum { TIMER_GROUP_0 = 0, TIMER_GROUP_1 = 1 } timer_group_t;
+typedef enum { TIMER_0 = 0, TIMER_1 = 1 } timer_idx_t;
+typedef enum { TIMER_COUNT_DOWN = 0, TIMER_COUNT_UP = 1 } timer_count_dir_t;
+typedef enum { TIMER_PAUSE = 0, TIMER_START = 1 } timer_start_t;
+typedef enum { TIMER_ALARM_DIS = 0, TIMER_ALARM_EN = 1 } timer_alarm_t;
+typedef enum { TIMER_INTR_LEVEL = 0 } timer_intr_mode_t;
+typedef enum { TIMER_AUTORELOAD_DIS = 0, TIMER_AUTORELOAD_EN = 1 } timer_autoreload_t;
+
+typedef struct {
+    timer_alarm_t     alarm_en;
+    timer_start_t     counter_en;
+    timer_intr_mode_t intr_type;
+    timer_count_dir_t counter_dir;
+    bool              auto_reload;
+    uint32_t          divider;
+} timer_config_t;
+
+typedef void* timer_isr_handle_t;
+
+// Just enough of the timer group register block for the stepper ISR.
+typedef struct {
+    struct {
+        struct {
+            uint32_t alarm_en;
+        } config;
+    } hw_timer[2];
+    struct {
+        uint32_t t0;
+        uint32_t t1;
+    } int_clr_timers;
+} timg_dev_t;
+
+extern timg_dev_t TIMERG0;
+extern timg_dev_t TIMERG1;
+
+esp_err_t timer_init(timer_group_t group, timer_idx_t idx, const timer_config_t* config);
+esp_err_t timer_set_counter_value(timer_group_t group, timer_idx_t idx, uint64_t value);
+esp_err_t timer_set_alarm_value(timer_group_t group, timer_idx_t idx, uint64_t value);
+esp_err_t timer_enable_intr(timer_group_t group, timer_idx_t idx);
+esp_err_t timer_isr_register(
+    timer_group_t group, timer_idx_t idx, void (*fn)(void*), void* arg, int intr_alloc_flags, timer_isr_handle_t* handle);
+esp_err_t timer_start(timer_group_t group, timer_idx_t idx);
+esp_err_t timer_pause(timer_group_t group, timer_idx_t idx);
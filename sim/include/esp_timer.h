@@ -0,0 +1,6 @@
+#pragma once
+
+#include <cstdint>
+
+// Microseconds of virtual time since the simulator started.
+int64_t esp_timer_get_time();
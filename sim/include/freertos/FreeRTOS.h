@@ -0,0 +1,55 @@
+#pragma once
+
+// FreeRTOS shim for the Grbl_ESP32 simulator. The simulator is single
+// threaded, so critical sections are no-ops and tasks are never started.
+
+#include <cstddef>
+#include <cstdint>
+
+typedef uint32_t TickType_t;
+typedef int32_t  BaseType_t;
+typedef uint32_t UBaseType_t;
+typedef void*    TaskHandle_t;
+typedef void*    QueueHandle_t;
+typedef void*    xQueueHandle;
+typedef void*    SemaphoreHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
+#define portMAX_DELAY ((TickType_t)0xffffffffUL)
+#define portTICK_RATE_MS 1
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+typedef struct {
+    uint32_t owner;
+    uint32_t count;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED                                                                                                       \
+    { 0, 0 }
+
+inline void vTaskEnterCritical(portMUX_TYPE*) {}
+inline void vTaskExitCritical(portMUX_TYPE*) {}
+#define portENTER_CRITICAL(mux) vTaskEnterCritical(mux)
+#define portEXIT_CRITICAL(mux) vTaskExitCritical(mux)
+#define portENTER_CRITICAL_ISR(mux) vTaskEnterCritical(mux)
+#define portEXIT_CRITICAL_ISR(mux) vTaskExitCritical(mux)
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task,
+                                   const char*    name,
+                                   uint32_t       stack,
+                                   void*          params,
+                                   UBaseType_t    priority,
+                                   TaskHandle_t*  handle,
+                                   BaseType_t     core);
+BaseType_t xTaskCreate(TaskFunction_t task, const char* name, uint32_t stack, void* params, UBaseType_t priority, TaskHandle_t* handle);
+void       vTaskDelay(TickType_t ticks);
+void       vTaskDelayUntil(TickType_t* previous, TickType_t ticks);
+TickType_t xTaskGetTickCount();
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task);
+uint32_t    xPortGetFreeHeapSize();
+int         xPortGetCoreID();
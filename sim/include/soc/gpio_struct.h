@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+
+// The GPIO output registers that the stepper writes. Each hands what is written to the simulator
+// (see src/Stubs.cpp), which takes the pins as motor step pins.
+void sim_gpio_write(int bank, bool high, uint32_t pins);
+
+class SimGpioReg {
+    int  _bank;
+    bool _high;
+
+public:
+    SimGpioReg(int bank, bool high) : _bank(bank), _high(high) {}
+    void operator=(uint32_t pins) { sim_gpio_write(_bank, _high, pins); }
+};
+
+typedef struct {
+    SimGpioReg out_w1ts { 0, true };
+    SimGpioReg out_w1tc { 0, false };
+    struct {
+        SimGpioReg val { 1, true };
+    } out1_w1ts;
+    struct {
+        SimGpioReg val { 1, false };
+    } out1_w1tc;
+} gpio_dev_t;
+
+extern gpio_dev_t GPIO;
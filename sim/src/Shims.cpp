@@ -0,0 +1,145 @@
+/*
+  Shims.cpp - ESP-IDF, FreeRTOS and Arduino services for the host simulator
+
+  Grbl_ESP32 is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <nvs.h>
+#include <soc/gpio_struct.h>
+
+EspClass  ESP;
+WiFiClass WiFi;
+
+// GPIO. Pins.cpp wraps these for UNDEFINED_PIN and I2S pins.
+
+static uint8_t gpio_level[64];
+
+extern "C" void __pinMode(uint8_t pin, uint8_t mode) {}
+
+extern "C" void __digitalWrite(uint8_t pin, uint8_t val) {
+    if (pin < sizeof(gpio_level)) {
+        gpio_level[pin] = val;
+    }
+}
+
+extern "C" int __digitalRead(uint8_t pin) {
+    return pin < sizeof(gpio_level) ? gpio_level[pin] : 0;
+}
+
+// The output registers. Only the stepper writes them, with a step plan (see Stubs.cpp).
+gpio_dev_t GPIO;
+
+void attachInterrupt(uint8_t pin, void (*)(void), int mode) {}
+void detachInterrupt(uint8_t pin) {}
+
+// FreeRTOS. Nothing runs concurrently with the main loop, so tasks are never
+// started and queues are always empty.
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task,
+                                   const char*    name,
+                                   uint32_t       stack,
+                                   void*          params,
+                                   UBaseType_t    priority,
+                                   TaskHandle_t*  handle,
+                                   BaseType_t     core) {
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t task, const char* name, uint32_t stack, void* params, UBaseType_t priority, TaskHandle_t* handle) {
+    return pdPASS;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+    return 0;
+}
+
+uint32_t xPortGetFreeHeapSize() {
+    return 0;
+}
+
+int xPortGetCoreID() {
+    return 1;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size) {
+    static int queue;
+    return &queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t wait) {
+    return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t wait) {
+    return pdFALSE;
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void* item, BaseType_t* woken) {
+    return pdPASS;
+}
+
+// NVS. Nothing is stored, so every setting starts from its default and
+// changes last only for the run.
+
+esp_err_t nvs_open(const char* name, nvs_open_mode mode, nvs_handle* handle) {
+    *handle = 1;
+    return ESP_OK;
+}
+
+esp_err_t nvs_get_i8(nvs_handle handle, const char* key, int8_t* value) {
+    return ESP_ERR_NVS_NOT_FOUND;
+}
+
+esp_err_t nvs_get_i32(nvs_handle handle, const char* key, int32_t* value) {
+    return ESP_ERR_NVS_NOT_FOUND;
+}
+
+esp_err_t nvs_get_str(nvs_handle handle, const char* key, char* value, size_t* len) {
+    return ESP_ERR_NVS_NOT_FOUND;
+}
+
+esp_err_t nvs_get_blob(nvs_handle handle, const char* key, void* value, size_t* len) {
+    return ESP_ERR_NVS_NOT_FOUND;
+}
+
+esp_err_t nvs_set_i8(nvs_handle handle, const char* key, int8_t value) {
+    return ESP_OK;
+}
+
+esp_err_t nvs_set_i32(nvs_handle handle, const char* key, int32_t value) {
+    return ESP_OK;
+}
+
+esp_err_t nvs_set_str(nvs_handle handle, const char* key, const char* value) {
+    return ESP_OK;
+}
+
+esp_err_t nvs_set_blob(nvs_handle handle, const char* key, const void* value, size_t len) {
+    return ESP_OK;
+}
+
+esp_err_t nvs_erase_key(nvs_handle handle, const char* key) {
+    return ESP_OK;
+}
+
+esp_err_t nvs_erase_all(nvs_handle handle) {
+    return ESP_OK;
+}
+
+esp_err_t nvs_get_stats(const char* part, nvs_stats_t* stats) {
+    memset(stats, 0, sizeof(*stats));
+    return ESP_OK;
+}
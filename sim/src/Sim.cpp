@@ -0,0 +1,646 @@
+/*
+  Sim.cpp - virtual step timer and benchmark instrumentation
+
+  Grbl_ESP32 is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "src/Grbl.h"
+#include "Sim.h"
+
+#include <chrono>
+
+// End of the programmed path so far, in machine coordinates of the motors
+static float last_target[MAX_N_AXIS];
+
+// Where the motors are. With kinematics, this is not the machine position Grbl reports.
+static void motor_position(float* motors) {
+    for (int axis = 0; axis < MAX_N_AXIS; axis++) {
+        motors[axis] = axis < number_axis->get() ? sys_position[axis] / axis_settings[axis]->steps_per_mm->get() : 0.0f;
+    }
+}
+
+namespace Sim {
+    uint64_t now  = 0;
+    uint64_t spin = 0;
+    Stats    stats;
+    FILE*    trace = nullptr;
+    uint64_t status_period;
+
+    static uint64_t next_status;  // Virtual tick of the next status poll
+    static uint64_t next_client;  // Virtual tick of the next pass of the client task
+
+    // The step timer, TIMER_GROUP_0 / TIMER_0.
+    static struct {
+        bool     running = false;
+        uint64_t alarm   = 0;  // Alarm value, i.e. the ISR period in ticks
+        uint64_t next    = 0;  // Virtual tick of the next alarm
+        void (*isr)(void*) = nullptr;
+        void*    arg       = nullptr;
+    } timer;
+
+    // The pulse timer, TIMER_GROUP_0 / TIMER_1, which ends step pulses. Each pulse arms it for one
+    // alarm.
+    static struct {
+        bool     armed = false;
+        uint64_t alarm = 0;  // Ticks from the start of a pulse to its end
+        uint64_t next  = 0;  // Virtual tick of the alarm
+        void (*isr)(void*) = nullptr;
+        void*    arg       = nullptr;
+    } pulse;
+
+    static bool in_isr = false;
+
+#ifdef USE_I2S_STEPS
+    // The I2S stream, which steps the motors in place of the step timer in ST_I2S_STREAM mode. It
+    // plays one DMA buffer after another, each filled by the stepper's fill callback; a sample is
+    // I2S_OUT_USEC_PER_PULSE of machine time, and the step bits of each axis are bit(axis).
+    const int      I2S_SAMPLES      = I2S_OUT_DMABUF_LEN / sizeof(uint32_t);
+    const uint64_t I2S_SAMPLE_TICKS = I2S_OUT_USEC_PER_PULSE * ticksPerMicrosecond;
+    const uint32_t I2S_STEP_BITS    = bit(MAX_N_AXIS) - 1;
+
+    static struct {
+        i2s_out_pulser_status_t status      = PASSTHROUGH;
+        uint32_t                port_data   = 0;
+        uint32_t                last_sample = 0;
+        i2s_out_fill_func_t     fill        = nullptr;
+        uint32_t                buf[I2S_SAMPLES];
+    } i2s;
+
+    // Fills the next buffer and plays it: a step bit that rises is a step. Returns its length in
+    // ticks. When the stepper goes idle, the stream stops at the end of the buffer.
+    static uint64_t i2s_fill() {
+        uint64_t start = now;
+        uint32_t count = i2s.fill ? i2s.fill(i2s.buf, I2S_SAMPLES) : 0;
+        for (uint32_t i = 0; i < count; i++) {
+            uint32_t sample = i2s.buf[i];
+            uint32_t rising = sample & ~i2s.last_sample & I2S_STEP_BITS;
+            now             = start + i * I2S_SAMPLE_TICKS;
+            if (rising) {
+                motors_step(rising);
+            } else if (i2s.last_sample & ~sample & I2S_STEP_BITS) {
+                motors_unstep();
+            }
+            i2s.last_sample = sample;
+        }
+        now = start;
+        if (i2s.status == WAITING) {
+            i2s.status    = PASSTHROUGH;
+            timer.running = false;
+            now           = start + count * I2S_SAMPLE_TICKS;
+        }
+        return count * I2S_SAMPLE_TICKS;
+    }
+#endif
+
+    uint64_t wall_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    static uint64_t period() { return timer.alarm ? timer.alarm : 1; }
+
+    static void fire() {
+        now  = timer.next;
+        spin = 0;
+
+        uint64_t interval;
+        uint32_t loaded = st_get_buffer_stats().segments;
+        in_isr          = true;
+#ifdef USE_I2S_STEPS
+        if (current_stepper == ST_I2S_STREAM) {
+            interval = i2s_fill();
+        } else
+#endif
+        {
+            timer.isr(timer.arg);
+            // With auto reload, a period written inside the ISR takes effect
+            // for the interval that starts now.
+            interval = period();
+        }
+        in_isr = false;
+
+        stats.segments += st_get_buffer_stats().segments - loaded;
+        stats.isr_calls++;
+        timer.next = now + interval;
+
+        // The client task answers a '?' as it arrives, while the machine moves. It also sends the
+        // streamed reports that are due, as it runs every millisecond.
+        if (status_period && now >= next_status) {
+            next_status = now + status_period;
+            uint64_t t0 = wall_ns();
+            report_realtime_status(CLIENT_SERIAL);
+            stats.report_ns += wall_ns() - t0;
+        }
+        if (now >= next_client) {
+            next_client      = now + fStepperTimer / 1000;
+            uint32_t reports = stats.reports;
+            uint64_t t0      = wall_ns();
+            report_status_streams();
+            if (stats.reports != reports) {
+                stats.report_ns += wall_ns() - t0;
+            }
+        }
+    }
+
+    // Ends a step pulse, at the alarm of the pulse timer.
+    static void fire_pulse() {
+        now         = pulse.next;
+        spin        = 0;
+        pulse.armed = false;
+        in_isr      = true;
+        pulse.isr(pulse.arg);
+        in_isr = false;
+        stats.pulse_calls++;
+    }
+
+    // Fires whichever timer is due first, up to the tick given. Returns false if neither is.
+    static bool fire_next(uint64_t target) {
+        bool stepping = timer.running && timer.isr;
+        if (pulse.armed && pulse.next <= target && !(stepping && timer.next < pulse.next)) {
+            fire_pulse();
+        } else if (stepping && timer.next <= target) {
+            fire();
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    void advance(uint64_t ticks) {
+        uint64_t target   = now + ticks;
+        uint64_t reported = stats.report_ns;
+        uint64_t t0       = wall_ns();
+        while (fire_next(target)) {}
+        stats.isr_ns += wall_ns() - t0 - (stats.report_ns - reported);
+        if (now < target) {
+            now = target;  // The I2S stream can stop past it, at the end of a buffer
+        }
+    }
+
+    void run_segment() {
+        uint64_t loaded   = stats.segments;
+        uint64_t reported = stats.report_ns;
+        uint64_t t0       = wall_ns();
+        while (timer.running && timer.isr && stats.segments == loaded) {
+            fire_next(timer.next);
+        }
+        stats.isr_ns += wall_ns() - t0 - (stats.report_ns - reported);
+    }
+
+    void laser_power(uint32_t rpm) {
+        uint64_t t = now + spin;
+        stats.laser_energy += sys.spindle_speed * double(t - stats.power_since) / (fStepperTimer * 60.0);
+        stats.power_since = t;
+        if (rpm != sys.spindle_speed) {
+            stats.power_changes++;
+        }
+    }
+
+    static double per(uint64_t ns, uint64_t n) { return n ? double(ns) / n : 0.0; }
+
+    bool report(const char* name) {
+        auto   n_axis    = number_axis->get();
+        double seconds   = double(now - stats.start) / fStepperTimer;
+        double ideal_sec = stats.ideal_min * 60.0;
+        uint64_t host_ns = stats.total_ns - stats.read_ns - stats.report_ns - stats.prep_ns - stats.isr_ns;
+
+        bool ok = stats.errors == 0 && stats.alarms == 0;
+        if (stats.blocks == 0) {
+            return ok;  // Nothing moved, e.g. a file of settings
+        }
+
+        printf("%s\n", name);
+        printf("  blocks            %u from %u lines (%u errors, %u alarms)\n", stats.blocks, stats.lines, stats.errors, stats.alarms);
+        printf("  parser+planner    %.0f ns/block, %.0f blocks/s, %.0f ns/line\n",
+               per(host_ns, stats.blocks),
+               host_ns ? stats.blocks * 1e9 / host_ns : 0.0,
+               per(host_ns, stats.lines));
+        printf("    plan_buffer_line %.0f ns/block\n", per(stats.plan_ns, stats.blocks));
+#ifdef CUSTOM_CODE_FILENAME
+        if (stats.moves) {
+            printf("    kinematics       %.0f ns/segment, %.0f segments/s (%u moves, %u segments)\n",
+                   per(stats.kin_ns, stats.kin_blocks),
+                   stats.kin_ns ? stats.kin_blocks * 1e9 / stats.kin_ns : 0.0,
+                   stats.moves,
+                   stats.kin_blocks);
+        }
+#endif
+        if (stats.arcs) {
+            printf("    mc_arc           %.0f ns/arc, %.1f blocks/arc (%u arcs, %u blocks)\n",
+                   per(stats.arc_ns, stats.arcs),
+                   double(stats.arc_blocks) / stats.arcs,
+                   stats.arcs,
+                   stats.arc_blocks);
+        }
+        printf("  input framing     %.0f ns/line\n", per(stats.read_ns, stats.lines));
+        if (stats.reports) {
+            printf("  status report     %.0f ns/report (%u reports)\n", per(stats.report_ns, stats.reports), stats.reports);
+        }
+        printf("  segment prep      %.0f ns/segment (%llu segments, %u calls)\n",
+               per(stats.prep_ns, stats.segments),
+               (unsigned long long)stats.segments,
+               stats.prep_calls);
+        st_buffer_stats_t buffer = st_get_buffer_stats();
+        printf("    segments         %u at %u Hz, high water %u, low water %u, %u underruns\n",
+               buffer.size,
+               buffer.rate,
+               buffer.high_water,
+               buffer.low_water,
+               buffer.underruns);
+#ifdef USE_I2S_STEPS
+        printf("  I2S fill          %.0f ns/buffer, %.0f ns/step event (%llu buffers, %llu step events)\n",
+               per(stats.isr_ns, stats.isr_calls),
+               per(stats.isr_ns, stats.step_events),
+               (unsigned long long)stats.isr_calls,
+               (unsigned long long)stats.step_events);
+#elif defined(RMT_STEP_TRAINS)
+        printf("  step ISR          %.0f ns/interrupt, %.0f ns/step event (%llu interrupts, %llu step events)\n",
+               per(stats.isr_ns, stats.isr_calls),
+               per(stats.isr_ns, stats.step_events),
+               (unsigned long long)stats.isr_calls,
+               (unsigned long long)stats.step_events);
+#else
+        printf("  step ISR          %.0f ns/step interrupt (%llu interrupts, %llu pulse ends, %.1f timer polls each)\n",
+               per(stats.isr_ns, stats.isr_calls),
+               (unsigned long long)stats.isr_calls,
+               (unsigned long long)stats.pulse_calls,
+               stats.isr_calls ? double(stats.timer_polls) / stats.isr_calls : 0.0);
+#endif
+        printf("  machine time      %.3f s (%.3f s at programmed rate, %.1f%%)\n",
+               seconds,
+               ideal_sec,
+               seconds > 0 ? 100.0 * ideal_sec / seconds : 0.0);
+        printf("  average feed      %.1f mm/min achieved, %.1f mm/min programmed, over %.1f mm\n",
+               seconds > 0 ? stats.millimeters / (seconds / 60.0) : 0.0,
+               stats.ideal_min > 0 ? stats.millimeters / stats.ideal_min : 0.0,
+               stats.millimeters);
+        for (int axis = 0; axis < n_axis; axis++) {
+            if (stats.steps[axis] == 0) {
+                continue;
+            }
+            uint64_t interval = stats.min_interval[axis];
+            printf("  %c steps           %llu, peak %.0f steps/s",
+                   "XYZABC"[axis],
+                   (unsigned long long)stats.steps[axis],
+                   interval ? double(fStepperTimer) / interval : 0.0);
+            if (stats.jitter_n[axis]) {
+                printf(", jitter %.2f us RMS, %.2f us max",
+                       sqrt(stats.jitter_sq[axis] / stats.jitter_n[axis]) / ticksPerMicrosecond,
+                       double(stats.jitter_max[axis]) / ticksPerMicrosecond);
+            }
+            printf("\n");
+        }
+        printf("  direction changes %u\n", stats.dir_changes);
+        if (spindle->inLaserMode()) {
+            laser_power(sys.spindle_speed);
+            printf("  laser             %u power changes, %.1f S min burned, %.1f%% of programmed\n",
+                   stats.power_changes,
+                   stats.laser_energy,
+                   stats.laser_programmed > 0 ? 100.0 * stats.laser_energy / stats.laser_programmed : 0.0);
+        }
+
+        // The steps the ISR took must land exactly where the program ended.
+        float mpos[MAX_N_AXIS];
+        motor_position(mpos);
+        for (int axis = 0; axis < n_axis; axis++) {
+            float error = mpos[axis] - last_target[axis];
+            if (fabsf(error) > 1.0f / axis_settings[axis]->steps_per_mm->get()) {
+                printf("  %c position off by %.4f mm\n", "XYZABC"[axis], error);
+                ok = false;
+            }
+        }
+        return ok;
+    }
+}
+
+// Stepper timer (driver/timer.h)
+
+timg_dev_t TIMERG0;
+timg_dev_t TIMERG1;
+
+// The pulse timer runs free, and the stepper arms its alarm as it restarts its count, so the count
+// arms it here.
+
+esp_err_t timer_init(timer_group_t group, timer_idx_t idx, const timer_config_t* config) {
+    if (idx == TIMER_1) {
+        return ESP_OK;
+    }
+    Sim::timer.running = config->counter_en == TIMER_START;
+    return ESP_OK;
+}
+
+esp_err_t timer_set_counter_value(timer_group_t group, timer_idx_t idx, uint64_t value) {
+    if (idx == TIMER_1) {
+        Sim::pulse.armed = Sim::pulse.isr != nullptr;
+        Sim::pulse.next  = Sim::now + Sim::spin + Sim::pulse.alarm - value;
+        return ESP_OK;
+    }
+    Sim::timer.next = Sim::now + Sim::period() - value;
+    return ESP_OK;
+}
+
+esp_err_t timer_set_alarm_value(timer_group_t group, timer_idx_t idx, uint64_t value) {
+    if (idx == TIMER_1) {
+        Sim::pulse.alarm = value;
+        return ESP_OK;
+    }
+    if (!Sim::in_isr && Sim::timer.running) {
+        Sim::timer.next = Sim::timer.next - Sim::period() + (value ? value : 1);
+    }
+    Sim::timer.alarm = value;
+    return ESP_OK;
+}
+
+esp_err_t timer_enable_intr(timer_group_t group, timer_idx_t idx) {
+    return ESP_OK;
+}
+
+esp_err_t timer_isr_register(
+    timer_group_t group, timer_idx_t idx, void (*fn)(void*), void* arg, int intr_alloc_flags, timer_isr_handle_t* handle) {
+    if (idx == TIMER_1) {
+        Sim::pulse.isr = fn;
+        Sim::pulse.arg = arg;
+        return ESP_OK;
+    }
+    Sim::timer.isr = fn;
+    Sim::timer.arg = arg;
+    return ESP_OK;
+}
+
+esp_err_t timer_start(timer_group_t group, timer_idx_t idx) {
+    if (idx == TIMER_0) {
+        Sim::timer.running = true;
+    }
+    return ESP_OK;
+}
+
+esp_err_t timer_pause(timer_group_t group, timer_idx_t idx) {
+    if (idx == TIMER_0) {
+        Sim::timer.running = false;
+    }
+    return ESP_OK;
+}
+
+#ifdef USE_I2S_STEPS
+// I2S stream (I2SOut.h)
+
+int i2s_out_init() {
+    return 0;
+}
+
+uint8_t i2s_out_read(uint8_t pin) {
+    return (Sim::i2s.port_data >> pin) & 1;
+}
+
+void i2s_out_write(uint8_t pin, uint8_t val) {
+    if (val) {
+        Sim::i2s.port_data |= bit(pin);
+    } else {
+        Sim::i2s.port_data &= ~bit(pin);
+    }
+}
+
+uint32_t i2s_out_get_port_data() {
+    return Sim::i2s.port_data;
+}
+
+i2s_out_pulser_status_t i2s_out_get_pulser_status() {
+    return Sim::i2s.status;
+}
+
+int i2s_out_set_passthrough() {
+    if (Sim::i2s.status == STEPPING) {
+        // From the fill callback, the stream stops after its buffer.
+        Sim::i2s.status = Sim::in_isr ? WAITING : PASSTHROUGH;
+    }
+    if (Sim::i2s.status == PASSTHROUGH) {
+        Sim::timer.running = false;
+    }
+    return 0;
+}
+
+int i2s_out_set_stepping() {
+    if (Sim::i2s.status != STEPPING) {
+        Sim::i2s.status    = STEPPING;
+        Sim::timer.running = true;
+        Sim::timer.next    = Sim::now;
+    }
+    return 0;
+}
+
+void i2s_out_delay() {}
+
+int i2s_out_set_pulse_period(uint32_t usec) {
+    return 0;
+}
+
+int i2s_out_set_pulse_callback(i2s_out_pulse_func_t func) {
+    return 0;
+}
+
+int i2s_out_set_fill_callback(i2s_out_fill_func_t func) {
+    Sim::i2s.fill = func;
+    return 0;
+}
+
+int i2s_out_reset() {
+    if (Sim::i2s.status == WAITING) {
+        Sim::i2s.status = PASSTHROUGH;
+    }
+    return 0;
+}
+#endif
+
+// Time
+
+int64_t esp_timer_get_time() {
+    if (Sim::in_isr) {
+        // Busy-wait loops in the ISR poll this; each poll costs one tick.
+        Sim::stats.timer_polls++;
+        Sim::spin++;
+    }
+    return (Sim::now + Sim::spin) / ticksPerMicrosecond;
+}
+
+uint32_t millis() {
+    return Sim::now / (fStepperTimer / 1000);
+}
+
+uint32_t micros() {
+    return Sim::now / ticksPerMicrosecond;
+}
+
+void delay(uint32_t ms) {
+    Sim::advance(uint64_t(ms) * (fStepperTimer / 1000));
+}
+
+void delayMicroseconds(uint32_t us) {
+    Sim::advance(uint64_t(us) * ticksPerMicrosecond);
+}
+
+void vTaskDelay(TickType_t ticks) {
+    delay(ticks * portTICK_PERIOD_MS);
+}
+
+void vTaskDelayUntil(TickType_t* previous, TickType_t ticks) {
+    *previous += ticks;
+    if (*previous > millis()) {
+        delay(*previous - millis());
+    }
+}
+
+TickType_t xTaskGetTickCount() {
+    return millis() / portTICK_PERIOD_MS;
+}
+
+// The firmware runs its stepper ISR concurrently with the main loop. Here the
+// main loop drives it instead. A host streaming to an unloaded CPU keeps the
+// planner buffer full, so the step timer only runs when the main loop would
+// be waiting: when the planner buffer is full, or when no line has been read
+// and no block planned since the last refill of the segment buffer (a
+// synchronize or the end of the input). It then runs until the ISR has
+// consumed one segment. The step timing produced is what the firmware
+// would produce on an unloaded CPU with the host keeping up.
+//
+// These are hooked in with the linker's --wrap option (see the Makefile),
+// which needs the mangled C++ names.
+
+extern "C" void __real__Z14st_prep_bufferv();
+extern "C" void __wrap__Z14st_prep_bufferv() {
+    static uint32_t progress;  // Lines read plus blocks planned as of the last call
+
+    uint64_t t0 = Sim::wall_ns();
+    __real__Z14st_prep_bufferv();
+    Sim::stats.prep_ns += Sim::wall_ns() - t0;
+    Sim::stats.prep_calls++;
+
+    if (plan_check_full_buffer() || Sim::stats.lines + Sim::stats.blocks == progress) {
+        Sim::run_segment();
+    }
+    progress = Sim::stats.lines + Sim::stats.blocks;
+}
+
+void Sim::begin() {
+    memset(&stats, 0, sizeof(stats));
+    stats.start       = now;
+    stats.power_since = now;
+    next_status       = now;
+    next_client       = now;
+    motor_position(last_target);
+}
+
+extern "C" uint8_t __real__Z16plan_buffer_linePfP16plan_line_data_t(float* target, plan_line_data_t* pl_data);
+extern "C" uint8_t __wrap__Z16plan_buffer_linePfP16plan_line_data_t(float* target, plan_line_data_t* pl_data) {
+    auto  n_axis = number_axis->get();
+    float unit_vec[MAX_N_AXIS];
+    for (int axis = 0; axis < MAX_N_AXIS; axis++) {
+        unit_vec[axis] = axis < n_axis ? target[axis] - last_target[axis] : 0.0f;
+    }
+    float            millimeters = convert_delta_vector_to_unit_vector(unit_vec);
+    plan_line_data_t pl          = *pl_data;  // The planner may modify it
+    if (pl.curve) {
+        // A curved block is as long as the curve, and rate limited as the planner does it.
+        plan_curve_t* curve = pl.curve;
+        millimeters         = curve->length;
+        for (int axis = 0; axis < n_axis; axis++) {
+            unit_vec[axis] = curve->delta[axis] / curve->length;
+        }
+        unit_vec[curve->axis_0] = curve->reach[0] * curve->plane_length / curve->length;
+        unit_vec[curve->axis_1] = curve->reach[1] * curve->plane_length / curve->length;
+    }
+
+    uint64_t t0     = Sim::wall_ns();
+    uint8_t  result = __real__Z16plan_buffer_linePfP16plan_line_data_t(target, pl_data);
+    Sim::stats.plan_ns += Sim::wall_ns() - t0;
+
+    if (result == PLAN_OK) {
+        // Same rate limiting the planner applies, without acceleration.
+        float rapid_rate = SOME_LARGE_VALUE;
+        for (int axis = 0; axis < n_axis; axis++) {
+            if (unit_vec[axis] != 0) {
+                rapid_rate = MIN(rapid_rate, fabsf(axis_settings[axis]->max_rate->get() / unit_vec[axis]));
+            }
+        }
+        float minutes;
+        if (pl.motion.rapidMotion) {
+            minutes = millimeters / rapid_rate;
+        } else if (pl.motion.inverseTime) {
+            minutes = 1.0f / pl.feed_rate;
+        } else {
+            minutes = millimeters / MIN(pl.feed_rate, rapid_rate);
+        }
+        Sim::stats.blocks++;
+        Sim::stats.millimeters += millimeters;
+        Sim::stats.ideal_min += minutes;
+        if (!pl.motion.rapidMotion && pl.spindle != SpindleState::Disable) {
+            // A raster burns each pixel at its share of the spindle speed.
+            float power = pl.spindle_speed;
+            if (pl.raster) {
+                uint32_t sum = 0;
+                for (int pixel = 0; pixel < pl.raster->count; pixel++) {
+                    sum += pl.raster->power[pixel];
+                }
+                power *= sum / (255.0f * pl.raster->count);
+            }
+            Sim::stats.laser_programmed += power * minutes;
+        }
+        memcpy(last_target, target, sizeof(float) * n_axis);
+    }
+    return result;
+}
+
+// Arcs are measured whole: the planner blocks each one becomes, and the time
+// spent generating them. Planning the blocks is already counted separately.
+extern "C" void __real__Z6mc_arcPfP16plan_line_data_tS_S_fhhhh(
+    float* target, plan_line_data_t* pl_data, float* position, float* offset, float radius, uint8_t axis_0, uint8_t axis_1, uint8_t axis_linear, uint8_t is_clockwise_arc);
+extern "C" void __wrap__Z6mc_arcPfP16plan_line_data_tS_S_fhhhh(
+    float* target, plan_line_data_t* pl_data, float* position, float* offset, float radius, uint8_t axis_0, uint8_t axis_1, uint8_t axis_linear, uint8_t is_clockwise_arc) {
+    auto&    stats  = Sim::stats;
+    uint32_t blocks = stats.blocks;
+    uint64_t inner  = stats.plan_ns + stats.prep_ns + stats.isr_ns;
+
+    uint64_t t0 = Sim::wall_ns();
+    __real__Z6mc_arcPfP16plan_line_data_tS_S_fhhhh(target, pl_data, position, offset, radius, axis_0, axis_1, axis_linear, is_clockwise_arc);
+    stats.arc_ns += Sim::wall_ns() - t0 - (stats.plan_ns + stats.prep_ns + stats.isr_ns - inner);
+
+    stats.arcs++;
+    stats.arc_blocks += stats.blocks - blocks;
+}
+
+// Kinematics are measured per move: the time to turn a cartesian move into motor moves, not
+// counting the time in mc_line() for each of them, and the planner blocks it became. Moves made
+// inside MotionControl.cpp, such as arc chords, are not seen.
+static uint64_t line_ns;  // Inside mc_line() called by kinematics
+
+extern "C" bool __real__Z7mc_linePfP16plan_line_data_t(float* target, plan_line_data_t* pl_data);
+extern "C" bool __wrap__Z7mc_linePfP16plan_line_data_t(float* target, plan_line_data_t* pl_data) {
+    uint64_t t0     = Sim::wall_ns();
+    bool     result = __real__Z7mc_linePfP16plan_line_data_t(target, pl_data);
+    line_ns += Sim::wall_ns() - t0;
+    return result;
+}
+
+extern "C" bool __real__Z19cartesian_to_motorsPfP16plan_line_data_tS_(float* target, plan_line_data_t* pl_data, float* position);
+extern "C" bool __wrap__Z19cartesian_to_motorsPfP16plan_line_data_tS_(float* target, plan_line_data_t* pl_data, float* position) {
+    auto&    stats  = Sim::stats;
+    uint32_t blocks = stats.blocks;
+    uint64_t inner  = line_ns;
+
+    uint64_t t0     = Sim::wall_ns();
+    bool     result = __real__Z19cartesian_to_motorsPfP16plan_line_data_tS_(target, pl_data, position);
+    stats.kin_ns += Sim::wall_ns() - t0 - (line_ns - inner);
+
+    stats.moves++;
+    stats.kin_blocks += stats.blocks - blocks;
+    return result;
+}
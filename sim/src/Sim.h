@@ -0,0 +1,112 @@
+#pragma once
+
+/*
+  Sim.h - virtual clock and instrumentation for the Grbl_ESP32 host simulator
+
+  The firmware's stepper ISR, segment preparation, planner and g-code parser
+  run unmodified on the host. Only the step timer is replaced: instead of a
+  hardware alarm, the simulator fires onStepperDriverTimer() itself and keeps
+  a virtual clock in units of stepper timer ticks (fStepperTimer), so step
+  timing is exact and reproducible regardless of how fast the host is.
+
+  Grbl_ESP32 is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cstdint>
+#include <cstdio>
+
+namespace Sim {
+    // Virtual time in stepper timer ticks.
+    extern uint64_t now;
+
+    // Ticks spent inside the current ISR invocation, advanced by every
+    // esp_timer_get_time() call so busy-wait loops terminate.
+    extern uint64_t spin;
+
+    // Host-side cost and virtual-machine results accumulated over a run.
+    struct Stats {
+        // Host (wall clock) nanoseconds
+        uint64_t plan_ns;    // Inside plan_buffer_line()
+        uint64_t prep_ns;    // Inside st_prep_buffer()
+        uint64_t isr_ns;     // Running the step timer and its ISR
+        uint64_t arc_ns;     // Inside mc_arc(), less the planner, prep and ISR time it contains
+        uint64_t kin_ns;     // Inside cartesian_to_motors(), less the mc_line() calls it makes
+        uint64_t read_ns;    // Reading the input and framing it into lines
+        uint64_t report_ns;  // Sending status reports, polled and streamed
+        uint64_t total_ns;
+
+        uint64_t start;  // Virtual tick the run started at
+
+        uint32_t lines;         // Lines read from the input
+        uint32_t blocks;        // Blocks accepted by the planner
+        uint32_t arcs;          // mc_arc() calls
+        uint32_t arc_blocks;    // Blocks planned by them
+        uint32_t moves;         // cartesian_to_motors() calls from outside MotionControl.cpp
+        uint32_t kin_blocks;    // Blocks planned by them
+        uint32_t prep_calls;    // st_prep_buffer() invocations
+        uint32_t reports;       // Status reports sent
+        uint64_t segments;      // Segments loaded by the ISR
+        uint64_t isr_calls;     // Step timer interrupts, or I2S buffers filled
+        uint64_t pulse_calls;   // Pulse timer interrupts, each ending a step pulse
+        uint64_t step_events;   // Step pulses, of one or more axes
+        uint64_t timer_polls;   // esp_timer_get_time() calls made from the ISR
+
+        uint64_t steps[6];          // Rising step edges per axis
+        uint64_t min_interval[6];   // Shortest time between two steps, in ticks
+        uint64_t last_step[6];      // Tick of the previous step
+        uint64_t last_interval[6];  // Ticks between the two steps before it
+        double   jitter_sq[6];      // Squares of the changes of interval above 10 kHz, in ticks
+        uint64_t jitter_max[6];     // Largest such change
+        uint64_t jitter_n[6];       // Changes counted
+        uint32_t dir_changes;
+        uint32_t power_changes;      // Spindle speed changes, as the laser power changes along the path
+        double   laser_energy;       // Spindle speed integrated over machine time (S min)
+        double   laser_programmed;   // The same for the moves at their programmed rate (S min)
+        uint64_t power_since;        // Tick of the last spindle speed change
+
+        double millimeters;   // Programmed path length
+        double ideal_min;     // Time the moves would take at their programmed rate, in minutes
+
+        uint32_t errors;  // "error:" responses
+        uint32_t alarms;  // "ALARM:" responses
+    };
+    extern Stats stats;
+
+    // Ticks of machine time between status polls, as a sender sends '?'. Zero for none.
+    extern uint64_t status_period;
+
+    // Optional CSV trace of every step and direction edge.
+    extern FILE* trace;
+
+    // Wall clock in nanoseconds, for host-side timing.
+    uint64_t wall_ns();
+
+    // Counts a spindle speed change, and the energy burned at the speed before it.
+    void laser_power(uint32_t rpm);
+
+    // Advance virtual time by the given number of ticks, firing the stepper
+    // ISR at each alarm while the step timer is running.
+    void advance(uint64_t ticks);
+
+    // Run the step timer until the ISR loads its next segment or stops.
+    void run_segment();
+
+    // Start a new run: clear the statistics and take the current machine
+    // position as the start of the programmed path.
+    void begin();
+
+    // Print the benchmark summary. Returns false if the run had errors or
+    // alarms, or the steps taken do not end where the program does.
+    bool report(const char* name);
+}
@@ -0,0 +1,244 @@
+/*
+  Stubs.cpp - machine hardware as seen by the host simulator
+
+  Motors record their step and direction edges against the virtual clock.
+  The spindle is a null spindle that honours laser mode, so the planner and
+  segment prep take the same laser paths they take on a real machine.
+
+  Grbl_ESP32 is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "src/Grbl.h"
+#include "src/Spindles/NullSpindle.h"
+#include "Sim.h"
+
+// Motors
+
+uint8_t        motors_dir_mask = 0;
+static uint8_t step_bits       = 0;
+
+static void trace_edge(char kind, uint8_t bits, uint64_t t) {
+    if (Sim::trace) {
+        fprintf(Sim::trace, "%llu,%c,%u\n", (unsigned long long)t, kind, bits);
+    }
+}
+
+static void trace_edge(char kind, uint8_t bits) {
+    trace_edge(kind, bits, Sim::now + Sim::spin);
+}
+
+void init_motors() {}
+
+void motors_read_settings() {}
+
+uint8_t motors_set_homing_mode(uint8_t homing_mask, bool isHoming) {
+    return homing_mask;
+}
+
+bool motors_set_disable(bool disable, uint8_t mask) {
+    return false;
+}
+
+bool motors_direction(uint8_t dir_mask) {
+    if (dir_mask == motors_dir_mask) {
+        return false;
+    }
+    motors_dir_mask = dir_mask;
+    Sim::stats.dir_changes++;
+    trace_edge('D', dir_mask);
+    return true;
+}
+
+// Records a step of the axes in step_mask at virtual tick t.
+static void record_steps(uint8_t step_mask, uint64_t t) {
+    for (int axis = 0; axis < MAX_N_AXIS; axis++) {
+        if (bitnum_istrue(step_mask, axis)) {
+            auto&    stats    = Sim::stats;
+            uint64_t interval = t - stats.last_step[axis];
+            if (stats.steps[axis] && (stats.min_interval[axis] == 0 || interval < stats.min_interval[axis])) {
+                stats.min_interval[axis] = interval;
+            }
+            // Jitter is how much the interval between steps changes from one step to the next, at
+            // rates where the change from acceleration is much smaller than a timer tick.
+            const uint64_t fast = fStepperTimer / 10000;
+            if (stats.steps[axis] > 1 && interval < fast && stats.last_interval[axis] < fast) {
+                uint64_t last   = stats.last_interval[axis];
+                uint64_t change = interval > last ? interval - last : last - interval;
+                stats.jitter_sq[axis] += double(change) * change;
+                stats.jitter_max[axis] = MAX(stats.jitter_max[axis], change);
+                stats.jitter_n[axis]++;
+            }
+            stats.last_interval[axis] = interval;
+            stats.last_step[axis]     = t;
+            stats.steps[axis]++;
+        }
+    }
+    Sim::stats.step_events++;
+}
+
+void motors_step(uint8_t step_mask) {
+    if (step_mask == 0) {
+        return;
+    }
+    record_steps(step_mask, Sim::now + Sim::spin);
+    step_bits = step_mask;
+    trace_edge('S', step_mask);
+}
+
+void motors_unstep() {
+    if (step_bits) {
+        step_bits = 0;
+        trace_edge('U', 0);
+    }
+}
+
+// The simulated I2S stream takes the step bits of each axis as bit(axis).
+bool motors_i2s_step_bits(uint32_t* axis_bits) {
+    for (int axis = 0; axis < MAX_N_AXIS; axis++) {
+        axis_bits[axis] = bit(axis);
+    }
+    return true;
+}
+
+// The simulated motors step on GPIO 0 to 5, one for each axis, active high, so a step plan writes
+// the step_mask itself. What the plan writes to the GPIO registers is a step, or its end.
+bool motors_step_plan(motors_plan_t* plan) {
+    memset(plan, 0, sizeof(*plan));
+    for (uint32_t step_mask = 0; step_mask < bit(MAX_N_AXIS); step_mask++) {
+        plan->step[step_mask].set[0] = step_mask;
+    }
+    plan->unstep.clear[0] = bit(MAX_N_AXIS) - 1;
+    return true;
+}
+
+void sim_gpio_write(int bank, bool high, uint32_t pins) {
+    if (bank != 0 || pins == 0) {
+        return;
+    }
+    if (high) {
+        motors_step(pins);
+    } else {
+        motors_unstep();
+    }
+}
+
+// The simulated RMT takes trains on every axis. They play from the interrupt that sends them, with
+// RMT ticks of 1 / RMT_TICKS_PER_MICROSECOND us; the pulses of several axes that start on the same
+// tick are one step event.
+bool motors_rmt_trains() {
+    return true;
+}
+
+void motors_send_trains(rmt_item32_t (*trains)[RMT_TRAIN_ITEMS], uint8_t step_mask) {
+    const uint64_t rmt_ticks = ticksPerMicrosecond / RMT_TICKS_PER_MICROSECOND;
+    int            next[MAX_N_AXIS];
+    uint64_t       start[MAX_N_AXIS];  // RMT tick at which the next pulse of each axis starts
+    for (int axis = 0; axis < MAX_N_AXIS; axis++) {
+        next[axis] = 0;
+        if (bitnum_istrue(step_mask, axis)) {
+            start[axis] = trains[axis][0].duration0;
+        }
+    }
+    while (true) {
+        uint8_t  mask = 0;
+        uint64_t at   = UINT64_MAX;
+        for (int axis = 0; axis < MAX_N_AXIS; axis++) {
+            if (bitnum_istrue(step_mask, axis) && trains[axis][next[axis]].duration0 != 0 && start[axis] <= at) {
+                mask = start[axis] < at ? bit(axis) : mask | bit(axis);
+                at   = start[axis];
+            }
+        }
+        if (mask == 0) {
+            return;
+        }
+        uint64_t t     = Sim::now + at * rmt_ticks;
+        uint32_t pulse = 0;
+        for (int axis = 0; axis < MAX_N_AXIS; axis++) {
+            if (bitnum_istrue(mask, axis)) {
+                const rmt_item32_t& item = trains[axis][next[axis]++];
+                pulse                    = item.duration1;
+                start[axis] += item.duration1 + trains[axis][next[axis]].duration0;
+            }
+        }
+        record_steps(mask, t);
+        trace_edge('S', mask, t);
+        trace_edge('U', 0, t + pulse * rmt_ticks);
+    }
+}
+
+uint32_t i2s_out_push_sample(uint32_t usec) {
+    return 0;
+}
+
+// Spindle
+
+namespace Spindles {
+    class Sim : public Null {
+    public:
+        bool inLaserMode() override { return laser_mode->get(); }
+
+        uint32_t set_rpm(uint32_t rpm) override {
+            ::Sim::laser_power(rpm);
+            return Null::set_rpm(rpm);
+        }
+
+        void set_state(SpindleState state, uint32_t rpm) override {
+            ::Sim::laser_power(rpm);
+            Null::set_state(state, rpm);
+        }
+    };
+
+    static Sim sim;
+
+    void Spindle::select() {
+        spindle = &sim;
+        spindle->init();
+    }
+
+    bool Spindle::inLaserMode() { return false; }
+
+    void Spindle::sync(SpindleState state, uint32_t rpm) {
+        if (sys.state == State::CheckMode) {
+            return;
+        }
+        protocol_buffer_synchronize();  // Empty planner buffer to ensure spindle is set when programmed.
+        set_state(state, rpm);
+    }
+
+    void Spindle::deinit() { stop(); }
+}
+
+Spindles::Spindle* spindle;
+
+// User I/O
+
+namespace UserOutput {
+    DigitalOutput::DigitalOutput(uint8_t number, uint8_t pin) : _number(number), _pin(pin) {}
+    bool DigitalOutput::set_level(bool isOn) { return true; }
+
+    AnalogOutput::AnalogOutput(uint8_t number, uint8_t pin, float pwm_frequency) :
+        _number(number), _pin(pin), _pwm_frequency(pwm_frequency), _resolution_bits(10), _current_value(0) {}
+    bool AnalogOutput::set_level(uint32_t numerator) {
+        _current_value = numerator;
+        return true;
+    }
+}
+
+// Web UI
+
+namespace WebUI {
+    void make_web_settings() {}
+
+    bool COMMANDS::isLocalPasswordValid(char* password) { return true; }
+}
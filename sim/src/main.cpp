@@ -0,0 +1,240 @@
+/*
+  main.cpp - Grbl_ESP32 host simulator
+
+  Streams g-code files through the unmodified protocol loop, parser, planner,
+  segment prep and stepper ISR, then prints host-side cost and the resulting
+  machine timing for each file. Files are run in order against the same
+  machine, so a file of $ settings can precede the program it applies to.
+  The exit status is non-zero if any file produced an error or alarm, or if
+  the steps taken do not end where the program does.
+
+    grbl_sim [-v] [-b blocks] [-s segments] [-r rate] [-q hz] [-t trace.csv] file.nc...
+
+    -v    echo everything Grbl sends; otherwise only errors and alarms
+    -b    size the planner buffer as if $Planner/Blocks had been set before
+          startup
+    -s    size the segment buffer as if $Stepper/Segments had been set before
+          startup
+    -r    set the segment rate as if $Stepper/SegmentRate had been set before
+          startup
+    -q    poll the status report at the given rate of machine time, as a
+          sender does with '?'
+    -t    write every step and direction edge to a CSV file
+          (tick,kind,bits; kind is D=direction, S=step, U=unstep;
+          one tick is 1/fStepperTimer seconds)
+
+  Grbl_ESP32 is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "src/Grbl.h"
+#include "Sim.h"
+
+#include <unistd.h>
+
+static const char* input_name;
+static FILE*       input;
+static LineRing    input_lines;
+static bool        input_eol;  // A newline is still owed at end of file
+static uint32_t    input_line;
+static bool        verbose = false;
+static uint64_t    start_ns;
+static bool        all_ok = true;
+static char*       planner_blocks_value;
+static char*       segments_value;
+static char*       segment_rate_value;
+
+// The serial client. The input file is the only client with data; Grbl
+// reads it as fast as the planner accepts lines, as it would a host that
+// streams with character counting. The file is framed into lines by the
+// firmware's LineRing, as clientCheckTask() does on the machine. That runs
+// in its own task there, so its time is counted apart from the main loop.
+
+void client_init() {}
+
+void client_reset_read_buffer(uint8_t client) {
+    input_lines.reset();
+}
+
+int client_get_rx_buffer_available(uint8_t client) {
+    return input_lines.room();
+}
+
+static int input_read() {
+    int c = getc(input);
+    if (c != EOF) {
+        input_eol = c != '\n';
+        if (c == '\n') {
+            input_line++;
+            Sim::stats.lines++;
+        }
+        return c;
+    }
+    if (input_eol) {
+        input_eol = false;
+        input_line++;
+        Sim::stats.lines++;
+        return '\n';
+    }
+    return EOF;
+}
+
+Error client_get_line(uint8_t client, char** line) {
+    if (client != CLIENT_SERIAL) {
+        return Error::Ok;
+    }
+    uint64_t t0 = Sim::wall_ns();
+    Error    res;
+    while ((res = input_lines.get(line)) == Error::Ok) {
+        if (input == nullptr) {
+            return Error::Ok;
+        }
+        int c = input_read();
+        if (c != EOF) {
+            input_lines.put(c);  // The ring is empty, so there is room
+            continue;
+        }
+
+        // End of the file. Let the machine finish, then end this run.
+        Sim::stats.read_ns += Sim::wall_ns() - t0;
+        fclose(input);
+        input = nullptr;
+        protocol_buffer_synchronize();
+        Sim::stats.total_ns = Sim::wall_ns() - start_ns;
+        all_ok &= Sim::report(input_name);
+        sys.abort = true;
+        return Error::Ok;
+    }
+    Sim::stats.read_ns += Sim::wall_ns() - t0;
+    return res;
+}
+
+void client_release_line(uint8_t client) {
+    input_lines.release();
+}
+
+void client_write(uint8_t client, const char* text) {
+    if (text[0] == '<') {
+        Sim::stats.reports++;
+    }
+    if (strncmp(text, "error:", 6) == 0) {
+        Sim::stats.errors++;
+        printf("%s:%u: %s", input_name, input_line, text);
+        return;
+    }
+#ifdef ENABLE_BINARY_FRAMES
+    // A frame is answered with an Ack frame. Its first four base64 characters after the ':' hold
+    // the length, the type and the status.
+    if (text[0] == FRAME_START && strlen(text) > 5) {
+        static const char* digits = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        uint32_t           bits   = 0;
+        for (int i = 1; i <= 4; i++) {
+            const char* digit = strchr(digits, text[i]);
+            bits              = bits << 6 | (digit ? digit - digits : 0);
+        }
+        if ((bits >> 8 & 0xff) == uint8_t(FrameType::Ack) && (bits & 0xff)) {
+            Sim::stats.errors++;
+            printf("%s:%u: frame error:%u\n", input_name, input_line, bits & 0xff);
+            return;
+        }
+    }
+#endif
+    bool alarm = strncmp(text, "ALARM:", 6) == 0;
+    if (alarm) {
+        Sim::stats.alarms++;
+    }
+    if (verbose || alarm) {
+        fputs(text, stdout);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int opt;
+    while ((opt = getopt(argc, argv, "vb:s:r:q:t:")) != -1) {
+        switch (opt) {
+            case 'v':
+                verbose = true;
+                break;
+            case 'b':
+                planner_blocks_value = optarg;
+                break;
+            case 's':
+                segments_value = optarg;
+                break;
+            case 'r':
+                segment_rate_value = optarg;
+                break;
+            case 'q':
+                Sim::status_period = atof(optarg) > 0 ? uint64_t(fStepperTimer / atof(optarg)) : 0;
+                break;
+            case 't':
+                Sim::trace = fopen(optarg, "w");
+                if (Sim::trace == nullptr) {
+                    perror(optarg);
+                    return 1;
+                }
+                fprintf(Sim::trace, "tick,kind,bits\n");
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-v] [-b blocks] [-s segments] [-r rate] [-q hz] [-t trace.csv] file.nc...\n", argv[0]);
+                return 1;
+        }
+    }
+    if (optind >= argc) {
+        fprintf(stderr, "usage: %s [-v] [-b blocks] [-s segments] [-r rate] [-q hz] [-t trace.csv] file.nc...\n", argv[0]);
+        return 1;
+    }
+
+    grbl_init();
+    if (planner_blocks_value) {
+        // Nothing is stored between runs, so restart the planner as the
+        // firmware would after the setting was saved and the board reset.
+        if (planner_blocks->setStringValue(planner_blocks_value) != Error::Ok) {
+            fprintf(stderr, "%s: bad planner block count\n", planner_blocks_value);
+            return 1;
+        }
+        plan_init();
+        plan_reset();
+    }
+    if (segments_value || segment_rate_value) {
+        if (segments_value && stepper_segments->setStringValue(segments_value) != Error::Ok) {
+            fprintf(stderr, "%s: bad segment count\n", segments_value);
+            return 1;
+        }
+        if (segment_rate_value && stepper_segment_rate->setStringValue(segment_rate_value) != Error::Ok) {
+            fprintf(stderr, "%s: bad segment rate\n", segment_rate_value);
+            return 1;
+        }
+        stepper_init();
+        st_reset();
+    }
+    for (int i = optind; i < argc; i++) {
+        input_name = argv[i];
+        input      = fopen(input_name, "r");
+        if (input == nullptr) {
+            perror(input_name);
+            return 1;
+        }
+        input_eol  = false;
+        input_line = 0;
+
+        Sim::begin();
+        start_ns = Sim::wall_ns();
+        run_once();  // Returns when client_get_line() reaches the end of the file
+    }
+
+    if (Sim::trace) {
+        fclose(Sim::trace);
+    }
+    return all_ok ? 0 : 1;
+}